@@ -8448,6 +8448,281 @@ int GetParamFieldIntMM
     return num >= min && num <= max ? num : def;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    ParamHash_t			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// The index helpers access the keys by 'base' and 'stride'.
+
+static inline ccp GetHashKey ( cvp base, uint stride, uint idx )
+{
+    return *(ccp*)( (u8*)base + idx * stride );
+}
+
+//-----------------------------------------------------------------------------
+
+static uint * FindHashSlot
+(
+    // return the slot of 'key' or the empty slot to insert 'key'
+
+    uint	*hash,		// valid hash index
+    uint	hash_size,	// number of elements of 'hash', power of 2
+    cvp		base,		// field
+    uint	stride,		// size of a field item
+    ccp		key		// key to search
+)
+{
+    DASSERT(hash);
+    DASSERT(hash_size);
+    DASSERT(key);
+
+    const uint mask = hash_size - 1;
+    uint idx = HashStringFNV(key) & mask;
+    while (hash[idx])
+    {
+	if (!strcmp(key,GetHashKey(base,stride,hash[idx]-1)))
+	    break;
+	idx = ( idx + 1 ) & mask;
+    }
+    return hash + idx;
+}
+
+//-----------------------------------------------------------------------------
+
+static void RebuildHashIndex
+(
+    uint	**p_hash,	// pointer to hash index
+    uint	*p_hash_size,	// pointer to number of elements of hash index
+    cvp		base,		// field
+    uint	stride,		// size of a field item
+    uint	used,		// number of used items of field
+    uint	need		// number of items the index must support
+)
+{
+    DASSERT(p_hash);
+    DASSERT(p_hash_size);
+
+    // linear probing => load factor <= 50%
+    uint size = 0x40;
+    while ( size < 2*need )
+	size <<= 1;
+
+    if ( size != *p_hash_size )
+    {
+	FREE(*p_hash);
+	*p_hash = CALLOC(size,sizeof(**p_hash));
+	*p_hash_size = size;
+    }
+    else
+	memset(*p_hash,0,size*sizeof(**p_hash));
+
+    uint *hash = *p_hash;
+    const uint mask = size - 1;
+    for ( uint i = 0; i < used; i++ )
+    {
+	uint idx = HashStringFNV(GetHashKey(base,stride,i)) & mask;
+	while (hash[idx])
+	    idx = ( idx + 1 ) & mask;
+	hash[idx] = i + 1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static __thread int (*hash_sort_cmp)( ccp s1, ccp s2 );
+
+static int cmp_hash_key ( const void * va, const void * vb )
+{
+    DASSERT(va);
+    DASSERT(vb);
+    DASSERT(hash_sort_cmp);
+    return hash_sort_cmp( *(ccp*)va, *(ccp*)vb );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetParamHash ( ParamHash_t * ph )
+{
+    DASSERT(ph);
+    if (ph)
+    {
+	ResetParamField(&ph->pf);
+	FREE(ph->hash);
+	ph->hash	= 0;
+	ph->hash_size	= 0;
+	ph->sorted	= false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int FindParamHashIndex ( const ParamHash_t * ph, ccp key, int not_found_value )
+{
+    DASSERT(ph);
+    if ( !key || !ph->pf.used )
+	return not_found_value;
+
+    const uint *slot = FindHashSlot( ph->hash, ph->hash_size,
+				ph->pf.field, sizeof(*ph->pf.field), key );
+    return *slot ? *slot - 1 : not_found_value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ParamFieldItem_t * FindParamHash ( const ParamHash_t * ph, ccp key )
+{
+    const int idx = FindParamHashIndex(ph,key,-1);
+    return idx >= 0 ? ph->pf.field + idx : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint * GetParamHashSlot ( ParamHash_t * ph, ccp key )
+{
+    // like FindHashSlot(), but grow the index if necessary
+
+    DASSERT(ph);
+    DASSERT(key);
+
+    if ( 2*(ph->pf.used+1) > ph->hash_size )
+	RebuildHashIndex( &ph->hash, &ph->hash_size, ph->pf.field,
+			sizeof(*ph->pf.field), ph->pf.used, ph->pf.used+1 );
+
+    return FindHashSlot( ph->hash, ph->hash_size,
+			ph->pf.field, sizeof(*ph->pf.field), key );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ParamFieldItem_t * FindInsertParamHash
+	( ParamHash_t * ph, ccp key, bool move_key, uint num, bool *old_found )
+{
+    if (!key)
+	return 0;
+
+    uint *slot = GetParamHashSlot(ph,key);
+    const bool found = *slot != 0;
+    ParamFieldItem_t *item;
+    if (found)
+    {
+	if (move_key)
+	    FreeString(key);
+	item = ph->pf.field + *slot - 1;
+    }
+    else
+    {
+	item = AppendParamField(&ph->pf,key,move_key,num,0);
+	*slot = ph->pf.used;
+	ph->sorted = false;
+    }
+
+    if (old_found)
+	*old_found = found;
+    return item;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ParamFieldItem_t * IncrementParamHash ( ParamHash_t * ph, ccp key, bool move_key )
+{
+    ParamFieldItem_t *item = FindInsertParamHash(ph,key,move_key,0,0);
+    if (item)
+	item->num++;
+    return item;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool InsertParamHash
+	( ParamHash_t * ph, ccp key, bool move_key, uint num, cvp data )
+{
+    if (!key)
+	return 0;
+
+    uint *slot = GetParamHashSlot(ph,key);
+    if (*slot)
+    {
+	if (move_key)
+	    FreeString(key);
+	if (ph->pf.free_data)
+	    FREE((void*)data);
+	return false;
+    }
+
+    AppendParamField(&ph->pf,key,move_key,num,data);
+    *slot = ph->pf.used;
+    ph->sorted = false;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ReplaceParamHash
+	( ParamHash_t * ph, ccp key, bool move_key, uint num, cvp data )
+{
+    if (!key)
+	return 0;
+
+    uint *slot = GetParamHashSlot(ph,key);
+    if (*slot)
+    {
+	if (move_key)
+	    FreeString(key);
+
+	ParamFieldItem_t * dest = ph->pf.field + *slot - 1;
+	dest->num = num;
+	if (ph->pf.free_data)
+	    FREE(dest->data);
+	dest->data = (void*)data;
+	return false;
+    }
+
+    AppendParamField(&ph->pf,key,move_key,num,data);
+    *slot = ph->pf.used;
+    ph->sorted = false;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool RemoveParamHash ( ParamHash_t * ph, ccp key )
+{
+    const int idx = FindParamHashIndex(ph,key,-1);
+    if ( idx < 0 )
+	return false;
+
+    ParamFieldItem_t * dest = ph->pf.field + idx;
+    FreeString(dest->key);
+    if (ph->pf.free_data)
+	FREE(dest->data);
+    ph->pf.used--;
+    memmove(dest,dest+1,(ph->pf.used-idx)*sizeof(*dest));
+
+    // the indices behind 'idx' have changed
+    RebuildHashIndex( &ph->hash, &ph->hash_size, ph->pf.field,
+			sizeof(*ph->pf.field), ph->pf.used, ph->hash_size/2 );
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SortParamHash ( ParamHash_t * ph )
+{
+    DASSERT(ph);
+    if (!ph->sorted)
+    {
+	if ( ph->pf.used > 1 )
+	{
+	    hash_sort_cmp = ph->pf.func_cmp ? ph->pf.func_cmp : strcmp;
+	    qsort( ph->pf.field, ph->pf.used, sizeof(*ph->pf.field), cmp_hash_key );
+	    RebuildHashIndex( &ph->hash, &ph->hash_size, ph->pf.field,
+			sizeof(*ph->pf.field), ph->pf.used, ph->hash_size/2 );
+	}
+	ph->sorted = true;
+    }
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			  exmem_list_t			///////////////
@@ -6380,6 +6380,64 @@ ccp GetParamFieldStr	( ParamField_t *pf, uint mark, ccp key, ccp def );
 int GetParamFieldInt	( ParamField_t *pf, uint mark, ccp key, int def );
 int GetParamFieldIntMM	( ParamField_t *pf, uint mark, ccp key, int def, int min, int max );
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			struct ParamHash_t		///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Variant of ParamField_t with an additional hash index for large key sets.
+// New items are appended => find and insert are O(1), but the field is in
+// insertion order until it is sorted by SortParamHash(). Keys are compared
+// by strcmp(), 'func_cmp' is only used for sorting. Item pointers are valid
+// until the next insert or remove. Iterate by 'ph->pf', but never modify it
+// directly.
+///////////////////////////////////////////////////////////////////////////////
+
+// FNV-1a hash of a NULL terminated string, upper bits folded into the lower
+// bits, so that the result can be masked for power of 2 tables.
+
+static inline uint HashStringFNV ( ccp str )
+{
+    DASSERT(str);
+    uint hash = 2166136261u;
+    while (*str)
+	hash = ( hash ^ (uchar)*str++ ) * 16777619u;
+    return hash ^ hash >> 16;
+}
+
+//-----------------------------------------------------------------------------
+// [[ParamHash_t]]
+
+typedef struct ParamHash_t
+{
+    ParamField_t	pf;		// items, in insertion order or sorted
+    uint		*hash;		// hash index: 0=unused, else index+1 of 'pf'
+    uint		hash_size;	// number of elements of 'hash', power of 2
+    bool		sorted;		// true: 'pf' is sorted
+
+} ParamHash_t;
+
+//-----------------------------------------------------------------------------
+
+static inline void InitializeParamHash ( ParamHash_t * ph )
+	{ DASSERT(ph); memset(ph,0,sizeof(*ph)); }
+
+void ResetParamHash ( ParamHash_t * ph );
+
+int FindParamHashIndex ( const ParamHash_t * ph, ccp key, int not_found_value );
+ParamFieldItem_t * FindParamHash ( const ParamHash_t * ph, ccp key );
+ParamFieldItem_t * FindInsertParamHash
+		( ParamHash_t * ph, ccp key, bool move_key, uint num, bool *old_found );
+ParamFieldItem_t * IncrementParamHash ( ParamHash_t * ph, ccp key, bool move_key );
+
+// Insert: Insert only if not found, Replace: Insert or replace data
+// return: true if item inserted/deleted
+bool InsertParamHash ( ParamHash_t * ph, ccp key, bool move_key, uint num, cvp data );
+bool ReplaceParamHash( ParamHash_t * ph, ccp key, bool move_key, uint num, cvp data );
+bool RemoveParamHash ( ParamHash_t * ph, ccp key ); // O(N)
+
+// sort field using ph->pf.func_cmp() and rebuild the index
+void SortParamHash ( ParamHash_t * ph );
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			struct exmem_list_t		///////////////
@@ -4938,7 +4938,8 @@ static s_usec_t prepare_wait_fdl ( FDList_t *fdl )
     DASSERT(fdl);
     const s_usec_t now_usec = GetTimeUSec(false);
 
-    if (fdl->timeout_nsec)
+    // M1 is set by ClearFDList() and means: no timeout
+    if ( fdl->timeout_nsec && fdl->timeout_nsec != M1(fdl->timeout_nsec) )
     {
 	const u_usec_t wait_until
 	    = ( (s_usec_t)fdl->timeout_nsec - (s_usec_t)GetTimerNSec() )
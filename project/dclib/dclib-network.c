@@ -5428,16 +5428,17 @@ static void ScanBufferCommandTCP ( struct TCPStream_t * ts, bool finish )
 	const u8 ch = *ptr;
 	if ( !ch || ch == '\n' || ch == '\r' || ch == ';' || ch == comma )
 	{
-	    DropGrowBuffer(&ts->ibuf,ptr+1-beg);
+	    // scan before drop, because dropping all clears the first byte
 	    ScanLineCommandTCP(ts,(char*)beg,(char*)ptr,now_usec);
+	    DropGrowBuffer(&ts->ibuf,ptr+1-beg);
 	    return;
 	}
     }
 
     if ( ptr > beg && ( finish || ts->eof ) )
     {
-	DropGrowBuffer(&ts->ibuf,ptr-beg);
 	ScanLineCommandTCP(ts,(char*)beg,(char*)ptr,now_usec);
+	DropGrowBuffer(&ts->ibuf,ptr-beg);
     }
 }
 
@@ -508,47 +508,281 @@ void AnalyzeSZS
 
 ///////////////////////////////////////////////////////////////////////////////
 
-uint GetCtIdByList ( sha1_hex_t sha1 )
+// The id list is loaded once and stored as list sorted by SHA1. If option
+// --id-list-index is set, file »ID_LIST.idx« is used as precompiled index,
+// if size and modification time (in nanoseconds) of the id list match the
+// values stored in the header of the index. Otherwise the index is created
+// after scanning the text.
+
+#define ID_LIST_MAGIC "SHA1IDX2"
+
+typedef struct id_list_item_t
 {
-    if ( strlen(sha1) != 40 || !opt_id_list )
-	return 0;
+    sha1_hash_t	sha1;		// SHA1 of track
+    u32		id;		// id of track
+    u32		seq;		// line number, only used for sorting
+}
+id_list_item_t;
+
+typedef struct id_list_header_t
+{
+    char	magic[8];	// ID_LIST_MAGIC
+    be32_t	n_rec;		// number of records
+    be32_t	mtime_nsec;	// modification time of id list: nanoseconds
+    be64_t	mtime_sec;	// modification time of id list: seconds
+    be64_t	size;		// size of id list
+}
+__attribute__ ((packed)) id_list_header_t;
+
+typedef struct id_list_record_t
+{
+    sha1_hash_t	sha1;		// SHA1 of track
+    be32_t	id;		// id of track
+}
+__attribute__ ((packed)) id_list_record_t;
+
+static id_list_item_t	*id_list	= 0;	// sorted list
+static uint		id_list_used	= 0;	// number of used elements
+static ccp		id_list_fname	= 0;	// source of 'id_list'
+
+//-----------------------------------------------------------------------------
+
+static int sort_id_list ( const void *va, const void *vb )
+{
+    // sort by SHA1 and keep the order of the text file for identical SHA1
+
+    const id_list_item_t *a = va;
+    const id_list_item_t *b = vb;
+    const int stat = memcmp(a->sha1,b->sha1,sizeof(a->sha1));
+    return stat ? stat : a->seq < b->seq ? -1 : a->seq > b->seq;
+}
+
+//-----------------------------------------------------------------------------
+
+static void setup_id_list_header
+(
+    id_list_header_t	*head,		// header to setup
+    const struct stat	*st_text,	// status of the id list
+    uint		n_rec		// number of records
+)
+{
+    DASSERT(head);
+    DASSERT(st_text);
+
+    memset(head,0,sizeof(*head));
+    memcpy(head->magic,ID_LIST_MAGIC,sizeof(head->magic));
+    write_be32(&head->n_rec,n_rec);
+    write_be64(&head->size,st_text->st_size);
+ #if HAVE_STATTIME_NSEC
+    write_be64(&head->mtime_sec,st_text->st_mtim.tv_sec);
+    write_be32(&head->mtime_nsec,st_text->st_mtim.tv_nsec);
+ #else
+    write_be64(&head->mtime_sec,st_text->st_mtime);
+ #endif
+}
+
+//-----------------------------------------------------------------------------
+
+static bool load_id_list_index ( ccp fname, const struct stat *st_text )
+{
+    DASSERT(fname);
+    DASSERT(st_text);
+
+    struct stat st;
+    if ( stat(fname,&st) || !S_ISREG(st.st_mode) )
+	return false;
+
+    const size_t hsize = sizeof(id_list_header_t);
+    if ( st.st_size < hsize || ( st.st_size - hsize ) % sizeof(id_list_record_t) )
+	return false;
+
+    FILE *f = fopen(fname,"rb");
+    if (!f)
+	return false;
+
+    // the index is valid, if the header matches size and mtime of the text
+
+    id_list_header_t head, expected;
+    const uint n = ( st.st_size - hsize ) / sizeof(id_list_record_t);
+    setup_id_list_header(&expected,st_text,n);
+    bool ok = fread(&head,sizeof(head),1,f) == 1
+	   && !memcmp(&head,&expected,sizeof(head));
+    if (ok)
+    {
+	id_list = MALLOC( n * sizeof(*id_list) + 1 );
+	id_list_used = n;
+
+	id_list_item_t *ptr = id_list;
+	for ( uint i = 0; ok && i < n; i++, ptr++ )
+	{
+	    id_list_record_t rec;
+	    ok = fread(&rec,sizeof(rec),1,f) == 1;
+	    memcpy(ptr->sha1,rec.sha1,sizeof(ptr->sha1));
+	    ptr->id  = be32(&rec.id);
+	    ptr->seq = i;
+	}
+    }
+    fclose(f);
+    return ok;
+}
+
+//-----------------------------------------------------------------------------
+
+static void save_id_list_index ( ccp fname, const struct stat *st_text )
+{
+    DASSERT(fname);
+    DASSERT(st_text);
 
-    char search[42];
-    StringCat2S(search,sizeof(search),sha1,"|");
+    // write a temporary file and rename it (atomic for parallel jobs)
 
-    static char prev_search[42] = "";
-    static uint prev_id = 0;
+    char temp[PATH_MAX];
+    snprintf(temp,sizeof(temp),"%s.%u.tmp",fname,getpid());
+    FILE *f = fopen(temp,"wb");
+    if (!f)
+	return;
+
+    id_list_header_t head;
+    setup_id_list_header(&head,st_text,id_list_used);
+    bool ok = fwrite(&head,sizeof(head),1,f) == 1;
 
-    if (!strcmp(search,prev_search))
+    const id_list_item_t *ptr = id_list;
+    for ( uint i = 0; ok && i < id_list_used; i++, ptr++ )
     {
-	PRINT0("search=%s, prev=%u\n",search,prev_id);
-	return prev_id;
+	id_list_record_t rec;
+	memcpy(rec.sha1,ptr->sha1,sizeof(rec.sha1));
+	write_be32(&rec.id,ptr->id);
+	ok = fwrite(&rec,sizeof(rec),1,f) == 1;
     }
 
-    PRINT0("search=%s\n",search);
-    strcpy(prev_search,search);
-    prev_id = 0;
-    
-    FILE *f = fopen(opt_id_list,"r");
+    if ( fclose(f) || !ok || rename(temp,fname) )
+	unlink(temp);
+}
+
+//-----------------------------------------------------------------------------
+
+static bool load_id_list(void)
+{
+    if ( id_list_fname == opt_id_list )
+	return id_list != 0;
+
+    FREE(id_list);
+    id_list = 0;
+    id_list_used = 0;
+    id_list_fname = opt_id_list;
+
+    struct stat st;
+    FILE *f = stat(opt_id_list,&st) ? 0 : fopen(opt_id_list,"r");
     if (!f)
     {
 	ERROR1(ERR_CANT_OPEN,"Can't open id-list: %s\n",opt_id_list);
-	opt_id_list = 0;
-	return 0;
+	opt_id_list = id_list_fname = 0;
+	return false;
+    }
+
+    char index_fname[PATH_MAX];
+    StringCat2S(index_fname,sizeof(index_fname),opt_id_list,".idx");
+    if ( opt_id_list_index && load_id_list_index(index_fname,&st) )
+    {
+	PRINT0("id-list: %u records from index loaded\n",id_list_used);
+	fclose(f);
+	return true;
     }
 
+    //--- scan text file, lines have format: "sha1|id..."
+
+    uint size = 0;
+    FREE(id_list);
+    id_list = 0;
+    id_list_used = 0;
+
     while (fgets(iobuf,sizeof(iobuf)-1,f))
     {
-	if (!memcmp(iobuf,search,41))
+	if ( iobuf[40] != '|' )
+	    continue;
+
+	// only lower case hex digits match a SHA1 created by this tool
+	uint i;
+	for ( i = 0; i < 40; i++ )
 	{
-	    prev_id = strtoul(iobuf+41,0,10);
-	    PRINT0("... found=%u\n",prev_id);
-	    break;
+	    const char ch = iobuf[i];
+	    if ( !( ch >= '0' && ch <= '9' || ch >= 'a' && ch <= 'f' ) )
+		break;
 	}
-    }
+	if ( i < 40 )
+	    continue;
 
+	if ( id_list_used == size )
+	{
+	    size = size * 5 / 4 + 1000;
+	    id_list = REALLOC( id_list, size * sizeof(*id_list) );
+	}
+
+	id_list_item_t *ptr = id_list + id_list_used;
+	Sha1Hex2Bin(ptr->sha1,iobuf,iobuf+40);
+	ptr->id  = strtoul(iobuf+41,0,10);
+	ptr->seq = id_list_used++;
+    }
     fclose(f);
-    return prev_id;
+
+    if (!id_list)
+	id_list = MALLOC(1);
+
+
+    //--- sort and remove duplicates, the first record of the file wins
+
+    qsort(id_list,id_list_used,sizeof(*id_list),sort_id_list);
+    if (id_list_used)
+    {
+	id_list_item_t *dest = id_list;
+	const id_list_item_t *src, *end = id_list + id_list_used;
+	for ( src = id_list + 1; src < end; src++ )
+	    if (memcmp(src->sha1,dest->sha1,sizeof(dest->sha1)))
+		*++dest = *src;
+	id_list_used = dest - id_list + 1;
+    }
+
+    PRINT0("id-list: %u records scanned\n",id_list_used);
+
+    // don't save the index, if the text was modified while scanning
+    struct stat st2;
+    if ( opt_id_list_index
+	&& !stat(opt_id_list,&st2)
+	&& st2.st_size == st.st_size
+	&& st2.st_mtime == st.st_mtime
+     #if HAVE_STATTIME_NSEC
+	&& st2.st_mtim.tv_nsec == st.st_mtim.tv_nsec
+     #endif
+	)
+    {
+	save_id_list_index(index_fname,&st);
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint GetCtIdByList ( sha1_hex_t sha1 )
+{
+    if ( strlen(sha1) != 40 || !opt_id_list || !load_id_list() )
+	return 0;
+
+    sha1_hash_t hash;
+    Sha1Hex2Bin(hash,sha1,sha1+40);
+
+    int beg = 0;
+    int end = (int)id_list_used - 1;
+    while ( beg <= end )
+    {
+	const int idx = (beg+end)/2;
+	int stat = memcmp(hash,id_list[idx].sha1,sizeof(sha1_hash_t));
+	if ( stat < 0 )
+	    end = idx - 1 ;
+	else if ( stat > 0 )
+	    beg = idx + 1;
+	else
+	    return id_list[idx].id;
+    }
+    return 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,10 @@
 #include <time.h>
 #include <dirent.h>
 #include <libgen.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/file.h>
 
 #include "crypt.h"
 #include "dclib-basics.h"
@@ -304,12 +308,15 @@ int IsSSChecksum ( sha1_size_hash_t *res, ccp source, int slen )
 ///////////////////////////////////////////////////////////////////////////////
 
 ccp		szs_cache_dir		= 0;
-ParamField_t	szs_cache		= {0};
-ParamField_t	szs_cache_append	= {0};
+ParamHash_t	szs_cache		= {0};
+ParamHash_t	szs_cache_append	= {0};
 
 static bool	szs_cache_loaded	= false;
 static bool	szs_cache_dirty		= false;
+static bool	szs_cache_record	= false;
+static ParamHash_t szs_cache_recorded	= {0};
 static u64	szs_cache_last_scan	= 0;
+static bool	szs_cache_rebuild	= false;
 //static u64	szs_cache_last_append	= 0;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -354,6 +361,613 @@ void LogCacheActivity ( ccp keyword, ccp format, ... )
     fflush(f);
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			SZS cache index			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// The binary index 'cache-content.idx' is mapped into memory and searched
+// by binary search, so that it must not be parsed at startup. It contains
+// a table of slots sorted by checksum, a pool with file names and finally
+// a list of appended records (the journal). New entries are appended as
+// single records by one write(); the file is only rewritten (compacted) if
+// the journal becomes too large. Rewriting is done by rename(), so other
+// processes see either the old or the new index.
+//
+// A removed entry is an item of 'szs_cache' with 'data==NULL'. It is
+// appended as record with an empty name (a tombstone) and it drops the
+// slot with the same key, when the index is rewritten.
+//
+// Multiple processes are synchronized by flock() on 'cache-content.lock'.
+// Appending processes hold a shared lock, so that they can work in
+// parallel. A rewrite holds an exclusive lock while it merges the current
+// index of the disk, its journal and the local modifications. Readers
+// never lock, because a mapped index is never modified in place.
+
+#define SZS_CACHE_INDEX_MAGIC	"SZS-IDX\n"
+#define SZS_CACHE_INDEX_VERSION	1
+#define SZS_CACHE_BYTE_ORDER	0x01020304
+#define SZS_CACHE_KEY_SIZE	40
+
+//-----------------------------------------------------------------------------
+// [[szs_cache_head_t]]
+
+typedef struct szs_cache_head_t
+{
+    char	magic[8];	// SZS_CACHE_INDEX_MAGIC
+    u32		version;	// SZS_CACHE_INDEX_VERSION
+    u32		byte_order;	// SZS_CACHE_BYTE_ORDER in native byte order
+    u32		n_slot;		// number of sorted slots
+    u32		slot_off;	// file offset of the slot table
+    u32		pool_off;	// file offset of the name pool
+    u32		pool_size;	// size of the name pool
+    u32		append_off;	// file offset of the first appended record
+    u32		reserved;	// always 0
+    u64		last_scan;	// time of last cache scan, 0 if unknown
+}
+szs_cache_head_t;
+
+//-----------------------------------------------------------------------------
+// [[szs_cache_slot_t]]
+
+typedef struct szs_cache_slot_t
+{
+    u64		mtime;			// mtime of the cached file in nsec
+    u32		size;			// size of the cached file
+    u32		name_off;		// offset of name relative to the pool
+    char	key[SZS_CACHE_KEY_SIZE]; // checksum + extension, NULL padded
+}
+szs_cache_slot_t;
+
+//-----------------------------------------------------------------------------
+// [[szs_cache_record_t]]
+
+typedef struct szs_cache_record_t
+{
+    u64		mtime;			// mtime of the cached file in nsec
+    u32		size;			// size of the cached file
+    u16		name_size;		// size of name including the NULL term
+    u16		rec_size;		// total size of this record, aligned to 8
+    char	key[SZS_CACHE_KEY_SIZE]; // checksum + extension, NULL padded
+    char	name[];			// file name, NULL terminated; empty: removed
+}
+szs_cache_record_t;
+
+//-----------------------------------------------------------------------------
+// [[szs_cache_map_t]]
+
+typedef struct szs_cache_map_t
+{
+    u8				*data;	// NULL or mapped index file
+    uint			size;	// size of mapped data
+    const szs_cache_head_t	*head;	// pointer to header
+    const szs_cache_slot_t	*slot;	// pointer to sorted slots
+    ccp				pool;	// pointer to name pool
+}
+szs_cache_map_t;
+
+static szs_cache_map_t szs_cache_map = {0};
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int LockSZSCache ( bool exclusive )
+{
+    // returns a file descriptor for UnlockSZSCache() or -1 on error
+
+    if (!szs_cache_dir)
+	return -1;
+
+    char path_buf[PATH_MAX];
+    ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,SZS_CACHE_LOCK);
+    const int fd = open(path,O_RDWR|O_CREAT,0666);
+    if ( fd < 0 )
+    {
+	LogCacheActivity("!LCK","Can't open lock file: %s",path);
+	return -1;
+    }
+
+    while (flock(fd,exclusive?LOCK_EX:LOCK_SH))
+	if ( errno != EINTR )
+	{
+	    LogCacheActivity("!LCK","Can't lock: %s",path);
+	    close(fd);
+	    return -1;
+	}
+
+    return fd;
+}
+
+//-----------------------------------------------------------------------------
+
+static void UnlockSZSCache ( int fd )
+{
+    if ( fd >= 0 )
+	close(fd); // releases the lock
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void UnmapSZSCacheIndex ( szs_cache_map_t *map )
+{
+    DASSERT(map);
+    if (map->data)
+	munmap(map->data,map->size);
+    memset(map,0,sizeof(*map));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool MapSZSCacheIndex ( szs_cache_map_t *map, ccp path )
+{
+    DASSERT(map);
+    DASSERT(path);
+    UnmapSZSCacheIndex(map);
+
+    const int fd = open(path,O_RDONLY);
+    if ( fd < 0 )
+	return false;
+
+    struct stat st;
+    if ( fstat(fd,&st) || st.st_size < sizeof(szs_cache_head_t) || st.st_size > 0x7fffffff )
+    {
+	close(fd);
+	return false;
+    }
+
+    void *data = mmap(0,st.st_size,PROT_READ,MAP_SHARED,fd,0);
+    close(fd);
+    if ( data == MAP_FAILED )
+	return false;
+
+    map->data = data;
+    map->size = st.st_size;
+
+    const szs_cache_head_t *head = data;
+    if (   memcmp(head->magic,SZS_CACHE_INDEX_MAGIC,sizeof(head->magic))
+	|| head->version != SZS_CACHE_INDEX_VERSION
+	|| head->byte_order != SZS_CACHE_BYTE_ORDER
+	|| head->slot_off < sizeof(*head)
+	|| head->slot_off + (u64)head->n_slot * sizeof(szs_cache_slot_t) > head->pool_off
+	|| head->pool_off + (u64)head->pool_size > head->append_off
+	|| head->append_off > map->size
+	|| head->pool_size && map->data[head->pool_off+head->pool_size-1] )
+    {
+	LogCacheActivity("!IDX","Invalid cache index: %s",path);
+	UnmapSZSCacheIndex(map);
+	return false;
+    }
+
+    map->head = head;
+    map->slot = (szs_cache_slot_t*)(map->data + head->slot_off);
+    map->pool = (ccp)map->data + head->pool_off;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static const szs_cache_slot_t * FindSZSCacheSlot
+(
+    const szs_cache_map_t	*map,	// valid map
+    ccp				key	// key to search
+)
+{
+    DASSERT(map);
+    DASSERT(key);
+    if (!map->head)
+	return 0;
+
+    int beg = 0, end = map->head->n_slot - 1;
+    while ( beg <= end )
+    {
+	const int idx = ( beg + end ) / 2;
+	const int stat = strncmp(key,map->slot[idx].key,SZS_CACHE_KEY_SIZE);
+	if ( stat < 0 )
+	    end = idx - 1;
+	else if ( stat > 0 )
+	    beg = idx + 1;
+	else
+	    return map->slot + idx;
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline ccp GetSZSCacheSlotName
+	( const szs_cache_map_t *map, const szs_cache_slot_t *slot )
+{
+    DASSERT(map);
+    DASSERT(slot);
+    return slot->name_off < map->head->pool_size ? map->pool + slot->name_off : "";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint LoadSZSCacheRecords ( const szs_cache_map_t *map, ParamHash_t *ph )
+{
+    // insert all appended records into 'pf', returns the number of records
+
+    DASSERT(map);
+    DASSERT(ph);
+    if (!map->head)
+	return 0;
+
+    uint count = 0;
+    const u8 *ptr = map->data + map->head->append_off;
+    const u8 *end = map->data + map->size;
+    while ( ptr + sizeof(szs_cache_record_t) <= end )
+    {
+	const szs_cache_record_t *rec = (szs_cache_record_t*)ptr;
+	if (  rec->rec_size < sizeof(*rec) + rec->name_size
+	   || ptr + rec->rec_size > end
+	   || !rec->name_size
+	   || rec->name[rec->name_size-1]
+	   || rec->key[SZS_CACHE_KEY_SIZE-1] )
+	{
+	    break; // incomplete or invalid
+	}
+	ptr += rec->rec_size;
+
+	bool found;
+	ParamFieldItem_t *it = FindInsertParamHash(ph,rec->key,false,0,&found);
+	if (found)
+	    FreeString(it->data);
+	it->data = *rec->name ? STRDUP(rec->name) : 0;
+	count++;
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static ParamFieldItem_t * FindInsertSZSCache ( ccp checksum, bool *found )
+{
+    // like FindInsertParamHash(&szs_cache,...), but the index is searched too
+
+    DASSERT(checksum);
+    DASSERT(found);
+
+    ParamFieldItem_t *it = FindInsertParamHash(&szs_cache,checksum,false,0,found);
+    if ( it && *found && !it->data )
+	*found = false; // removed entry, the slot of the index is hidden
+    else if ( it && !*found )
+    {
+	const szs_cache_slot_t *slot = FindSZSCacheSlot(&szs_cache_map,checksum);
+	if (slot)
+	{
+	    it->data = STRDUP(GetSZSCacheSlotName(&szs_cache_map,slot));
+	    *found = true;
+	}
+    }
+    return it;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static u64 GetSZSCacheMTime ( const struct stat *st )
+{
+    DASSERT(st);
+ #if HAVE_STATTIME_NSEC
+    return st->st_mtim.tv_sec * NSEC_PER_SEC + st->st_mtim.tv_nsec;
+ #else
+    return st->st_mtime * NSEC_PER_SEC;
+ #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void SetupSZSCacheSlot
+(
+    szs_cache_slot_t	*slot,		// slot to setup
+    ccp			key,		// key of the slot
+    ccp			name		// file name in cache directory
+)
+{
+    DASSERT(slot);
+    DASSERT(key);
+    DASSERT(name);
+
+    memset(slot,0,sizeof(*slot));
+    StringCopyS(slot->key,sizeof(slot->key),key);
+
+    char path_buf[PATH_MAX];
+    ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,name);
+    struct stat st;
+    if (!stat(path,&st))
+    {
+	slot->size  = st.st_size;
+	slot->mtime = GetSZSCacheMTime(&st);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void GetSZSCacheTempPath ( char *buf, uint bufsize, ccp path )
+{
+    // temp files start with a '.' => ignored by ScanSZSCache()
+
+    DASSERT(buf);
+    DASSERT(path);
+
+    ccp slash = strrchr(path,'/');
+    const int dir_len = slash ? slash - path + 1 : 0;
+    snprintf(buf,bufsize,"%.*s.%s.%u.tmp",dir_len,path,path+dir_len,getpid());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError WriteSZSCacheIndex
+(
+    ccp			path,		// path of index file
+    const szs_cache_map_t *map,		// valid map, maybe empty
+    const ParamField_t	*pf		// new entries, sorted, they replace entries of 'map'
+					// entries with 'data==NULL' remove them
+)
+{
+    // merge the mapped index and 'pf' and write a new index
+
+    DASSERT(path);
+    DASSERT(map);
+    DASSERT(pf);
+
+    const uint n_map = map->head ? map->head->n_slot : 0;
+    const uint max_slot = n_map + pf->used;
+
+    uint max_pool = map->head ? map->head->pool_size : 0;
+    for ( uint i = 0; i < pf->used; i++ )
+	if (pf->field[i].data)
+	    max_pool += strlen(pf->field[i].data) + 1;
+
+    szs_cache_slot_t *slot_list = CALLOC(max_slot+1,sizeof(*slot_list));
+    char *pool = MALLOC(max_pool+1);
+    uint n_slot = 0, pool_size = 0;
+
+    uint im = 0, ic = 0;
+    while ( im < n_map || ic < pf->used )
+    {
+	const ParamFieldItem_t *it = ic < pf->used ? pf->field + ic : 0;
+	if ( it && strlen(it->key) >= SZS_CACHE_KEY_SIZE )
+	{
+	    ic++;
+	    continue;
+	}
+
+	const szs_cache_slot_t *ms = im < n_map ? map->slot + im : 0;
+	const int stat = !it ? 1 : !ms ? -1 : strncmp(it->key,ms->key,SZS_CACHE_KEY_SIZE);
+
+	if ( stat <= 0 && !it->data )
+	{
+	    // removed entry => drop the slot of the index too
+	    ic++;
+	    if (!stat)
+		im++;
+	    continue;
+	}
+
+	ccp name;
+	szs_cache_slot_t *slot = slot_list + n_slot++;
+	if ( stat > 0 )
+	{
+	    // only in index
+	    name = GetSZSCacheSlotName(map,ms);
+	    *slot = *ms;
+	    im++;
+	}
+	else
+	{
+	    // new or modified entry
+	    name = it->data;
+	    SetupSZSCacheSlot(slot,it->key,name);
+	    ic++;
+	    if (!stat)
+		im++;
+	}
+
+	const uint len = strlen(name) + 1;
+	DASSERT( pool_size + len <= max_pool );
+	slot->name_off = pool_size;
+	memcpy(pool+pool_size,name,len);
+	pool_size += len;
+    }
+
+    szs_cache_head_t head;
+    memset(&head,0,sizeof(head));
+    memcpy(head.magic,SZS_CACHE_INDEX_MAGIC,sizeof(head.magic));
+    head.version	= SZS_CACHE_INDEX_VERSION;
+    head.byte_order	= SZS_CACHE_BYTE_ORDER;
+    head.n_slot		= n_slot;
+    head.slot_off	= sizeof(head);
+    head.pool_off	= head.slot_off + n_slot * sizeof(*slot_list);
+    head.pool_size	= pool_size;
+    head.append_off	= ALIGN32(head.pool_off + pool_size,8);
+    head.last_scan	= szs_cache_last_scan;
+
+    char temp_buf[PATH_MAX];
+    GetSZSCacheTempPath(temp_buf,sizeof(temp_buf),path);
+
+    File_t F;
+    enumError err = CreateFile(&F,true,temp_buf,FM_REMOVE);
+    if (!err)
+    {
+	static const u8 zero[8] = {0};
+	const uint fill = head.append_off - head.pool_off - pool_size;
+	if (   fwrite(&head,sizeof(head),1,F.f) != 1
+	    || n_slot && fwrite(slot_list,n_slot*sizeof(*slot_list),1,F.f) != 1
+	    || pool_size && fwrite(pool,pool_size,1,F.f) != 1
+	    || fill && fwrite(zero,fill,1,F.f) != 1 )
+	{
+	    err = ERROR1(ERR_WRITE_FAILED,"Writing cache index failed: %s\n",temp_buf);
+	}
+	CloseFile(&F,0);
+
+	if (err)
+	    unlink(temp_buf);
+	else if (rename(temp_buf,path))
+	{
+	    err = ERROR1(ERR_CANT_CREATE,"Can't rename cache index: %s\n",path);
+	    unlink(temp_buf);
+	}
+    }
+
+    FREE(slot_list);
+    FREE(pool);
+
+    if ( !err && opt_log_cache )
+	LogCacheActivity("SAVE","%u entries: %s",n_slot,path);
+    return err;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError CreateEmptySZSCacheIndex ( ccp path )
+{
+    // create an empty index atomically, if it not already exists
+
+    DASSERT(path);
+
+    szs_cache_head_t head;
+    memset(&head,0,sizeof(head));
+    memcpy(head.magic,SZS_CACHE_INDEX_MAGIC,sizeof(head.magic));
+    head.version	= SZS_CACHE_INDEX_VERSION;
+    head.byte_order	= SZS_CACHE_BYTE_ORDER;
+    head.slot_off	=
+    head.pool_off	=
+    head.append_off	= sizeof(head);
+
+    char temp_buf[PATH_MAX];
+    GetSZSCacheTempPath(temp_buf,sizeof(temp_buf),path);
+    const int fd = open(temp_buf,O_WRONLY|O_CREAT|O_TRUNC,0666);
+    if ( fd < 0 )
+	return ERROR1(ERR_CANT_CREATE,"Can't create cache index: %s\n",temp_buf);
+
+    enumError err = ERR_OK;
+    if ( write(fd,&head,sizeof(head)) != sizeof(head) )
+	err = ERROR1(ERR_WRITE_FAILED,"Writing cache index failed: %s\n",temp_buf);
+    close(fd);
+
+    // link() fails if another process was faster => that's ok
+    if ( !err && link(temp_buf,path) && errno != EEXIST )
+	err = ERROR1(ERR_CANT_CREATE,"Can't create cache index: %s\n",path);
+    unlink(temp_buf);
+    return err;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError AppendSZSCacheIndex
+(
+    ccp			path,		// path of index file
+    const ParamField_t	*pf,		// list with entries to append
+					// entries with 'data==NULL' are appended as tombstones
+    bool		modified_only	// true: append only items with 'num>0'
+)
+{
+    DASSERT(path);
+    DASSERT(pf);
+
+    const int fd = open(path,O_WRONLY|O_APPEND);
+    if ( fd < 0 )
+	return ERROR1(ERR_CANT_OPEN,"Can't open cache index: %s\n",path);
+
+    enumError err = ERR_OK;
+    uint count = 0;
+    for ( int i = 0; i < pf->used; i++ )
+    {
+	const ParamFieldItem_t *it = pf->field + i;
+	if ( modified_only && !it->num )
+	    continue;
+
+	ccp name = it->data ? (ccp)it->data : "";
+	const uint name_size = strlen(name) + 1;
+	if ( strlen(it->key) >= SZS_CACHE_KEY_SIZE || name_size > PATH_MAX )
+	    continue;
+
+	u8 buf[sizeof(szs_cache_record_t)+PATH_MAX+8];
+	szs_cache_record_t *rec = (szs_cache_record_t*)buf;
+	szs_cache_slot_t slot;
+	if (it->data)
+	    SetupSZSCacheSlot(&slot,it->key,name);
+	else
+	{
+	    memset(&slot,0,sizeof(slot));
+	    StringCopyS(slot.key,sizeof(slot.key),it->key);
+	}
+
+	rec->mtime	= slot.mtime;
+	rec->size	= slot.size;
+	rec->name_size	= name_size;
+	rec->rec_size	= ALIGN32(sizeof(*rec)+name_size,8);
+	memcpy(rec->key,slot.key,sizeof(rec->key));
+	memset(rec->name,0,rec->rec_size-sizeof(*rec));
+	memcpy(rec->name,name,name_size);
+
+	// a single write() per record => records of parallel processes don't mix
+	if ( write(fd,rec,rec->rec_size) != rec->rec_size )
+	{
+	    err = ERROR1(ERR_WRITE_FAILED,"Writing cache index failed: %s\n",path);
+	    break;
+	}
+	count++;
+    }
+    close(fd);
+
+    if ( count && opt_log_cache )
+	LogCacheActivity("APPD","%u entries: %s",count,path);
+    return err;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError RewriteSZSCacheIndex
+(
+    ccp			path,		// path of index file
+    bool		rebuild		// true: ignore the current index of the disk
+)
+{
+    // Rewrite the index with an exclusive lock. The current index of the
+    // disk and its journal are merged with the modified entries of
+    // 'szs_cache', so that modifications of other processes are not lost.
+
+    DASSERT(path);
+    const int lock_fd = LockSZSCache(true);
+
+    szs_cache_map_t disk;
+    memset(&disk,0,sizeof(disk));
+    ParamHash_t pending;
+    InitializeParamHash(&pending);
+    pending.pf.free_data = true;
+
+    if (!rebuild)
+    {
+	MapSZSCacheIndex(&disk,path);
+	LoadSZSCacheRecords(&disk,&pending);
+    }
+
+    for ( int i = 0; i < szs_cache.pf.used; i++ )
+    {
+	// removed entries (data==NULL) are copied too, to drop their slots
+	const ParamFieldItem_t *it = szs_cache.pf.field + i;
+	if ( it->data ? rebuild || it->num : !rebuild && it->num )
+	{
+	    bool found;
+	    ParamFieldItem_t *pit = FindInsertParamHash(&pending,it->key,false,0,&found);
+	    if (found)
+		FreeString(pit->data);
+	    pit->data = it->data ? STRDUP(it->data) : 0;
+	}
+    }
+
+    SortParamHash(&pending);
+    const enumError err = WriteSZSCacheIndex(path,&disk,&pending.pf);
+
+    ResetParamHash(&pending);
+    UnmapSZSCacheIndex(&disk);
+    UnlockSZSCache(lock_fd);
+    return err;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    SZS cache setup, load & save	///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 void SetupSZSCache ( ccp dir_name, bool use_dirname )
@@ -375,22 +989,59 @@ void SetupSZSCache ( ccp dir_name, bool use_dirname )
 
     FreeString(szs_cache_dir);
     szs_cache_dir = IsDirectory(dir_name,false) ? STRDUP(dir_name) : 0;
-    ResetParamField(&szs_cache);
-    szs_cache.free_data = true;
+    UnmapSZSCacheIndex(&szs_cache_map);
+    ResetParamHash(&szs_cache);
+    szs_cache.pf.free_data = true;
     szs_cache_loaded = false;
     PRINT("SZS_CACHE_DIR = %s\n",szs_cache_dir);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static const szs_cache_map_t *scan_map = 0;
+
+static int cmp_slot_name ( const void * va, const void * vb )
+{
+    DASSERT(va);
+    DASSERT(vb);
+    DASSERT(scan_map);
+    return strcmp( GetSZSCacheSlotName(scan_map,*(szs_cache_slot_t**)va),
+		   GetSZSCacheSlotName(scan_map,*(szs_cache_slot_t**)vb) );
+}
+
+//-----------------------------------------------------------------------------
+
 void ScanSZSCache ( ccp dir_name, bool purge )
 {
     SetupSZSCache(dir_name,false);
     if (!szs_cache_dir)
 	return;
-    szs_cache_loaded = szs_cache_dirty = true;
+    szs_cache_loaded = szs_cache_dirty = szs_cache_rebuild = true;
     szs_cache_last_scan = time(0);
 
+
+    //--- use the old index to avoid loading of unchanged files
+
+    szs_cache_map_t old;
+    memset(&old,0,sizeof(old));
+    UnmapSZSCacheIndex(&szs_cache_map);
+
+    char path_buf[PATH_MAX];
+    ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,SZS_CACHE_INDEX);
+    MapSZSCacheIndex(&old,path);
+
+    const uint n_old = old.head ? old.head->n_slot : 0;
+    const szs_cache_slot_t **by_name = CALLOC(n_old+1,sizeof(*by_name));
+    for ( uint i = 0; i < n_old; i++ )
+	by_name[i] = old.slot + i;
+    scan_map = &old;
+    if ( n_old > 1 )
+	qsort( by_name, n_old, sizeof(*by_name), cmp_slot_name );
+
+
+    //--- scan directory
+
+    uint n_reused = 0;
     DIR * dir = opendir(dir_name);
     if (dir)
     {
@@ -403,28 +1054,60 @@ void ScanSZSCache ( ccp dir_name, bool purge )
 	    if	( *dent->d_name != '.' )
 	    {
 		noPRINT("> %s\n",dent->d_name);
-		StoreSZSCache(dent->d_name,0,purge,0);
+
+		char key[SZS_CACHE_KEY_SIZE];
+		ccp checksum = 0;
+		struct stat st;
+		if ( n_old && !stat(PathCatPP(path_buf,sizeof(path_buf),
+					szs_cache_dir,dent->d_name),&st) )
+		{
+		    int beg = 0, end = n_old - 1;
+		    while ( beg <= end )
+		    {
+			const int idx = ( beg + end ) / 2;
+			const szs_cache_slot_t *slot = by_name[idx];
+			const int stat = strcmp(dent->d_name,GetSZSCacheSlotName(&old,slot));
+			if ( stat < 0 )
+			    end = idx - 1;
+			else if ( stat > 0 )
+			    beg = idx + 1;
+			else
+			{
+			    if ( slot->size == st.st_size && slot->mtime == GetSZSCacheMTime(&st) )
+			    {
+				StringCopyS(key,sizeof(key),slot->key);
+				checksum = key;
+				n_reused++;
+			    }
+			    break;
+			}
+		    }
+		}
+		StoreSZSCache(dent->d_name,checksum,purge,0);
 	    }
 	}
 	closedir(dir);
     }
+
+    if (opt_log_cache)
+	LogCacheActivity("SCAN","%u entries, %u reused: %s",
+		szs_cache.pf.used, n_reused, szs_cache_dir );
+
+    scan_map = 0;
+    FREE(by_name);
+    UnmapSZSCacheIndex(&old);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-enumError LoadSZSCache(void)
+static enumError LoadSZSCacheText ( ccp path, u_nsec_t start_time )
 {
-    if ( szs_cache_loaded || !szs_cache_dir )
-	return ERR_OK;
-    szs_cache_loaded = true;
-    szs_cache_last_scan = 0;
+    // load the text format of older versions
 
-    const u_nsec_t start_time = GetTimerNSec();
-
-    char fbuf[PATH_MAX], buf[PATH_MAX];
-    ccp path = PathCatPP(fbuf,sizeof(fbuf),szs_cache_dir,SZS_CACHE_FNAME);
-    PRINT0("LoadSZSCache() %s\n",path);
+    DASSERT(path);
+    PRINT0("LoadSZSCacheText() %s\n",path);
 
+    char buf[PATH_MAX];
     File_t F;
     enumError err = OpenFile(&F,true,path,FM_SILENT,0,0);
     if (err)
@@ -505,26 +1188,54 @@ enumError LoadSZSCache(void)
     CloseFile(&F,0);
     if (opt_log_cache)
 	LogCacheActivity("LOAD","%u entries in %s: %s",
-		szs_cache.used,
+		szs_cache.pf.used,
 		PrintTimerNSec6(0,0,GetTimerNSec()-start_time,0),
 		path );
 
     parallel_count = saved_parallel_count;
 
+    // the index will be created by SaveSZSCache()
+    szs_cache_dirty = szs_cache.pf.used > 0;
+    return ERR_OK;
+}
+
+//-----------------------------------------------------------------------------
+
+enumError LoadSZSCache(void)
+{
+    if ( szs_cache_loaded || !szs_cache_dir )
+	return ERR_OK;
+    szs_cache_loaded = true;
+    szs_cache_last_scan = 0;
+
+    const u_nsec_t start_time = GetTimerNSec();
+
+    char fbuf[PATH_MAX];
+    ccp path = PathCatPP(fbuf,sizeof(fbuf),szs_cache_dir,SZS_CACHE_INDEX);
+    PRINT0("LoadSZSCache() %s\n",path);
+
+    if (!MapSZSCacheIndex(&szs_cache_map,path))
+    {
+	path = PathCatPP(fbuf,sizeof(fbuf),szs_cache_dir,SZS_CACHE_FNAME);
+	return LoadSZSCacheText(path,start_time);
+    }
+
+    szs_cache_last_scan = szs_cache_map.head->last_scan;
+    const uint n_rec = LoadSZSCacheRecords(&szs_cache_map,&szs_cache);
+    if (opt_log_cache)
+	LogCacheActivity("LOAD","%u+%u entries in %s: %s",
+		szs_cache_map.head->n_slot, n_rec,
+		PrintTimerNSec6(0,0,GetTimerNSec()-start_time,0),
+		path );
     return ERR_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static int cmp_szs_cache ( const void * va, const void * vb )
+static void ClearModifiedSZSCache(void)
 {
-    DASSERT(va);
-    DASSERT(vb);
-    const ParamFieldItem_t *a = *(ParamFieldItem_t**)va;
-    const ParamFieldItem_t *b = *(ParamFieldItem_t**)vb;
-    DASSERT(a);
-    DASSERT(b);
-    return strcasecmp((ccp)a->data,(ccp)b->data);
+    for ( int i = 0; i < szs_cache.pf.used; i++ )
+	szs_cache.pf.field[i].num = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -539,93 +1250,159 @@ enumError SaveSZSCache ( bool force )
     szs_cache_dirty = false;
 
     char path_buf[PATH_MAX];
-    ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,SZS_CACHE_FNAME);
-    PRINT("SaveSZSCache() N=%u, %s\n",szs_cache.used,path);
+    ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,SZS_CACHE_INDEX);
+    PRINT("SaveSZSCache() N=%u, %s\n",szs_cache.pf.used,path);
 
-    File_t F;
-    enumError err = CreateFile(&F,true,path,FM_REMOVE);
-    if (err)
-	return err;
 
-    char tbuf[50];
-    if (szs_cache_last_scan)
+    //--- append only, if the appended records are small compared to the index
+
+    const szs_cache_head_t *head = szs_cache_map.head;
+    if ( !force && head )
     {
-	time_t tim = szs_cache_last_scan;
-	struct tm *tm = localtime(&tim);
-	strftime(tbuf,sizeof(tbuf),"%F %T %z",tm);
+	uint append_size = szs_cache_map.size - head->append_off;
+	for ( int i = 0; i < szs_cache.pf.used; i++ )
+	{
+	    const ParamFieldItem_t *it = szs_cache.pf.field + i;
+	    if (it->num)
+		append_size += sizeof(szs_cache_record_t)
+			     + ( it->data ? strlen(it->data) : 0 ) + 8;
+	}
+
+	if ( append_size <= head->n_slot * sizeof(szs_cache_slot_t) / 4 )
+	{
+	    const int lock_fd = LockSZSCache(false);
+	    const enumError err = AppendSZSCacheIndex(path,&szs_cache.pf,true);
+	    UnlockSZSCache(lock_fd);
+	    if (!err)
+		ClearModifiedSZSCache();
+	    return err;
+	}
     }
-    else
-	StringCopyS(tbuf,sizeof(tbuf),"-");
 
-    fprintf(F.f,"#SZS-CACHE\n"
-		"# %u file%s cached\n"
-		"\n"
-		"@WSZST-VERSION   = %s\n"
-		"@WSZST-REVISION  = %u\n"
-		"@LAST-CACHE-SCAN = %llu = %s\n"
-		"\n"
-		,szs_cache.used ,szs_cache.used==1 ? "" : "s"
-		,VERSION
-		,REVISION_NUM
-		,szs_cache_last_scan,tbuf
-		);
 
-    if ( szs_cache.used )
+    //--- rewrite (compact) the index
+
+    const enumError err = RewriteSZSCacheIndex(path,szs_cache_rebuild);
+    if (!err)
     {
-	ParamFieldItem_t **list = CALLOC(szs_cache.used,sizeof(*list));
+	ClearModifiedSZSCache();
+	szs_cache_rebuild = false;
+	MapSZSCacheIndex(&szs_cache_map,path);
+    }
+    return err;
+}
 
-	uint i;
-	for ( i = 0; i < szs_cache.used; i++ )
-	    list[i] = szs_cache.field+i;
+//-----------------------------------------------------------------------------
 
-	if ( szs_cache.used > 1 )
-	    qsort( list, szs_cache.used, sizeof(*list), cmp_szs_cache );
+enumError AppendSZSCache()
+{
+    if ( !szs_cache_dir || !szs_cache_append.pf.used)
+	return ERR_NOTHING_TO_DO;
 
-	for ( i = 0; i < szs_cache.used; i++ )
-	{
-	    const ParamFieldItem_t *it = list[i];
-	    fprintf(F.f,"%s %s\n",it->key,(ccp)it->data);
-	}
+    char path_buf[PATH_MAX];
+    ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,SZS_CACHE_INDEX);
+    PRINT("AppendSZSCache() N=%u, %s\n",szs_cache_append.pf.used,path);
+
+    const int lock_fd = LockSZSCache(false);
+    enumError err = access(path,F_OK) ? CreateEmptySZSCacheIndex(path) : ERR_OK;
+    if (!err)
+	err = AppendSZSCacheIndex(path,&szs_cache_append.pf,false);
+    UnlockSZSCache(lock_fd);
+    return err;
+}
 
-	FREE(list);
-    }
+///////////////////////////////////////////////////////////////////////////////
 
-    CloseFile(&F,0);
-    return ERR_OK;
+static int cmp_szs_cache ( const void * va, const void * vb )
+{
+    DASSERT(va);
+    DASSERT(vb);
+    const ParamFieldItem_t *a = (ParamFieldItem_t*)va;
+    const ParamFieldItem_t *b = (ParamFieldItem_t*)vb;
+    DASSERT(a);
+    DASSERT(b);
+    return strcasecmp((ccp)a->data,(ccp)b->data);
 }
 
 //-----------------------------------------------------------------------------
 
-enumError AppendSZSCache()
+enumError SaveSZSCacheText(void)
 {
-    if ( !szs_cache_dir || !szs_cache_append.used)
+    // export all entries of the index and 'szs_cache' as text file
+
+    if (!szs_cache_dir)
 	return ERR_NOTHING_TO_DO;
 
     char path_buf[PATH_MAX];
     ccp path = PathCatPP(path_buf,sizeof(path_buf),szs_cache_dir,SZS_CACHE_FNAME);
-    PRINT("AppendSZSCache() N=%u, %s\n",szs_cache.used,path);
+
+
+    //--- collect entries
+
+    const szs_cache_map_t *map = &szs_cache_map;
+    const uint n_map = map->head ? map->head->n_slot : 0;
+    ParamFieldItem_t *list = CALLOC(n_map+szs_cache.pf.used+1,sizeof(*list));
+    uint n = 0;
+
+    for ( uint i = 0; i < n_map; i++ )
+    {
+	const szs_cache_slot_t *slot = map->slot + i;
+	if (!FindParamHash(&szs_cache,slot->key))
+	{
+	    list[n].key  = slot->key;
+	    list[n].data = (void*)GetSZSCacheSlotName(map,slot);
+	    n++;
+	}
+    }
+
+    for ( int i = 0; i < szs_cache.pf.used; i++ )
+	if (szs_cache.pf.field[i].data)
+	    list[n++] = szs_cache.pf.field[i];
+
+    if ( n > 1 )
+	qsort( list, n, sizeof(*list), cmp_szs_cache );
+
+    PRINT("SaveSZSCacheText() N=%u, %s\n",n,path);
+
+
+    //--- write text file
 
     File_t F;
-    enumError err = CreateFile(&F,true,path,FM_APPEND);
+    enumError err = CreateFile(&F,true,path,FM_REMOVE);
     if (err)
+    {
+	FREE(list);
 	return err;
+    }
 
-    time_t tim = time(0);
-    if ( tim >= F.st.st_mtime + 10 )
+    char tbuf[50];
+    if (szs_cache_last_scan)
     {
-	char tbuf[50];
+	time_t tim = szs_cache_last_scan;
 	struct tm *tm = localtime(&tim);
 	strftime(tbuf,sizeof(tbuf),"%F %T %z",tm);
-	fprintf(F.f,"\n@APPEND = %s\n",tbuf);
     }
+    else
+	StringCopyS(tbuf,sizeof(tbuf),"-");
 
-    for ( int i = 0; i < szs_cache_append.used; i++ )
-    {
-	const ParamFieldItem_t *it = szs_cache_append.field+i;
-	fprintf(F.f,"%s %s\n",it->key,(ccp)it->data);
-    }
+    fprintf(F.f,"#SZS-CACHE\n"
+		"# %u file%s cached\n"
+		"\n"
+		"@WSZST-VERSION   = %s\n"
+		"@WSZST-REVISION  = %u\n"
+		"@LAST-CACHE-SCAN = %llu = %s\n"
+		"\n"
+		,n ,n==1 ? "" : "s"
+		,VERSION
+		,REVISION_NUM
+		,szs_cache_last_scan,tbuf
+		);
+
+    for ( uint i = 0; i < n; i++ )
+	fprintf(F.f,"%s %s\n",list[i].key,(ccp)list[i].data);
 
     CloseFile(&F,0);
+    FREE(list);
     return ERR_OK;
 }
 
@@ -686,10 +1463,10 @@ ParamFieldItem_t * StoreSZSCache
     }
 
     bool found;
-    ParamFieldItem_t *it = FindInsertParamField(&szs_cache,checksum,false,0,&found);
+    ParamFieldItem_t *it = FindInsertSZSCache(checksum,&found);
     if ( !found && parallel_count > 0 )
-	it = FindInsertParamField(&szs_cache_append,checksum,false,0,&found);
-    PRINT0("N=%d, found[%s]=%d\n",szs_cache.used,checksum,found);
+	it = FindInsertParamHash(&szs_cache_append,checksum,false,0,&found);
+    PRINT0("N=%d, found[%s]=%d\n",szs_cache.pf.used,checksum,found);
 
     if (found)
     {
@@ -718,13 +1495,92 @@ ParamFieldItem_t * StoreSZSCache
 
     if (it)
     {
+	// fname==NULL removes the entry, see WriteSZSCacheIndex()
 	PRINT("USE: %s\n",fname);
-	it->data = STRDUP(fname);
+	it->data = fname ? STRDUP(fname) : 0;
+	it->num  = 1; // modified
+
+	if ( szs_cache_record && fname )
+	{
+	    ParamFieldItem_t *rec
+		= FindInsertParamHash(&szs_cache_recorded,it->key,false,0,&found);
+	    if (found)
+		FreeString(rec->data);
+	    rec->data = STRDUP(fname);
+	}
     }
     szs_cache_dirty = true;
     return it;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+void RecordSZSCache ( bool enable )
+{
+    szs_cache_record = enable;
+    ResetParamHash(&szs_cache_recorded);
+    szs_cache_recorded.pf.free_data = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+enumError ExportSZSCache ( FILE *f )
+{
+    DASSERT(f);
+
+    for ( int i = 0; i < szs_cache_recorded.pf.used; i++ )
+    {
+	const ParamFieldItem_t *it = szs_cache_recorded.pf.field+i;
+	fprintf(f,"%s %s\n",it->key,(ccp)it->data);
+    }
+
+    return fflush(f) ? ERR_WRITE_FAILED : ERR_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint ImportSZSCache ( FILE *f )
+{
+    // returns the number of imported entries
+
+    DASSERT(f);
+    if (!szs_cache_dir)
+	return 0;
+    if (!szs_cache_loaded)
+	LoadSZSCache();
+
+    uint count = 0;
+    char buf[PATH_MAX+CHECKSUM_DB_SIZE+10];
+    while (fgets(buf,sizeof(buf),f))
+    {
+	char *fname = strchr(buf,' ');
+	if (!fname)
+	    continue;
+	*fname++ = 0;
+
+	char *end = fname + strlen(fname);
+	while ( end > fname && (uchar)end[-1] <= ' ' )
+	    end--;
+	*end = 0;
+	if (!*fname)
+	    continue;
+
+	bool found;
+	ParamHash_t *ph = parallel_count > 0 ? &szs_cache_append : &szs_cache;
+	ParamFieldItem_t *it = FindInsertParamHash(ph,buf,false,0,&found);
+	if (found)
+	    FreeString(it->data);
+	it->data = STRDUP(fname);
+	it->num  = 1; // modified
+	szs_cache_dirty = true;
+	count++;
+    }
+
+    if ( count && opt_log_cache )
+	LogCacheActivity("MERGE","%u entries of a worker",count);
+    return count;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
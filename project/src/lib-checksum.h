@@ -84,9 +84,11 @@ int IsSSChecksum ( sha1_size_hash_t *res, ccp source, int slen );
 ///////////////////////////////////////////////////////////////////////////////
 
 #define SZS_CACHE_FNAME "cache-content.txt"
+#define SZS_CACHE_INDEX "cache-content.idx"
+#define SZS_CACHE_LOCK  "cache-content.lock"
 
 extern ccp		szs_cache_dir;
-extern ParamField_t	szs_cache;
+extern ParamHash_t	szs_cache;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -101,6 +103,7 @@ void SetupSZSCache ( ccp dir_name, bool use_dirname );
 void ScanSZSCache ( ccp dir_name, bool purge );
 enumError LoadSZSCache(void);
 enumError SaveSZSCache ( bool force );
+enumError SaveSZSCacheText(void);
 enumError AppendSZSCache(void);
 
 ParamFieldItem_t * StoreSZSCache
@@ -114,6 +117,15 @@ ParamFieldItem_t * StoreSZSCache
 				//	=> true: file result->data exists
 );
 
+// Support for forked workers, see ExecParallelJobs():
+// A worker records all new and renamed cache entries and exports them
+// to a file. The parent imports the files, so that only the parent
+// updates the cache index.
+
+void RecordSZSCache ( bool enable );
+enumError ExportSZSCache ( FILE *f );
+uint ImportSZSCache ( FILE *f );
+
 //-----------------------------------------------------------------------------
 // [[check_cache_t]]
 
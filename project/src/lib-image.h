@@ -920,6 +920,21 @@ enumError HalfIMG
     Image_t		* img		// source and dest
 );
 
+//-----------------------------------------------------------------------------
+
+enumError FilterResizeIMG
+(
+    Image_t		* dest,		// dest image (may be same as src)
+    bool		init_dest,	// true: initialize 'dest' first
+    const Image_t	* src,		// source image (if NULL: use dest)
+    uint		width,		// new width of image
+    uint		height,		// new height of image
+					// if one of 'width' or 'height' is NULL
+					//	-> keep aspect ratio
+    mipmap_filter_t	filter		// MMF_BILINEAR or MMF_LANCZOS,
+					// all others => use ResizeIMG()
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			CMPR interface			///////////////
@@ -968,6 +983,14 @@ void CMPR_wiimm
     cmpr_info_t		*info		// info data structure
 );
 
+void CMPR_cluster
+(
+    // slower, but better results than CMPR_wiimm()
+
+    const u8		*data,		// source data
+    cmpr_info_t		*info		// info data structure
+);
+
 //-----------------------------------------------------------------------------
 
 void CMPR_close_info
@@ -1031,7 +1054,7 @@ int PrintImage
 
 //
 ///////////////////////////////////////////////////////////////////////////////
-///////////////			median cut			///////////////
+///////////////		median cut + k-means		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 uint MedianCut
@@ -1055,6 +1078,31 @@ uint MedianCut
     // return value = number of calculated palette values
 );
 
+//-----------------------------------------------------------------------------
+
+uint KMeansPalette
+(
+    const u32		* data,		// input: 4-tuple aka RGBA
+					// data is read at the very beginning
+					// and may overlay with 'index' and/or 'pal'
+    u16			* index,	// not NULL: store index into palette,
+					//           can be the space as 'data'
+
+    // The follwing 3 parameters are used for 'data' and 'index'.
+    // They allow to skip unused pixel at the end or each row.
+    uint		width,		// used pixels per row
+    uint		xwidth,		// >width: pixels per row
+    uint		height,		// number or rows
+
+    // pallette data
+    u32			* pal,		// not NULL: store calculated palette
+    uint		pal_elem,	// number of wanted palette entries
+
+    uint		n_threads	// >1: use threads for large images
+
+    // return value = number of calculated palette values
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    TPL support			///////////////
@@ -39,6 +39,8 @@
 #include "lib-image.h"
 #include "lib-breff.h"
 
+#include <pthread.h>
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			IMG management			///////////////
@@ -1312,7 +1314,11 @@ enumError ConvertToPALETTE
 
     u16 *index = (u16*)AllocDataIMG(src_img,2,0);
     u8  *pal_data = CALLOC(max_pal,4);
-    uint n_pal = MedianCut( (u32*)src_img->data, index,
+    uint n_pal = opt_pal_quant == PAL_QUANT_KMEANS
+		? KMeansPalette( (u32*)src_img->data, index,
+				src_img->width, src_img->xwidth, src_img->height,
+				(u32*)pal_data, max_pal, opt_pal_threads )
+		: MedianCut( (u32*)src_img->data, index,
 				src_img->width, src_img->xwidth, src_img->height,
 				(u32*)pal_data, max_pal );
 
@@ -3549,6 +3555,125 @@ void CMPR_close_info
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+// The pair search of CMPR_wiimm() uses vector extensions of GCC (see
+// SIMD_CLONES). The 16 pixels of a block are the 16 lanes of a vector of
+// 16-bit integers.
+
+typedef s16 cmpr_vec_t __attribute__ ((vector_size(CMPR_MAX_COL*sizeof(s16))));
+
+//-----------------------------------------------------------------------------
+
+typedef struct cmpr_sum_t
+{
+    u8   col[4];
+    uint count;
+}
+cmpr_sum_t;
+
+//-----------------------------------------------------------------------------
+
+// absolute value and minimum of each lane
+
+#define CMPR_ABS(a) \
+	( ( (a) ^ (a) >> 15 ) - ( (a) >> 15 ) )
+
+#define CMPR_MIN(a,b) \
+	( (a) & ( (a) < (b) ) | (b) & ~( (a) < (b) ) )
+
+// like calc_distance() for all lanes
+
+#define CMPR_DISTANCE(plane,pal) \
+	( CMPR_ABS( plane[0] - (s16)pal[0] ) \
+	+ CMPR_ABS( plane[1] - (s16)pal[1] ) \
+	+ CMPR_ABS( plane[2] - (s16)pal[2] ) )
+
+//-----------------------------------------------------------------------------
+
+static SIMD_CLONES void cmpr_find_pair
+(
+    const u8		*data,		// source data
+    const cmpr_sum_t	*sum,		// list with different colors
+    uint		n_sum,		// number of elements of 'sum'
+    bool		transparent,	// true: block has transparent pixels
+    uint		*r_best0,	// store index of first color here
+    uint		*r_best1	// store index of second color here
+)
+{
+    // Find the pair of colors with the smallest distance sum. The distance
+    // of a pixel is the minimum of its distances to the palette colors,
+    // transparent pixels don't count. The first best pair wins.
+
+    cmpr_vec_t plane[3], mask;
+    uint i;
+    for ( i = 0; i < CMPR_MAX_COL; i++, data += 4 )
+    {
+	plane[0][i] = data[0];
+	plane[1][i] = data[1];
+	plane[2][i] = data[2];
+	mask[i]     = data[3] & 0x80 ? -1 : 0;
+    }
+
+    uint best0 = 0, best1 = 0, max_dist = UINT_MAX;
+    uint s0;
+    for ( s0 = 0; s0 < n_sum; s0++ )
+    {
+	const u8 *pal0 = sum[s0].col;
+	const cmpr_vec_t dist0 = CMPR_DISTANCE(plane,pal0);
+
+	uint s1;
+	for ( s1 = s0+1; s1 < n_sum; s1++ )
+	{
+	    const u8 *pal1 = sum[s1].col;
+	    const cmpr_vec_t dist1 = CMPR_DISTANCE(plane,pal1);
+	    cmpr_vec_t dmin = CMPR_MIN(dist0,dist1);
+
+	    u8 pal2[3];
+	    if (transparent)
+	    {
+		// we have transparent points -> 1 middle point
+
+		pal2[0] = ( pal0[0] + pal1[0] ) / 2;
+		pal2[1] = ( pal0[1] + pal1[1] ) / 2;
+		pal2[2] = ( pal0[2] + pal1[2] ) / 2;
+		const cmpr_vec_t dist2 = CMPR_DISTANCE(plane,pal2);
+		dmin = CMPR_MIN(dmin,dist2) & mask;
+	    }
+	    else
+	    {
+		// no transparent points -> 2 middle point
+
+		pal2[0] = ( 2 * pal0[0] + pal1[0] ) / 3;
+		pal2[1] = ( 2 * pal0[1] + pal1[1] ) / 3;
+		pal2[2] = ( 2 * pal0[2] + pal1[2] ) / 3;
+		u8 pal3[3];
+		pal3[0] = ( pal0[0] + 2 * pal1[0] ) / 3;
+		pal3[1] = ( pal0[1] + 2 * pal1[1] ) / 3;
+		pal3[2] = ( pal0[2] + 2 * pal1[2] ) / 3;
+		const cmpr_vec_t dist2 = CMPR_DISTANCE(plane,pal2);
+		dmin = CMPR_MIN(dmin,dist2);
+		const cmpr_vec_t dist3 = CMPR_DISTANCE(plane,pal3);
+		dmin = CMPR_MIN(dmin,dist3);
+	    }
+
+	    uint dist = 0;
+	    for ( i = 0; i < CMPR_MAX_COL; i++ )
+		dist += dmin[i];
+
+	    if ( max_dist > dist )
+	    {
+		max_dist = dist;
+		best0 = s0;
+		best1 = s1;
+	    }
+	}
+    }
+
+    *r_best0 = best0;
+    *r_best1 = best1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void CMPR_wiimm
 (
     const u8		*data,		// source data
@@ -3559,13 +3684,7 @@ void CMPR_wiimm
     InitializeCmprInfo(info);
     info->name = "Wiimm";
 
-    typedef struct sum_t
-    {
-	u8   col[4];
-	uint count;
-    } sum_t;
-
-    sum_t sum[CMPR_MAX_COL];
+    cmpr_sum_t sum[CMPR_MAX_COL];
     uint n_sum = 0, opaque_count = 0;
     uint col[3] = {0,0,0};
 
@@ -3630,159 +3749,291 @@ void CMPR_wiimm
     DASSERT( opaque_count >= 3 );
     //HEXDUMP16(0,0,sum,sizeof(sum));
 
-    uint best0 = 0, best1 = 0, max_dist = UINT_MAX;
-    if ( info->opaque_count < CMPR_MAX_COL )
+    uint best0, best1;
+    cmpr_find_pair(data,sum,n_sum,opaque_count<CMPR_MAX_COL,&best0,&best1);
+    memcpy(info->p[0],sum[best0].col,4);
+    memcpy(info->p[1],sum[best1].col,4);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint cmpr_block_distance
+(
+    // return the distance sum of the opaque pixels of an encoded block
+    // decoded like conv_from_CMPR()
+
+    const u8		*data,		// source data
+    const u8		*cmpr		// encoded block, 8 bytes
+)
+{
+    u8 pal[4][3];
+    const u16 p0 = be16(cmpr);
+    const u16 p1 = be16(cmpr+2);
+    pal[0][0] = cc58[ p0 >> 11 ];
+    pal[0][1] = cc68[ p0 >>  5 & 0x3f ];
+    pal[0][2] = cc58[ p0       & 0x1f ];
+    pal[1][0] = cc58[ p1 >> 11 ];
+    pal[1][1] = cc68[ p1 >>  5 & 0x3f ];
+    pal[1][2] = cc58[ p1       & 0x1f ];
+
+    uint c;
+    for ( c = 0; c < 3; c++ )
+	if ( p0 > p1 )
+	{
+	    pal[2][c] = ( 2 * pal[0][c] + pal[1][c] ) / 3;
+	    pal[3][c] = ( pal[0][c] + 2 * pal[1][c] ) / 3;
+	}
+	else
+	    pal[2][c] = pal[3][c] = ( pal[0][c] + pal[1][c] ) / 2;
+
+    uint i, dist = 0;
+    for ( i = 0; i < CMPR_MAX_COL; i++, data += 4 )
+	if ( data[3] & 0x80 )
+	    dist += calc_distance(data,pal[ cmpr[4+i/4] >> 2*(3-i%4) & 3 ]);
+    return dist;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void cmpr_fit_eval
+(
+    // solve the least squares problem for one clustering
+
+    double		a2,		// sum of alpha^2
+    double		b2,		// sum of beta^2
+    double		ab,		// sum of alpha*beta
+    const double	*ax,		// 3 sums of alpha*color
+    const double	*bx,		// 3 sums of beta*color
+    double		*best_err,	// smallest error so far, update it
+    double		best[2][3]	// best end points so far, update it
+)
+{
+    const double det = a2 * b2 - ab * ab;
+    if ( det < 1e-6 )
+	return;
+
+    double a[3], b[3], err = 0.0;
+    uint c;
+    for ( c = 0; c < 3; c++ )
+    {
+	a[c] = ( ax[c] * b2 - bx[c] * ab ) / det;
+	b[c] = ( bx[c] * a2 - ax[c] * ab ) / det;
+	a[c] = a[c] < 0.0 ? 0.0 : a[c] > 255.0 ? 255.0 : a[c];
+	b[c] = b[c] < 0.0 ? 0.0 : b[c] > 255.0 ? 255.0 : b[c];
+
+	// error without the constant sum of color^2
+	err += a[c] * a[c] * a2 + b[c] * b[c] * b2
+	     + 2.0 * ( a[c] * b[c] * ab - a[c] * ax[c] - b[c] * bx[c] );
+    }
+
+    if ( *best_err > err )
     {
-	// we have transparent points -> 1 middle point
+	*best_err = err;
+	memcpy(best[0],a,sizeof(a));
+	memcpy(best[1],b,sizeof(b));
+    }
+}
 
-	uint s0;
-	for ( s0 = 0; s0 < n_sum; s0++ )
+//-----------------------------------------------------------------------------
+
+void CMPR_cluster
+(
+    const u8		*data,		// source data
+    cmpr_info_t		*info		// info data structure
+)
+{
+    // Start with CMPR_wiimm(). Then sort the opaque pixels along the
+    // principal axis and calculate the best end points for each split into
+    // 3 (transparent pixels) or 4 clusters by least squares. The result is
+    // used if its distance sum is smaller than the one of CMPR_wiimm().
+
+    DASSERT(info);
+    CMPR_wiimm(data,info);
+    info->name = "Cluster";
+    if ( info->opaque_count < 3 )
+	return;
+
+
+    //--- collect opaque pixels
+
+    double pt[CMPR_MAX_COL][3], mean[3] = {0,0,0};
+    uint i, c, n = 0;
+    const u8 *dat = data;
+    for ( i = 0; i < CMPR_MAX_COL; i++, dat += 4 )
+	if ( dat[3] & 0x80 )
 	{
-	    u8 *pal0 = sum[s0].col;
-	    uint s1;
-	    for ( s1 = s0+1; s1 < n_sum; s1++ )
-	    {
-		u8 *pal1 = sum[s1].col;
-		u8 pal2[4];
-		pal2[0] = ( pal0[0] + pal1[0] ) / 2;
-		pal2[1] = ( pal0[1] + pal1[1] ) / 2;
-		pal2[2] = ( pal0[2] + pal1[2] ) / 2;
+	    for ( c = 0; c < 3; c++ )
+		mean[c] += pt[n][c] = dat[c];
+	    n++;
+	}
+    DASSERT( n == info->opaque_count );
+    for ( c = 0; c < 3; c++ )
+	mean[c] /= n;
 
-		uint dist = 0;
-		const u8 * dat;
-		for ( dat = data; dat < data_end && dist < max_dist; dat += 4 )
-		{
-		    if ( dat[3] & 0x80 )
-		    {
-			const uint d0 = calc_distance(dat,pal0);
-			const uint d1 = calc_distance(dat,pal1);
-			const uint d2 = calc_distance(dat,pal2);
-			if ( d0 <= d1 )
-			    dist += d0 < d2 ? d0 : d2;
-			else
-			    dist += d1 < d2 ? d1 : d2;
-		    }
-		}
-		if ( max_dist > dist )
+
+    //--- principal axis by power iteration of the covariance matrix
+
+    double cov[3][3] = {{0}};
+    for ( i = 0; i < n; i++ )
+    {
+	const double d[3] = { pt[i][0]-mean[0], pt[i][1]-mean[1], pt[i][2]-mean[2] };
+	uint c2;
+	for ( c = 0; c < 3; c++ )
+	    for ( c2 = 0; c2 < 3; c2++ )
+		cov[c][c2] += d[c] * d[c2];
+    }
+
+    double axis[3] = {1,1,1};
+    uint iter;
+    for ( iter = 0; iter < 8; iter++ )
+    {
+	double v[3], max = 0.0;
+	for ( c = 0; c < 3; c++ )
+	{
+	    v[c] = cov[c][0] * axis[0] + cov[c][1] * axis[1] + cov[c][2] * axis[2];
+	    if ( max < fabs(v[c]) )
+		max = fabs(v[c]);
+	}
+	if ( max < 1e-9 )
+	    return; // all pixels have the same color
+	for ( c = 0; c < 3; c++ )
+	    axis[c] = v[c] / max;
+    }
+
+
+    //--- sort pixels by their projection onto the axis (insertion sort)
+
+    uint order[CMPR_MAX_COL];
+    double proj[CMPR_MAX_COL];
+    for ( i = 0; i < n; i++ )
+    {
+	const double p = pt[i][0] * axis[0] + pt[i][1] * axis[1] + pt[i][2] * axis[2];
+	uint j = i;
+	while ( j > 0 && proj[j-1] > p )
+	{
+	    proj[j]  = proj[j-1];
+	    order[j] = order[j-1];
+	    j--;
+	}
+	proj[j]  = p;
+	order[j] = i;
+    }
+
+    double psum[CMPR_MAX_COL+1][3];
+    memset(psum[0],0,sizeof(psum[0]));
+    for ( i = 0; i < n; i++ )
+	for ( c = 0; c < 3; c++ )
+	    psum[i+1][c] = psum[i][c] + pt[order[i]][c];
+
+
+    //--- try all clusterings
+
+    double best_err = HUGE_VAL, best[2][3], ax[3], bx[3];
+    uint i1, i2, i3;
+    if ( info->opaque_count < CMPR_MAX_COL )
+    {
+	// 3 clusters with weights 1, 1/2, 0 for the first end point
+
+	for ( i1 = 0; i1 <= n; i1++ )
+	    for ( i2 = i1; i2 <= n; i2++ )
+	    {
+		const double n1 = i2 - i1;
+		for ( c = 0; c < 3; c++ )
 		{
-		    max_dist = dist;
-		    best0 = s0;
-		    best1 = s1;
+		    const double s1 = psum[i2][c] - psum[i1][c];
+		    ax[c] = psum[i1][c] + s1 / 2;
+		    bx[c] = s1 / 2 + psum[n][c] - psum[i2][c];
 		}
+		cmpr_fit_eval( i1 + n1/4, n1/4 + ( n - i2 ), n1/4,
+				ax, bx, &best_err, best );
 	    }
-	}
     }
     else
     {
-	// no transparent points -> 2 middle point
-
-	uint s0;
-	for ( s0 = 0; s0 < n_sum; s0++ )
-	{
-	    u8 *pal0 = sum[s0].col;
-	    uint s1;
-	    for ( s1 = s0+1; s1 < n_sum; s1++ )
-	    {
-		u8 *pal1 = sum[s1].col;
-		u8 pal2[4];
-		pal2[0] = ( 2 * pal0[0] + pal1[0] ) / 3;
-		pal2[1] = ( 2 * pal0[1] + pal1[1] ) / 3;
-		pal2[2] = ( 2 * pal0[2] + pal1[2] ) / 3;
-		u8 pal3[4];
-		pal3[0] = ( pal0[0] + 2 * pal1[0] ) / 3;
-		pal3[1] = ( pal0[1] + 2 * pal1[1] ) / 3;
-		pal3[2] = ( pal0[2] + 2 * pal1[2] ) / 3;
+	// 4 clusters with weights 1, 2/3, 1/3, 0 for the first end point
 
-		uint dist = 0;
-		const u8 * dat;
-		for ( dat = data; dat < data_end && dist < max_dist; dat += 4 )
+	for ( i1 = 0; i1 <= n; i1++ )
+	    for ( i2 = i1; i2 <= n; i2++ )
+		for ( i3 = i2; i3 <= n; i3++ )
 		{
-		    const uint d0 = calc_distance(dat,pal0);
-		    const uint d1 = calc_distance(dat,pal1);
-		    const uint d2 = calc_distance(dat,pal2);
-		    const uint d3 = calc_distance(dat,pal3);
-		    if ( d0 <= d1 )
-		    {
-			if ( d2 <= d3 )
-			    dist += d0 < d2 ? d0 : d2;
-			else
-			    dist += d0 < d3 ? d0 : d3;
-		    }
-		    else
+		    const double n1 = i2 - i1, n2 = i3 - i2;
+		    for ( c = 0; c < 3; c++ )
 		    {
-			if ( d2 <= d3 )
-			    dist += d1 <= d2 ? d1 : d2;
-			else
-			    dist += d1 <= d3 ? d1 : d3;
+			const double s1 = psum[i2][c] - psum[i1][c];
+			const double s2 = psum[i3][c] - psum[i2][c];
+			ax[c] = psum[i1][c] + ( 2*s1 + s2 ) / 3;
+			bx[c] = ( s1 + 2*s2 ) / 3 + psum[n][c] - psum[i3][c];
 		    }
+		    cmpr_fit_eval( i1 + ( 4*n1 + n2 ) / 9,
+				   ( n1 + 4*n2 ) / 9 + ( n - i3 ),
+				   2 * ( n1 + n2 ) / 9,
+				   ax, bx, &best_err, best );
 		}
-		if ( max_dist > dist )
-		{
-		    max_dist = dist;
-		    best0 = s0;
-		    best1 = s1;
-		}
-	    }
-	}
     }
 
-    memcpy(info->p[0],sum[best0].col,4);
-    memcpy(info->p[1],sum[best1].col,4);
+    if ( best_err == HUGE_VAL )
+	return;
+
+
+    //--- compare the distance sums of both results
+
+    cmpr_info_t fit = *info;
+    for ( c = 0; c < 3; c++ )
+    {
+	fit.p[0][c] = lround(best[0][c]);
+	fit.p[1][c] = lround(best[1][c]);
+    }
+    fit.p[0][3] = fit.p[1][3] = 0xff;
+
+    // CMPR_close_info() modifies the palette => use copies
+    cmpr_info_t temp1 = *info, temp2 = fit;
+    u8 cmpr1[8], cmpr2[8];
+    CMPR_close_info(data,&temp1,cmpr1,false);
+    CMPR_close_info(data,&temp2,cmpr2,false);
+    if ( cmpr_block_distance(data,cmpr2) < cmpr_block_distance(data,cmpr1) )
+	memcpy(info->p,fit.p,2*sizeof(*fit.p));
 }
 
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
+// [[cmpr_job_t]]
 
-static enumError conv_to_CMPR
-(
-    Image_t		* dest_img,	// valid destination
-    const Image_t	* src_img,	// valid source
-    palette_format_t	pform		// wanted palette format => ignored
-)
+typedef struct cmpr_job_t
 {
-    DASSERT(dest_img);
-    DASSERT(src_img);
-    DASSERT( src_img->iform >= IMG_X__MIN && src_img->iform <= IMG_X__MAX );
-
-
-    //--- first convert to IMG_X_RGB
+    const Image_t	*img;		// source image, IMG_X_RGB
+    u8			*data;		// destination data
+    uint		h_blocks;	// number of horizontal blocks
+    uint		v_blocks;	// number of vertical blocks
+    uint		first;		// first row of blocks
+    uint		step;		// step to the next row of blocks
+}
+cmpr_job_t;
 
-    if ( src_img->iform != IMG_X_RGB )
-    {
-	enumError err = ConvertIMG(dest_img,false,src_img,IMG_X_RGB,PAL_INVALID);
-	if (err)
-	    return err;
-    }
-    else
-	CopyIMG(dest_img,false,src_img,true);
-    DASSERT( dest_img->iform == IMG_X_RGB );
-    NormalizeFrameIMG(dest_img);
+//-----------------------------------------------------------------------------
 
+static void * encode_CMPR_rows ( void *arg )
+{
+    // encode the rows first, first+step, ... of 8x8 blocks
 
-    //--- and now convert IMG_X_RGB -> CMPR
+    const cmpr_job_t *job = arg;
+    DASSERT(job);
 
-    const uint bits_per_pixel	= 4;
     const uint block_width	= 8;
     const uint block_height	= 8;
+    const uint block_size	= block_width * 4;
+    const uint line_size	= job->img->xwidth * 4;
+    const uint delta[]		= { 0, 16, 4*line_size, 4*line_size+16 };
 
-    uint h_blocks, v_blocks, img_size;
-    CalcImageBlock( dest_img, bits_per_pixel, block_width, block_height,
-			&h_blocks, &v_blocks, &img_size, true );
-
-    u8 *data = CALLOC(1,img_size);
-    u8 *dest = data;
-    const u8 *src1 = dest_img->data;
-
-    const uint block_size = block_width * 4;
-    DASSERT( EXPAND8(dest_img->width) == dest_img->xwidth );
-    const uint line_size = dest_img->xwidth * 4;
-    const uint delta[] = { 0, 16, 4*line_size, 4*line_size+16 };
+    void (*cmpr_func)( const u8 *data, cmpr_info_t *info )
+	= opt_cmpr_fit == CMPR_FIT_CLUSTER ? CMPR_cluster : CMPR_wiimm;
 
-    while ( v_blocks-- > 0 )
+    uint row;
+    for ( row = job->first; row < job->v_blocks; row += job->step )
     {
-      const u8 *src2 = src1;
-      uint hblk = h_blocks;
+      const u8 *src2 = job->img->data + row * line_size * block_height;
+      u8 *dest = job->data + row * job->h_blocks * 4 * 8;
+      uint hblk = job->h_blocks;
       while ( hblk-- > 0 )
       {
 	uint subb;
@@ -3805,8 +4056,8 @@ static enumError conv_to_CMPR
 	    //--- analyze data
 
 	    cmpr_info_t info;
-	    CMPR_wiimm(vector,&info);
-	    PRINT("CMPR: no=%u, %08x %08x %08x %08x\n",
+	    cmpr_func(vector,&info);
+	    noPRINT("CMPR: no=%u, %08x %08x %08x %08x\n",
 		info.opaque_count,
 		*(u32*)info.p[0], *(u32*)info.p[1],
 		*(u32*)info.p[2], *(u32*)info.p[3] );
@@ -3815,13 +4066,97 @@ static enumError conv_to_CMPR
 	}
 	src2 += block_size;
       }
-      src1 += line_size * block_height;
     }
+    return 0;
+}
 
-    DASSERT( dest == data + img_size );
-    DASSERT( src1 <= dest_img->data + dest_img->data_size );
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError conv_to_CMPR
+(
+    Image_t		* dest_img,	// valid destination
+    const Image_t	* src_img,	// valid source
+    palette_format_t	pform		// wanted palette format => ignored
+)
+{
+    DASSERT(dest_img);
+    DASSERT(src_img);
+    DASSERT( src_img->iform >= IMG_X__MIN && src_img->iform <= IMG_X__MAX );
+
+
+    //--- first convert to IMG_X_RGB
+
+    if ( src_img->iform != IMG_X_RGB )
+    {
+	enumError err = ConvertIMG(dest_img,false,src_img,IMG_X_RGB,PAL_INVALID);
+	if (err)
+	    return err;
+    }
+    else
+	CopyIMG(dest_img,false,src_img,true);
+    DASSERT( dest_img->iform == IMG_X_RGB );
+    NormalizeFrameIMG(dest_img);
+
+
+    //--- and now convert IMG_X_RGB -> CMPR
+
+    const uint bits_per_pixel	= 4;
+    const uint block_width	= 8;
+    const uint block_height	= 8;
+
+    uint h_blocks, v_blocks, img_size;
+    CalcImageBlock( dest_img, bits_per_pixel, block_width, block_height,
+			&h_blocks, &v_blocks, &img_size, true );
+    DASSERT( EXPAND8(dest_img->width) == dest_img->xwidth );
+    DASSERT( h_blocks * v_blocks * 4 * 8 == img_size );
+    DASSERT( v_blocks * block_height * dest_img->xwidth * 4 <= dest_img->data_size );
+
+    cmpr_job_t job0;
+    memset(&job0,0,sizeof(job0));
+    job0.img		= dest_img;
+    job0.data		= CALLOC(1,img_size);
+    job0.h_blocks	= h_blocks;
+    job0.v_blocks	= v_blocks;
+    job0.step		= 1;
+
+    // threads are only started for images with at least 64 blocks.
+    // Each block is encoded independently => the result is the same.
+
+    uint n_threads = opt_cmpr_threads < v_blocks ? opt_cmpr_threads : v_blocks;
+    if ( n_threads > 1 && h_blocks * v_blocks >= 64 )
+    {
+	cmpr_job_t *job = CALLOC(n_threads,sizeof(*job));
+	pthread_t *tid = CALLOC(n_threads,sizeof(*tid));
+	bool *started = CALLOC(n_threads,sizeof(*started));
+
+	uint t;
+	for ( t = 0; t < n_threads; t++ )
+	{
+	    job[t]	 = job0;
+	    job[t].first = t;
+	    job[t].step	 = n_threads;
+	}
+
+	for ( t = 1; t < n_threads; t++ )
+	    started[t] = !pthread_create(tid+t,0,encode_CMPR_rows,job+t);
+	encode_CMPR_rows(job);
+
+	for ( t = 1; t < n_threads; t++ )
+	{
+	    if (started[t])
+		pthread_join(tid[t],0);
+	    else
+		encode_CMPR_rows(job+t);
+	}
+
+	FREE(started);
+	FREE(tid);
+	FREE(job);
+    }
+    else
+	encode_CMPR_rows(&job0);
 
-    AssignData(dest_img,dest_img,data,img_size,IMG_CMPR);
+    AssignData(dest_img,dest_img,job0.data,img_size,IMG_CMPR);
     return ERR_OK;
 }
 
@@ -1196,8 +1196,14 @@ static enumError WriteImageData
     if ( !geo || geo->is_x )
 	return ERROR0(ERR_INTERNAL,0);
 
-    Image_t temp;
+    // If not MMF_SMART, each mipmap is created from the previous one
+    // (a copy in 'prev'), which is still hot in the cache.
+
+    const bool chain = opt_mipmap_filter != MMF_SMART;
+    Image_t temp, prev;
     InitializeIMG(&temp);
+    InitializeIMG(&prev);
+    bool have_prev = false;
 
     enumError err = ERR_OK;
     u8 * dest = data + img->info_size;
@@ -1209,15 +1215,26 @@ static enumError WriteImageData
     uint ni;
     for ( ni = 0; ni < mmi->n_mipmap; ni++ )
     {
+	const Image_t *src;
 	if (img->mipmap)
-	    img = img->mipmap;
+	    src = img = img->mipmap;
+	else
+	    src = have_prev ? &prev : img;
 
 	wd /= 2;
 	ht /= 2;
 	DASSERT( wd && ht );
-	err = ResizeIMG(&temp,false,img,wd,ht);
+	err = chain
+		? FilterResizeIMG(&temp,false,src,wd,ht,opt_mipmap_filter)
+		: ResizeIMG(&temp,false,src,wd,ht);
 	if (err)
 	    break;
+
+	if (chain)
+	{
+	    CopyIMG(&prev,false,&temp,false);
+	    have_prev = true;
+	}
 	//PRINT("RESIZE  %3u*%-3u ",wd,ht); HEXDUMP16(0,0,temp.data,16);
 
 	err = ConvertIMG(&temp,false,0,mmi->img.iform,mmi->img.pform);
@@ -1232,6 +1249,7 @@ static enumError WriteImageData
     if (p_dest)
 	*p_dest = dest;
 
+    ResetIMG(&prev);
     ResetIMG(&temp);
     ResetIMG(&mmi->img);
     return err;
@@ -38,6 +38,8 @@
 #include "lib-std.h"
 #include "lib-image.h"
 
+#include <pthread.h>
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			data structures			///////////////
@@ -652,6 +654,308 @@ enumError FillVGradientIMG
 
 bool fast_resize_enabled = false;
 
+//-----------------------------------------------------------------------------
+// The resize kernels are written for the GCC vector extension and for
+// loops, that the compiler can vectorize (see SIMD_CLONES).
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+  #define HAVE_RESIZE_SHUFFLE 1
+#else
+  #define HAVE_RESIZE_SHUFFLE 0
+#endif
+
+typedef u8  resize_u8v_t  __attribute__ ((vector_size(16)));
+typedef u16 resize_u16v_t __attribute__ ((vector_size(32)));
+typedef u32 resize_pixel_t __attribute__ ((vector_size(16)));
+typedef s32 resize_spixel_t __attribute__ ((vector_size(16)));
+
+///////////////////////////////////////////////////////////////////////////////
+
+static SIMD_CLONES void resize_add_line
+(
+    u32			* sum,		// sum += factor * src
+    const u8		* src,		// source line
+    uint		n,		// number of bytes
+    uint		factor		// factor for each byte
+)
+{
+    uint i;
+    for ( i = 0; i < n; i++ )
+	sum[i] += src[i] * factor;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static SIMD_CLONES void resize_div_line
+(
+    u8			* dest,		// dest = sum / div
+    const u32		* sum,		// sums with 'sum[i] < 256*div'
+    uint		n,		// number of bytes
+    uint		div		// >0: divisor
+)
+{
+    // Because of 'sum<2^24' and 'div<2^16' the correctly rounded float
+    // quotient never reaches the next integer => truncation is exact.
+    // Float division is vectorized, integer division is not.
+
+    uint i;
+    if ( div < 0x10000 )
+    {
+	const float fdiv = div;
+	for ( i = 0; i < n; i++ )
+	    dest[i] = (u32)( (float)sum[i] / fdiv );
+    }
+    else
+	for ( i = 0; i < n; i++ )
+	    dest[i] = sum[i] / div;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static SIMD_CLONES void resize_half_line
+(
+    u8			* dest,		// destination line
+    const u8		* src,		// first source line
+    uint		src_add,	// offset of second source line
+    uint		n_pixel		// number of RGBA destination pixels
+)
+{
+    // each channel of a dest pixel is the rounded average of 2x2 source pixels
+
+    uint n = n_pixel;
+
+ #if HAVE_RESIZE_SHUFFLE
+    // 8 source pixels of 2 lines => 4 dest pixels
+
+    static const resize_u16v_t even =
+	{ 0,1,2,3, 8,9,10,11, 16,17,18,19, 24,25,26,27 };
+    static const resize_u16v_t odd =
+	{ 4,5,6,7, 12,13,14,15, 20,21,22,23, 28,29,30,31 };
+
+    for ( ; n >= 4; n -= 4, dest += 16, src += 32 )
+    {
+	resize_u8v_t a0, a1, b0, b1;
+	memcpy(&a0,src,sizeof(a0));
+	memcpy(&a1,src+16,sizeof(a1));
+	memcpy(&b0,src+src_add,sizeof(b0));
+	memcpy(&b1,src+src_add+16,sizeof(b1));
+
+	const resize_u16v_t s0 = __builtin_convertvector(a0,resize_u16v_t)
+			       + __builtin_convertvector(b0,resize_u16v_t);
+	const resize_u16v_t s1 = __builtin_convertvector(a1,resize_u16v_t)
+			       + __builtin_convertvector(b1,resize_u16v_t);
+	const resize_u16v_t res = ( __builtin_shuffle(s0,s1,even)
+				  + __builtin_shuffle(s0,s1,odd) + 2 ) >> 2;
+
+	const resize_u8v_t res8 = __builtin_convertvector(res,resize_u8v_t);
+	memcpy(dest,&res8,sizeof(res8));
+    }
+ #endif
+
+    for ( ; n > 0; n--, src += 4 )
+    {
+	uint c;
+	for ( c = 0; c < 4; c++, src++ )
+	    *dest++ = ( *src + src[4] + src[src_add] + src[src_add+4] + 2 ) / 4;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// [[resize_kernel_t]]
+
+#define RESIZE_SHIFT	14			// fixed point precision of weights
+#define RESIZE_ONE	(1<<RESIZE_SHIFT)	// weight 1.0
+
+typedef struct resize_tap_t
+{
+    uint		first;		// index of first source pixel
+    uint		n;		// number of source pixels
+    const s32		* weight;	// 'n' weights, the sum is RESIZE_ONE
+
+} resize_tap_t;
+
+typedef struct resize_kernel_t
+{
+    resize_tap_t	* tap;		// one element for each dest pixel
+    s32			* weight;	// alloced data of all weights
+
+} resize_kernel_t;
+
+//-----------------------------------------------------------------------------
+
+static double resize_filter ( mipmap_filter_t filter, double x )
+{
+    x = fabs(x);
+    if ( filter == MMF_LANCZOS )
+    {
+	if ( x < 1e-8 )
+	    return 1.0;
+	if ( x >= 3.0 )
+	    return 0.0;
+	const double px = M_PI * x;
+	return 3.0 * sin(px) * sin(px/3.0) / ( px * px );
+    }
+
+    return x < 1.0 ? 1.0 - x : 0.0; // MMF_BILINEAR
+}
+
+//-----------------------------------------------------------------------------
+
+static void setup_resize_kernel
+(
+    resize_kernel_t	* rk,		// kernel to setup
+    uint		src_size,	// >0: number of source pixels
+    uint		dest_size,	// >0: number of dest pixels
+    mipmap_filter_t	filter		// MMF_BILINEAR or MMF_LANCZOS
+)
+{
+    DASSERT(rk);
+    DASSERT(src_size);
+    DASSERT(dest_size);
+
+    // for downscaling, the filter is stretched by the scaling factor
+
+    const double radius  = filter == MMF_LANCZOS ? 3.0 : 1.0;
+    const double scale   = (double)src_size / dest_size;
+    const double fscale  = scale > 1.0 ? scale : 1.0;
+    const double support = radius * fscale;
+    const int max_n	 = (int)ceil(2*support) + 2;
+
+    rk->tap    = MALLOC(dest_size*sizeof(*rk->tap));
+    rk->weight = MALLOC(dest_size*max_n*sizeof(*rk->weight));
+    double *fw = MALLOC(max_n*sizeof(*fw));
+
+    s32 *weight = rk->weight;
+    uint d;
+    for ( d = 0; d < dest_size; d++ )
+    {
+	const double center = ( d + 0.5 ) * scale;
+	int first = floor( center - support );
+	int end   = ceil( center + support );
+	if ( first < 0 )
+	    first = 0;
+	if ( end > (int)src_size )
+	    end = src_size;
+	if ( end - first > max_n )
+	    end = first + max_n;
+
+	double fsum = 0.0;
+	int i;
+	for ( i = first; i < end; i++ )
+	    fsum += fw[i-first] = resize_filter(filter,(i+0.5-center)/fscale);
+
+	//--- convert to fixed point, the largest weight gets the rounding error
+
+	int n = end - first, imax = 0;
+	s32 isum = 0;
+	for ( i = 0; i < n; i++ )
+	{
+	    weight[i] = fsum > 0.0 ? lround( fw[i] / fsum * RESIZE_ONE ) : 0;
+	    isum += weight[i];
+	    if ( weight[i] > weight[imax] )
+		imax = i;
+	}
+	weight[imax] += RESIZE_ONE - isum;
+
+	//--- strip zero weights
+
+	s32 *w = weight;
+	while ( n > 1 && !*w )
+	    w++, n--, first++;
+	while ( n > 1 && !w[n-1] )
+	    n--;
+	if ( w > weight )
+	    memmove(weight,w,n*sizeof(*weight));
+
+	resize_tap_t *tap = rk->tap + d;
+	tap->first	= first;
+	tap->n		= n;
+	tap->weight	= weight;
+	weight += n;
+    }
+
+    FREE(fw);
+}
+
+//-----------------------------------------------------------------------------
+
+static void reset_resize_kernel ( resize_kernel_t *rk )
+{
+    DASSERT(rk);
+    FREE(rk->tap);
+    FREE(rk->weight);
+    memset(rk,0,sizeof(*rk));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline u8 resize_clip ( s32 val )
+{
+    return val < 0 ? 0 : val > 0xff ? 0xff : val;
+}
+
+//-----------------------------------------------------------------------------
+
+static SIMD_CLONES void resize_filter_hline
+(
+    u8			* dest,		// destination line
+    const u8		* src,		// source line
+    const resize_tap_t	* tap,		// one tap for each dest pixel
+    uint		n_pixel		// number of RGBA destination pixels
+)
+{
+    // all 4 channels of a pixel are calculated as vector
+
+    for ( ; n_pixel > 0; n_pixel--, tap++ )
+    {
+	resize_spixel_t sum = { RESIZE_ONE/2, RESIZE_ONE/2, RESIZE_ONE/2, RESIZE_ONE/2 };
+	const u8 *s = src + 4 * tap->first;
+	uint i;
+	for ( i = 0; i < tap->n; i++, s += 4 )
+	{
+	    const resize_spixel_t pix = { s[0], s[1], s[2], s[3] };
+	    sum += pix * tap->weight[i];
+	}
+	sum >>= RESIZE_SHIFT;
+
+	*dest++ = resize_clip(sum[0]);
+	*dest++ = resize_clip(sum[1]);
+	*dest++ = resize_clip(sum[2]);
+	*dest++ = resize_clip(sum[3]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static SIMD_CLONES void resize_filter_vline
+(
+    u8			* dest,		// destination line
+    const u8		* src,		// first line of source data
+    uint		line_size,	// size of a source line in bytes
+    const resize_tap_t	* tap,		// tap of the dest line
+    s32			* sum,		// temporary buffer for 'n' values
+    uint		n		// number of bytes
+)
+{
+    uint i;
+    for ( i = 0; i < n; i++ )
+	sum[i] = RESIZE_ONE/2;
+
+    const u8 *s = src + tap->first * line_size;
+    uint k;
+    for ( k = 0; k < tap->n; k++, s += line_size )
+    {
+	const s32 w = tap->weight[k];
+	for ( i = 0; i < n; i++ )
+	    sum[i] += s[i] * w;
+    }
+
+    for ( i = 0; i < n; i++ )
+	dest[i] = resize_clip( sum[i] >> RESIZE_SHIFT );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 ///////////////////////////////////////////////////////////////////////////////
 
 enumError ResizeIMG
@@ -1049,10 +1353,12 @@ enumError SmartResizeIMG
     u8 * dest1 = data;
     const uint dest_line_skip = bytes_per_pixel * ( xwidth - width );
 
-    //const u8 * src1 = src->data;
     const uint src_line_size  = bytes_per_pixel * src->xwidth;
-    u8 *temp_src = MALLOC(src_line_size);
-    //const uint dest_line_size = bytes_per_pixel * xwidth;
+    const uint src_line_bytes = bytes_per_pixel * src->width;
+    const uint dest_line_bytes = bytes_per_pixel * width;
+    u8  *temp_src = MALLOC(src_line_size);
+    u32 *sum_line = MALLOC( ( src_line_bytes > dest_line_bytes
+				? src_line_bytes : dest_line_bytes ) * sizeof(u32) );
 
     ResizeHelper_t rh, rv;
     InitializeResize(&rh,src->width,width);
@@ -1061,47 +1367,25 @@ enumError SmartResizeIMG
     bool v_ok;
     for ( v_ok = FirstResize(&rv); v_ok; v_ok = NextResize(&rv) )
     {
-	//--- proccess vertical points
+	//--- proccess vertical points: complete lines at once
+
+	uint i;
+	for ( i = 0; i < src_line_bytes; i++ )
+	    sum_line[i] = rv.half_factor;
 
 	const u8 *src2 = src->data + src_line_size * rv.src_idx;
-	u8 *temp = temp_src;
-	uint n = src->width;
-	while ( n-- > 0 )
+	const ResizeElement_t *re;
+	for ( re = rv.elem; re->n_elem; re++ )
 	{
-	    uint sum0 = rv.half_factor;
-	    uint sum1 = rv.half_factor;
-	    uint sum2 = rv.half_factor;
-	    uint sum3 = rv.half_factor;
-
-	    const u8 *src3 = src2;
-	    const ResizeElement_t *re;
-	    for ( re = rv.elem; re->n_elem; re++ )
+	    uint ne;
+	    for ( ne = re->n_elem; ne > 0; ne-- )
 	    {
-		uint ne;
-		for ( ne = re->n_elem; ne > 0; ne-- )
-		{
-		    noPRINT("COPY %u, %u: %zu / %zu / %u\n",
-				rv.src_idx, ne,
-				( src2 - src->data ) / src_line_size,
-				( src3 - src->data ) / src_line_size,
-				src->height );
-		    DASSERT( src3 < src->data + src->data_size );
-		    sum0 += src3[0] * re->factor;
-		    sum1 += src3[1] * re->factor;
-		    sum2 += src3[2] * re->factor;
-		    sum3 += src3[3] * re->factor;
-		    src3 += src_line_size;
-		}
+		DASSERT( src2 + src_line_bytes <= src->data + src->data_size );
+		resize_add_line(sum_line,src2,src_line_bytes,re->factor);
+		src2 += src_line_size;
 	    }
-	    *temp++ = sum0 / rv.sum_factor;
-	    *temp++ = sum1 / rv.sum_factor;
-	    *temp++ = sum2 / rv.sum_factor;
-	    *temp++ = sum3 / rv.sum_factor;
-	    DASSERT( temp <= temp_src + src_line_size );
-	    src2 += bytes_per_pixel;
-	    DASSERT( src2 <= src->data + src->data_size );
 	}
-	DASSERT( temp == temp_src + bytes_per_pixel * src->width );
+	resize_div_line(temp_src,sum_line,src_line_bytes,rv.sum_factor);
 
 	#if HAVE_PRINT0
 	{
@@ -1109,40 +1393,36 @@ enumError SmartResizeIMG
 	    if (!done)
 	    {
 		done = true;
-		HEXDUMP16(4,0,temp_src,temp-temp_src);
+		HEXDUMP16(4,0,temp_src,src_line_bytes);
 	    }
 	}
 	#endif
 
+
+	//--- proccess horizontal points: 4 channels as vector
+
+	u32 *sum = sum_line;
 	bool h_ok;
 	for ( h_ok = FirstResize(&rh); h_ok; h_ok = NextResize(&rh) )
 	{
-	    uint sum0 = rh.half_factor;
-	    uint sum1 = rh.half_factor;
-	    uint sum2 = rh.half_factor;
-	    uint sum3 = rh.half_factor;
-
-	    u8 *temp = temp_src + rh.src_idx * bytes_per_pixel;
+	    resize_pixel_t vsum = { rh.half_factor, rh.half_factor,
+				    rh.half_factor, rh.half_factor };
 
-	    const ResizeElement_t *re;
+	    const u8 *temp = temp_src + rh.src_idx * bytes_per_pixel;
 	    for ( re = rh.elem; re->n_elem; re++ )
 	    {
 		uint ne;
-		for ( ne = re->n_elem; ne > 0; ne-- )
+		for ( ne = re->n_elem; ne > 0; ne--, temp += bytes_per_pixel )
 		{
-		    sum0 += *temp++ * re->factor;
-		    sum1 += *temp++ * re->factor;
-		    sum2 += *temp++ * re->factor;
-		    sum3 += *temp++ * re->factor;
+		    const resize_pixel_t pix = { temp[0], temp[1], temp[2], temp[3] };
+		    vsum += pix * re->factor;
 		}
 	    }
-
-	    *dest1++ = sum0 / rh.sum_factor;
-	    *dest1++ = sum1 / rh.sum_factor;
-	    *dest1++ = sum2 / rh.sum_factor;
-	    *dest1++ = sum3 / rh.sum_factor;
+	    memcpy(sum,&vsum,sizeof(vsum));
+	    sum += bytes_per_pixel;
 	}
-	dest1 += dest_line_skip;
+	resize_div_line(dest1,sum_line,dest_line_bytes,rh.sum_factor);
+	dest1 += dest_line_bytes + dest_line_skip;
 	noPRINT("DEST1: %u/4 = %u, line %u.%u/%u\n",
 		(int)(dest1-data),
 		(int)(dest1-data)/bytes_per_pixel,
@@ -1155,6 +1435,7 @@ enumError SmartResizeIMG
 	(dest1-data)/bytes_per_pixel,
 	(dest1-data)/(bytes_per_pixel*xwidth),
 	(dest1-data)%(bytes_per_pixel*xwidth), height ) ;
+    FREE(sum_line);
     FREE(temp_src);
 
 
@@ -1269,43 +1550,9 @@ enumError HalfIMG
 	uint ih = newht;
 	while ( ih-- > 0 )
 	{
-	    u8 *dest2 = dest1;
-	    const u8 *src2 = src1;
-	    uint iw = newwd;
-	    while ( iw-- > 0 )
-	    {
-		*dest2++ = ( *src2
-				+ src2[pixel_bytes]
-				+ src2[src_add]
-				+ src2[src_add+pixel_bytes]
-				+ 2 ) / 4;
-		src2++;
-		*dest2++ = ( *src2
-				+ src2[pixel_bytes]
-				+ src2[src_add]
-				+ src2[src_add+pixel_bytes]
-				+ 2 ) / 4;
-		src2++;
-		*dest2++ = ( *src2
-				+ src2[pixel_bytes]
-				+ src2[src_add]
-				+ src2[src_add+pixel_bytes]
-				+ 2 ) / 4;
-		src2++;
-		*dest2++ = ( *src2
-				+ src2[pixel_bytes]
-				+ src2[src_add]
-				+ src2[src_add+pixel_bytes]
-				+ 2 ) / 4;
-		src2 += pixel_bytes + 1;
-		DASSERT( dest2 <= data + data_size );
-		DASSERT( src2 <= img->data + img->data_size );
-	    }
-	    noPRINT("%3u: %u*%u %5zx..%5zx/%x -> %u*%u %5zx..%5zx/%x\n",
-		newht - ih - 1,
-		img->width, img->height, src1-img->data, src2-img->data, img->data_size,
-		newwd, newht, dest1-data, dest2-data, data_size );
-
+	    resize_half_line(dest1,src1,src_add,newwd);
+	    DASSERT( dest1 + pixel_bytes * newwd <= data + data_size );
+	    DASSERT( src1 + src_add + 2 * pixel_bytes * newwd <= img->data + img->data_size );
 	    dest1 += dest_add;
 	    src1  += 2 * src_add;
 	    DASSERT( dest1 <= data + data_size );
@@ -1322,83 +1569,215 @@ enumError HalfIMG
     return ERR_OK;
 }
 
-//
-///////////////////////////////////////////////////////////////////////////////
-///////////////			patching helpers		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static PatchImage_t calc_copy_range
+enumError FilterResizeIMG
 (
-    PatchRange1_t	*dest,
-    PatchRange1_t	*src1,
-    PatchRange1_t	*src2,
-    PatchImage_t	patch_mode,
-    PatchImage_t	align_mode
+    Image_t		* dest,		// dest image (may be same as src)
+    bool		init_dest,	// true: initialize 'dest' first
+    const Image_t	* src,		// source image (if NULL: use dest)
+    uint		width,		// new width of image
+    uint		height,		// new height of image
+					// if one of 'width' or 'height' is NULL
+					//	-> keep aspect ratio
+    mipmap_filter_t	filter		// MMF_BILINEAR or MMF_LANCZOS,
+					// all others => use ResizeIMG()
 )
 {
     DASSERT(dest);
-    DASSERT(src1);
-    DASSERT(src2);
+    if (init_dest)
+	InitializeIMG(dest);
+    if (!src)
+	src = dest;
 
-    switch ( patch_mode & PIM_M_SIZE )
+    if ( filter != MMF_BILINEAR && filter != MMF_LANCZOS
+	|| !src->width || !src->height || !width && !height )
     {
-	case PIM_GROW:
-	    dest->size = src1->size > src2->size ? src1->size : src2->size;
-	    break;
+	return ResizeIMG(dest,false,src,width,height);
+    }
 
-	case PIM_SHRINK:
-	    dest->size = src1->size < src2->size ? src1->size : src2->size;
-	    break;
 
-	default: // PIM_LEAVE
-	    dest->size = src1->size;
-	    break;
-    };
+    //--- analyze width and height
 
-    switch ( align_mode & PIM_M_V )
-    {
-	case PIM_TOP:
-	    src1->dest = 0;
-	    src1->src  = 0;
-	    src1->len  = dest->size < src1->size ? dest->size : src1->size;
+    if (!width)
+	width = ( src->width * height + src->height/2 ) / src->height;
+    else if (!height)
+	height = ( src->height * width + src->width/2 ) / src->width;
 
-	    src2->dest = 0;
-	    src2->src  = 0;
-	    src2->len  = dest->size < src2->size ? dest->size : src2->size;
-	    break;
+    if ( width == src->width && height == src->height )
+	return ResizeIMG(dest,false,src,width,height);
 
-	case PIM_BOTTOM:
-	    if ( dest->size >= src1->size )
-	    {
-		src1->dest = dest->size - src1->size;
-		src1->src  = 0;
-		src1->len  = src1->size;
-	    }
-	    else
-	    {
-		src1->dest = 0;
-		src1->src  = src1->size - dest->size;
-		src1->len  = dest->size;
-	    }
 
-	    if ( dest->size >= src2->size )
-	    {
-		src2->dest = dest->size - src2->size;
-		src2->src  = 0;
-		src2->len  = src2->size;
-	    }
-	    else
+    //--- convert to IMG_X_RGB
+
+    PRINT("FILTER-RESIZE: %u*%u -> %u*%u, filter=%u\n",
+		src->width, src->height, width, height, filter );
+
+    if ( src->iform != IMG_X_RGB )
+    {
+	if (IsGrayIMG(src))
+	{
+	    //--- convert temporary to IMG_X_RGB
+
+	    enumError err = ConvertIMG(dest,false,src,IMG_X_RGB,PAL_AUTO);
+	    if (!err)
 	    {
-		src2->dest = 0;
-		src2->src  = src2->size - dest->size;
-		src2->len  = dest->size;
+		err = FilterResizeIMG(dest,false,dest,width,height,filter);
+		if (!err)
+		    err = ConvertToGRAY(dest,dest,PAL_AUTO);
 	    }
-	    break;
+	    return err;
+	}
 
-	case PIM_INS_TOP:
-	    // override the local size and global copy mode!
-	    patch_mode = patch_mode & ~PIM_M_COPY | PIM_COPY;
-	    dest->size = src1->size + src2->size;
+	enumError err = ConvertIMG(dest,false,src,IMG_X_RGB,PAL_AUTO);
+	if (err)
+	    return err;
+	src = dest;
+
+	if ( src->iform != IMG_X_RGB )
+	    return ERROR0(ERR_INTERNAL,
+			"Image format 'X-RGB' expected, but '%s' found\n",
+			PrintFormatIMG(src));
+    }
+
+
+    //--- setup new image data
+
+    DASSERT( src->iform == IMG_X_RGB );
+
+    const uint bytes_per_pixel	= 4;
+    const uint xwidth		= EXPAND8(width);
+    const uint xheight		= EXPAND8(height);
+    const uint data_size	= xwidth * xheight * bytes_per_pixel;
+    u8 *data			= MALLOC(data_size);
+    memset(data,0xff,data_size);
+
+    resize_kernel_t kh, kv;
+    setup_resize_kernel(&kh,src->width,width,filter);
+    setup_resize_kernel(&kv,src->height,height,filter);
+
+
+    //--- horizontal pass: all source lines into a temporary image
+
+    const uint src_line_size  = bytes_per_pixel * src->xwidth;
+    const uint temp_line_size = bytes_per_pixel * width;
+    const uint dest_line_size = bytes_per_pixel * xwidth;
+    u8 *temp = MALLOC( temp_line_size * src->height );
+
+    uint line;
+    for ( line = 0; line < src->height; line++ )
+	resize_filter_hline( temp + line * temp_line_size,
+			     src->data + line * src_line_size,
+			     kh.tap, width );
+
+
+    //--- vertical pass: complete lines at once
+
+    s32 *sum = MALLOC( temp_line_size * sizeof(*sum) );
+    for ( line = 0; line < height; line++ )
+	resize_filter_vline( data + line * dest_line_size, temp, temp_line_size,
+			     kv.tap + line, sum, temp_line_size );
+
+    FREE(sum);
+    FREE(temp);
+    reset_resize_kernel(&kh);
+    reset_resize_kernel(&kv);
+
+
+    //--- assign data
+
+    FreeIMG(dest,src);
+
+    dest->data		= data;
+    dest->data_alloced	= true;
+    dest->width		= width;
+    dest->height	= height;
+    dest->xwidth	= xwidth;
+    dest->xheight	= xheight;
+    dest->data_size	= dest->xwidth * dest->xheight * 4;
+    dest->iform		= IMG_X_RGB;
+    NormalizeFrameIMG(dest);
+
+    return ERR_OK;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			patching helpers		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static PatchImage_t calc_copy_range
+(
+    PatchRange1_t	*dest,
+    PatchRange1_t	*src1,
+    PatchRange1_t	*src2,
+    PatchImage_t	patch_mode,
+    PatchImage_t	align_mode
+)
+{
+    DASSERT(dest);
+    DASSERT(src1);
+    DASSERT(src2);
+
+    switch ( patch_mode & PIM_M_SIZE )
+    {
+	case PIM_GROW:
+	    dest->size = src1->size > src2->size ? src1->size : src2->size;
+	    break;
+
+	case PIM_SHRINK:
+	    dest->size = src1->size < src2->size ? src1->size : src2->size;
+	    break;
+
+	default: // PIM_LEAVE
+	    dest->size = src1->size;
+	    break;
+    };
+
+    switch ( align_mode & PIM_M_V )
+    {
+	case PIM_TOP:
+	    src1->dest = 0;
+	    src1->src  = 0;
+	    src1->len  = dest->size < src1->size ? dest->size : src1->size;
+
+	    src2->dest = 0;
+	    src2->src  = 0;
+	    src2->len  = dest->size < src2->size ? dest->size : src2->size;
+	    break;
+
+	case PIM_BOTTOM:
+	    if ( dest->size >= src1->size )
+	    {
+		src1->dest = dest->size - src1->size;
+		src1->src  = 0;
+		src1->len  = src1->size;
+	    }
+	    else
+	    {
+		src1->dest = 0;
+		src1->src  = src1->size - dest->size;
+		src1->len  = dest->size;
+	    }
+
+	    if ( dest->size >= src2->size )
+	    {
+		src2->dest = dest->size - src2->size;
+		src2->src  = 0;
+		src2->len  = src2->size;
+	    }
+	    else
+	    {
+		src2->dest = 0;
+		src2->src  = src2->size - dest->size;
+		src2->len  = dest->size;
+	    }
+	    break;
+
+	case PIM_INS_TOP:
+	    // override the local size and global copy mode!
+	    patch_mode = patch_mode & ~PIM_M_COPY | PIM_COPY;
+	    dest->size = src1->size + src2->size;
 
 	    src1->dest = src2->size;
 	    src1->src  = 0;
@@ -2206,6 +2585,733 @@ uint MedianCut
     return mc.n_block;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    K-Means: data structures		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+#define KM_MAX_ITER	8	// max number of Lloyd iterations
+#define KM_MIN_JOB	4096	// min number of pixels per thread
+#define KM_SEARCH_COST	64	// cost of a tree search in pixels
+
+//-----------------------------------------------------------------------------
+
+typedef struct km_elem_t
+{
+    u8			val[CHAN];	// channel tuple
+    u32			weight;		// number of pixels with this color
+
+} km_elem_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct km_block_t
+{
+    km_elem_t		* elem_beg;	// pointer to first element
+    km_elem_t		* elem_end;	// pointer to end of element list
+    double		sse;		// sum of squared errors, split priority
+    u8			axis;		// channel with max variance
+    u8			mean[CHAN];	// weighted mean of all elements
+
+} km_block_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct km_node_t
+{
+    // The kd-tree is stored implicitly: the node of range [0,n)
+    // is at n/2, its children are the ranges [0,n/2) and [n/2+1,n).
+
+    u8			val[CHAN];	// color of the palette entry
+    u16			index;		// index into palette
+    u8			axis;		// split channel
+
+} km_node_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct km_t
+{
+    uint		n_uniq;		// number of unique colors
+    u32			* uniq;		// sorted list of unique colors
+    u32			* weight;	// number of pixels for each unique color
+    u16			* cluster;	// palette index of each unique color
+
+    uint		n_pal;		// number of palette entries
+    u8			* pal;		// palette, CHAN bytes per entry
+    km_node_t		* tree;		// kd-tree of the palette
+
+    const u32		* data;		// copy of source, 'width' pixels per row
+    u16			* index;	// index table, 'xwidth' pixels per row
+    uint		width;		// used pixels per row
+    uint		xwidth;		// pixels per row of 'index'
+    uint		height;		// number of rows
+
+    uint		n_threads;	// max number of threads
+
+} km_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct km_job_t
+{
+    const km_t		* km;		// common data
+    uint		beg;		// first color or row
+    uint		end;		// end of colors or rows
+    u64			* sum;		// NULL or 'n_pal' tuples of CHAN+1 sums
+
+} km_job_t;
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    K-Means: Helpers			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static void km_radix_sort ( u32 *data, u32 *temp, uint n )
+{
+    // LSD radix sort, 4 passes of 8 bits => result is in 'data'
+
+    uint shift;
+    for ( shift = 0; shift < 32; shift += 8 )
+    {
+	uint count[0x100];
+	memset(count,0,sizeof(count));
+
+	uint i;
+	for ( i = 0; i < n; i++ )
+	    count[ data[i] >> shift & 0xff ]++;
+
+	uint pos = 0;
+	for ( i = 0; i < 0x100; i++ )
+	{
+	    const uint temp_count = count[i];
+	    count[i] = pos;
+	    pos += temp_count;
+	}
+
+	for ( i = 0; i < n; i++ )
+	    temp[ count[ data[i] >> shift & 0xff ]++ ] = data[i];
+
+	u32 *swap = data;
+	data = temp;
+	temp = swap;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void km_calc_block ( km_block_t *blk )
+{
+    // calculate mean, split channel and sum of squared errors
+
+    DASSERT(blk);
+    DASSERT( blk->elem_beg < blk->elem_end );
+
+    u64 sum[CHAN] = {0}, sum2[CHAN] = {0}, weight = 0;
+    const km_elem_t *elem;
+    for ( elem = blk->elem_beg; elem < blk->elem_end; elem++ )
+    {
+	uint c;
+	for ( c = 0; c < CHAN; c++ )
+	{
+	    const u64 v = elem->val[c];
+	    sum[c]  += elem->weight * v;
+	    sum2[c] += elem->weight * v * v;
+	}
+	weight += elem->weight;
+    }
+
+    double max_var = -1.0;
+    blk->sse = 0.0;
+    uint c;
+    for ( c = 0; c < CHAN; c++ )
+    {
+	const double var = sum2[c] - (double)sum[c] * sum[c] / weight;
+	blk->sse += var;
+	if ( max_var < var )
+	{
+	    max_var = var;
+	    blk->axis = c;
+	}
+	blk->mean[c] = ( sum[c] + weight/2 ) / weight;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static km_elem_t * km_split_block ( km_block_t *blk )
+{
+    // split at the weighted median of channel 'axis'
+    // returns NULL, if the block can't be split
+
+    DASSERT(blk);
+    const uint c = blk->axis;
+
+    u64 hist[0x100], total = 0;
+    memset(hist,0,sizeof(hist));
+    uint min = 0xff, max = 0;
+    const km_elem_t *elem;
+    for ( elem = blk->elem_beg; elem < blk->elem_end; elem++ )
+    {
+	const uint v = elem->val[c];
+	hist[v] += elem->weight;
+	total += elem->weight;
+	if ( min > v ) min = v;
+	if ( max < v ) max = v;
+    }
+    if ( min == max )
+	return 0;
+
+    // smallest 'split' with min < split <= max and weight(<split) >= total/2
+
+    uint split = min + 1;
+    u64 below = hist[min];
+    while ( split < max && 2*below < total )
+	below += hist[split++];
+
+    km_elem_t *e1 = blk->elem_beg;
+    km_elem_t *e2 = blk->elem_end - 1;
+    for(;;)
+    {
+	while ( e1 < e2 && e1->val[c] <  split )
+	    e1++;
+	while ( e1 < e2 && e2->val[c] >= split )
+	    e2--;
+	if ( e1 >= e2 )
+	    break;
+
+	km_elem_t temp = *e1;
+	*e1 = *e2;
+	*e2 = temp;
+    }
+    DASSERT( e1 > blk->elem_beg && e1 < blk->elem_end );
+    return e1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint km_seed_palette ( km_t *km, uint pal_elem )
+{
+    // weighted median cut of the unique colors: always split the block
+    // with the largest sum of squared errors. Blocks are held in a heap.
+
+    DASSERT(km);
+    DASSERT( km->n_uniq > pal_elem );
+
+    km_elem_t *elem = MALLOC(km->n_uniq*sizeof(*elem));
+    uint i;
+    for ( i = 0; i < km->n_uniq; i++ )
+    {
+	memcpy(elem[i].val,km->uniq+i,CHAN);
+	elem[i].weight = km->weight[i];
+    }
+
+    km_block_t *block = MALLOC(pal_elem*sizeof(*block));
+    km_block_t **heap = MALLOC(pal_elem*sizeof(*heap));
+    block->elem_beg = elem;
+    block->elem_end = elem + km->n_uniq;
+    km_calc_block(block);
+    heap[0] = block;
+    uint n_block = 1, n_heap = 1;
+
+    while ( n_block < pal_elem && n_heap )
+    {
+	//--- pop top of heap
+
+	km_block_t *b1 = heap[0];
+	km_block_t *last = heap[--n_heap];
+	uint pos = 0;
+	for(;;)
+	{
+	    uint child = 2*pos + 1;
+	    if ( child >= n_heap )
+		break;
+	    if ( child+1 < n_heap && heap[child+1]->sse > heap[child]->sse )
+		child++;
+	    if ( last->sse >= heap[child]->sse )
+		break;
+	    heap[pos] = heap[child];
+	    pos = child;
+	}
+	heap[pos] = last;
+
+
+	//--- split block
+
+	km_elem_t *mid = km_split_block(b1);
+	if (!mid)
+	    continue; // single color, never split again
+
+	km_block_t *b2 = block + n_block++;
+	b2->elem_beg = mid;
+	b2->elem_end = b1->elem_end;
+	b1->elem_end = mid;
+	km_calc_block(b1);
+	km_calc_block(b2);
+
+
+	//--- push both blocks
+
+	km_block_t *bp[2] = { b1, b2 };
+	uint b;
+	for ( b = 0; b < 2; b++ )
+	{
+	    if ( bp[b]->elem_end - bp[b]->elem_beg < 2 )
+		continue;
+
+	    pos = n_heap++;
+	    while ( pos > 0 && heap[(pos-1)/2]->sse < bp[b]->sse )
+	    {
+		heap[pos] = heap[(pos-1)/2];
+		pos = (pos-1)/2;
+	    }
+	    heap[pos] = bp[b];
+	}
+    }
+
+    for ( i = 0; i < n_block; i++ )
+	memcpy(km->pal+i*CHAN,block[i].mean,CHAN);
+
+    FREE(heap);
+    FREE(block);
+    FREE(elem);
+    return n_block;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+#define KM_CMP_NODE(c) \
+    static int km_cmp_node##c ( const void *a, const void *b ) \
+    { return ((km_node_t*)a)->val[c] - ((km_node_t*)b)->val[c]; }
+
+KM_CMP_NODE(0)
+KM_CMP_NODE(1)
+KM_CMP_NODE(2)
+KM_CMP_NODE(3)
+
+#undef KM_CMP_NODE
+
+//-----------------------------------------------------------------------------
+
+static void km_build_tree ( km_node_t *node, uint n )
+{
+    if ( n < 2 )
+    {
+	if (n)
+	    node->axis = 0;
+	return;
+    }
+
+    u8 min[CHAN], max[CHAN];
+    memset(min,0xff,sizeof(min));
+    memset(max,0,sizeof(max));
+    uint i, c;
+    for ( i = 0; i < n; i++ )
+	for ( c = 0; c < CHAN; c++ )
+	{
+	    if ( min[c] > node[i].val[c] ) min[c] = node[i].val[c];
+	    if ( max[c] < node[i].val[c] ) max[c] = node[i].val[c];
+	}
+
+    uint axis = 0;
+    for ( c = 1; c < CHAN; c++ )
+	if ( max[c] - min[c] > max[axis] - min[axis] )
+	    axis = c;
+
+
+    //--- sort by 'axis' => the median is at n/2
+
+    static int (*const cmp_func[CHAN])( const void *, const void * ) =
+    {
+	km_cmp_node0, km_cmp_node1, km_cmp_node2, km_cmp_node3
+    };
+    qsort(node,n,sizeof(*node),cmp_func[axis]);
+
+    const uint mid = n/2;
+    node[mid].axis = axis;
+    km_build_tree(node,mid);
+    km_build_tree(node+mid+1,n-mid-1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void km_search_tree
+(
+    const km_node_t	* node,		// implicit kd-tree
+    uint		n,		// number of nodes
+    const u8		* val,		// color to search
+    uint		* best_dist,	// current best distance
+    uint		* best_index	// current best index
+)
+{
+    while (n)
+    {
+	const uint mid = n/2;
+	const km_node_t *nd = node + mid;
+
+	uint dist = 0, c;
+	for ( c = 0; c < CHAN; c++ )
+	{
+	    const int d = (int)val[c] - nd->val[c];
+	    dist += d*d;
+	}
+	if ( dist < *best_dist )
+	{
+	    *best_dist  = dist;
+	    *best_index = nd->index;
+	}
+
+	// search the near side first, and the far side only if needed
+
+	const int d = (int)val[nd->axis] - nd->val[nd->axis];
+	if ( d < 0 )
+	{
+	    km_search_tree(node,mid,val,best_dist,best_index);
+	    if ( (uint)(d*d) >= *best_dist )
+		return;
+	    node += mid + 1;
+	    n -= mid + 1;
+	}
+	else
+	{
+	    km_search_tree(node+mid+1,n-mid-1,val,best_dist,best_index);
+	    if ( (uint)(d*d) >= *best_dist )
+		return;
+	    n = mid;
+	}
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void km_setup_tree ( km_t *km )
+{
+    DASSERT(km);
+    uint i;
+    for ( i = 0; i < km->n_pal; i++ )
+    {
+	km_node_t *node = km->tree + i;
+	memcpy(node->val,km->pal+i*CHAN,CHAN);
+	node->index = i;
+    }
+    km_build_tree(km->tree,km->n_pal);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void * km_assign_job ( void *arg )
+{
+    // assign each unique color to the nearest palette entry
+
+    km_job_t *job = arg;
+    DASSERT(job);
+    const km_t *km = job->km;
+
+    uint i;
+    for ( i = job->beg; i < job->end; i++ )
+    {
+	u8 val[CHAN];
+	memcpy(val,km->uniq+i,CHAN);
+	uint best_dist = ~0u, best_index = 0;
+	km_search_tree(km->tree,km->n_pal,val,&best_dist,&best_index);
+	km->cluster[i] = best_index;
+
+	if (job->sum)
+	{
+	    const u32 weight = km->weight[i];
+	    u64 *sum = job->sum + best_index*(CHAN+1);
+	    uint c;
+	    for ( c = 0; c < CHAN; c++ )
+		sum[c] += (u64)weight * val[c];
+	    sum[CHAN] += weight;
+	}
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void * km_map_job ( void *arg )
+{
+    // map each pixel to the palette index of its unique color
+
+    km_job_t *job = arg;
+    DASSERT(job);
+    const km_t *km = job->km;
+
+    uint row;
+    for ( row = job->beg; row < job->end; row++ )
+    {
+	const u32 *src = km->data + row * km->width;
+	u16 *dest = km->index + row * km->xwidth;
+
+	u32 last_col = ~*src;
+	uint last_idx = 0;
+	uint w;
+	for ( w = 0; w < km->width; w++ )
+	{
+	    const u32 col = *src++;
+	    if ( col != last_col )
+	    {
+		uint lo = 0, hi = km->n_uniq;
+		while ( hi - lo > 1 )
+		{
+		    const uint mid = ( lo + hi ) / 2;
+		    if ( km->uniq[mid] <= col )
+			lo = mid;
+		    else
+			hi = mid;
+		}
+		DASSERT( km->uniq[lo] == col );
+		last_col = col;
+		last_idx = km->cluster[lo];
+	    }
+	    *dest++ = last_idx;
+	}
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void km_run_jobs
+(
+    km_t		* km,		// common data
+    void *		(*func)( void *arg ),
+    uint		n_items,	// number of colors or rows
+    uint		item_cost,	// cost of each item in pixels
+    u64			* sum		// NULL or 'n_threads' sum tables
+)
+{
+    DASSERT(km);
+    DASSERT(func);
+
+    uint n_threads = km->n_threads;
+    const uint max_threads = (u64)n_items * item_cost / KM_MIN_JOB;
+    if ( n_threads > max_threads )
+	n_threads = max_threads;
+    if ( n_threads > n_items )
+	n_threads = n_items;
+    if ( n_threads < 1 )
+	n_threads = 1;
+
+    km_job_t *job = CALLOC(n_threads,sizeof(*job));
+    pthread_t *tid = CALLOC(n_threads,sizeof(*tid));
+    bool *started = CALLOC(n_threads,sizeof(*started));
+
+    uint t;
+    for ( t = 0; t < n_threads; t++ )
+    {
+	job[t].km  = km;
+	job[t].beg = (u64)n_items *  t    / n_threads;
+	job[t].end = (u64)n_items * (t+1) / n_threads;
+	job[t].sum = sum ? sum + t * km->n_pal * (CHAN+1) : 0;
+    }
+
+    for ( t = 1; t < n_threads; t++ )
+	started[t] = !pthread_create(tid+t,0,func,job+t);
+    func(job);
+
+    for ( t = 1; t < n_threads; t++ )
+    {
+	if (started[t])
+	    pthread_join(tid[t],0);
+	else
+	    func(job+t);
+    }
+
+    FREE(started);
+    FREE(tid);
+    FREE(job);
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    K-Means: Interface			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+uint KMeansPalette
+(
+    const u32		* data,		// input: 4-tuple aka RGBA
+					// data is read at the very beginning
+					// and may overlay with 'index' and/or 'pal'
+    u16			* index,	// not NULL: store index into palette,
+					//           can be the space as 'data'
+
+    // The follwing 3 parameters are used for 'data' and 'index'.
+    // They allow to skip unused pixel at the end or each row.
+    uint		width,		// used pixels per row
+    uint		xwidth,		// >width: pixels per row
+    uint		height,		// number or rows
+
+    // pallette data
+    u32			* pal,		// not NULL: store calculated palette
+    uint		pal_elem,	// number of wanted palette entries
+
+    uint		n_threads	// >1: use threads for large images
+
+    // return value = number of calculated palette values
+)
+{
+    DASSERT(data);
+    DASSERT(width);
+    DASSERT(height);
+    DASSERT(pal);
+    DASSERT(pal_elem);
+
+    PRINT("KMeansPalette(), %d,%dx%d, pal=%d, n_pal=%u, threads=%u\n",
+		width, xwidth, height, pal!=0, pal_elem, n_threads );
+
+ #if HAVE_PRINT
+    u64 usec = GetTimerUSec();
+ #endif
+
+    if ( pal_elem > 0x10000 )
+	 pal_elem = 0x10000;
+    if ( xwidth < width )
+	 xwidth = width;
+
+
+    //--- copy data, because it may overlay with 'index'
+
+    km_t km;
+    memset(&km,0,sizeof(km));
+    km.width		= width;
+    km.xwidth		= xwidth;
+    km.height		= height;
+    km.n_threads	= n_threads;
+
+    const uint n_elem = width * height;
+    u32 *copy = MALLOC(n_elem*sizeof(*copy));
+    uint row;
+    for ( row = 0; row < height; row++ )
+	memcpy(copy+row*width,data+row*xwidth,width*sizeof(*copy));
+    km.data = copy;
+
+
+    //--- histogram: sorted list of unique colors and their weights
+
+    u32 *sorted = MALLOC(n_elem*sizeof(*sorted));
+    u32 *temp   = MALLOC(n_elem*sizeof(*temp));
+    memcpy(sorted,copy,n_elem*sizeof(*sorted));
+    km_radix_sort(sorted,temp,n_elem);
+
+    u32 *weight = temp;
+    uint i, n_uniq = 0;
+    for ( i = 0; i < n_elem; i++ )
+    {
+	if ( !n_uniq || sorted[n_uniq-1] != sorted[i] )
+	{
+	    sorted[n_uniq] = sorted[i];
+	    weight[n_uniq++] = 1;
+	}
+	else
+	    weight[n_uniq-1]++;
+    }
+    km.n_uniq	= n_uniq;
+    km.uniq	= sorted;
+    km.weight	= weight;
+    km.cluster	= MALLOC(n_uniq*sizeof(*km.cluster));
+    km.pal	= (u8*)pal;
+    km.tree	= MALLOC(pal_elem*sizeof(*km.tree));
+
+
+    //--- calculate palette
+
+    uint n_iter = 0;
+    if ( n_uniq <= pal_elem )
+    {
+	// exact palette
+	memcpy(pal,sorted,n_uniq*sizeof(*pal));
+	km.n_pal = n_uniq;
+    }
+    else
+    {
+	km.n_pal = km_seed_palette(&km,pal_elem);
+
+	const uint sum_size = km.n_pal * (CHAN+1);
+	const uint n_sum = n_threads > 1 ? n_threads : 1;
+	u64 *sum = MALLOC(n_sum*sum_size*sizeof(*sum));
+
+	while ( n_iter++ < KM_MAX_ITER )
+	{
+	    //--- assign colors to the nearest palette entry
+
+	    km_setup_tree(&km);
+	    memset(sum,0,n_sum*sum_size*sizeof(*sum));
+	    km_run_jobs(&km,km_assign_job,n_uniq,KM_SEARCH_COST,sum);
+
+
+	    //--- move palette entries to the center of their clusters
+
+	    bool changed = false;
+	    uint p;
+	    for ( p = 0; p < km.n_pal; p++ )
+	    {
+		u64 *s0 = sum + p*(CHAN+1), t;
+		for ( t = 1; t < n_sum; t++ )
+		{
+		    const u64 *s = s0 + t*sum_size;
+		    uint c;
+		    for ( c = 0; c <= CHAN; c++ )
+			s0[c] += s[c];
+		}
+
+		const u64 w = s0[CHAN];
+		if (!w)
+		    continue; // empty cluster: keep the old color
+
+		u8 *dest = km.pal + p*CHAN;
+		uint c;
+		for ( c = 0; c < CHAN; c++ )
+		{
+		    const u8 val = ( s0[c] + w/2 ) / w;
+		    if ( dest[c] != val )
+		    {
+			dest[c] = val;
+			changed = true;
+		    }
+		}
+	    }
+	    if (!changed)
+		break;
+	}
+	FREE(sum);
+    }
+
+
+    //--- fill index table
+
+    if (index)
+    {
+	km_setup_tree(&km);
+	km_run_jobs(&km,km_assign_job,n_uniq,KM_SEARCH_COST,0);
+
+	// 'index' may overlay 'data', but 'copy' is used => no conflict
+	km.index = index;
+	if ( xwidth > width )
+	    memset(index,0,xwidth*height*sizeof(*index));
+	km_run_jobs(&km,km_map_job,height,width,0);
+    }
+
+
+    //--- clean & return
+
+    FREE(km.tree);
+    FREE(km.cluster);
+    FREE(temp);
+    FREE(sorted);
+    FREE(copy);
+
+ #if HAVE_PRINT
+    usec = GetTimerUSec() - usec;
+    PRINT("K-MEANS: elem=%u, uniq=%u, pal=%u/%u, iter=%u, %llu usec\n",
+		n_elem, n_uniq, km.n_pal, pal_elem, n_iter, usec );
+ #endif
+
+    return km.n_pal;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    END				///////////////
@@ -35,6 +35,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <pthread.h>
+
 #include "lib-kcl.h"
 #include "lib-kmp.h"
 #include "lib-image.h"
@@ -280,10 +282,14 @@ static void ImageFall ( png_param_t *p, const png_object_t *o, uint multi )
 		: 0;
 	}
 	col.a = 0xff;
-	TRACE("DRAW: %05x -> %08x\n",res_kcl_flag,col.val);
+	noTRACE("DRAW: %05x -> %08x\n",res_kcl_flag,col.val);
 	noPRINT_IF( res_kcl_flag >= N_KCL_FLAG,
 			"DRAW: %05x -> %08x\n", res_kcl_flag, col.val );
-	DrawPointIMG(&p->img,o->ximg,o->yimg,col,false);
+
+	// write directly into the image, because tiles are drawn by threads
+	DASSERT( p->img.iform == IMG_X_RGB );
+	if ( o->ximg < p->img.width && o->yimg < p->img.height )
+	    ((Color_t*)p->img.data)[ o->yimg * p->img.xwidth + o->ximg ] = col;
 	return;
     }
 
@@ -316,6 +322,58 @@ static void ImageFall ( png_param_t *p, const png_object_t *o, uint multi )
     ImageFall(p,&obj,multi);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// [[png_job_t]]
+
+// The image is split into square tiles of PNG_TILE_SIZE*PNG_TILE_SIZE top
+// level objects. Tiles don't share pixels and the octree is only read, so
+// the tiles are drawn by threads with the same result as a single thread.
+
+#define PNG_TILE_SIZE 4
+
+typedef struct png_job_t
+{
+    png_param_t		*param;		// common parameters
+    const png_object_t	*base;		// first top level object
+    uint		multi;		// number of pixels of a top level object
+    uint		xn, zn;		// number of top level objects
+    uint		tile_xn;	// number of tiles in x direction
+    uint		n_tiles;	// total number of tiles
+    uint		first;		// first tile of this job
+    uint		step;		// step to next tile of this job
+}
+png_job_t;
+
+//-----------------------------------------------------------------------------
+
+static void * ImageTileJob ( void *arg )
+{
+    const png_job_t *job = arg;
+    DASSERT(job);
+
+    for ( uint tile = job->first; tile < job->n_tiles; tile += job->step )
+    {
+	const uint x1 = tile % job->tile_xn * PNG_TILE_SIZE;
+	const uint z1 = tile / job->tile_xn * PNG_TILE_SIZE;
+	const uint x2 = x1 + PNG_TILE_SIZE < job->xn ? x1 + PNG_TILE_SIZE : job->xn;
+	const uint z2 = z1 + PNG_TILE_SIZE < job->zn ? z1 + PNG_TILE_SIZE : job->zn;
+
+	png_object_t object = *job->base;
+	for ( uint z = z1; z < z2; z++ )
+	{
+	    object.zpos = job->base->zpos + z * object.pix_size;
+	    object.yimg = z * job->multi;
+	    for ( uint x = x1; x < x2; x++ )
+	    {
+		object.xpos = job->base->xpos + x * object.pix_size;
+		object.ximg = x * job->multi;
+		ImageFall(job->param,&object,job->multi);
+	    }
+	}
+    }
+    return 0;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 enumError SaveImageKCL
@@ -589,7 +647,7 @@ enumError SaveImageKCL
     FREE(flag_count);
 
 
-    //--- setup object and iterate
+    //--- setup object and iterate tiles
 
     png_object_t object;
     memset(&object,0,sizeof(object));
@@ -597,21 +655,55 @@ enumError SaveImageKCL
     object.pix_size = multi * param.pix_size;
     object.xpos = param.x1 + object.pix_size / 2;
     object.ypos = param.y;
-    object.ximg  = 0;
+    object.zpos = param.z1 + object.pix_size / 2;
 
-    while ( object.xpos < param.x2 )
+    png_job_t job0 =
     {
-	object.zpos = param.z1 + object.pix_size / 2;
-	object.yimg = 0;
-	while ( object.zpos < param.z2 )
+	.param	 = &param,
+	.base	 = &object,
+	.multi	 = multi,
+	.xn	 = ( param.x2 - object.xpos + object.pix_size - 1 ) / object.pix_size,
+	.zn	 = ( param.z2 - object.zpos + object.pix_size - 1 ) / object.pix_size,
+	.step	 = 1,
+    };
+    job0.tile_xn = ( job0.xn + PNG_TILE_SIZE - 1 ) / PNG_TILE_SIZE;
+    job0.n_tiles = job0.tile_xn * ( ( job0.zn + PNG_TILE_SIZE - 1 ) / PNG_TILE_SIZE );
+
+    uint n_threads = opt_kcl_threads < job0.n_tiles ? opt_kcl_threads : job0.n_tiles;
+    if ( n_threads > 1 )
+    {
+	// draw the tiles by threads, job #0 is done by the current thread
+
+	png_job_t *job = CALLOC(n_threads,sizeof(*job));
+	pthread_t *tid = CALLOC(n_threads,sizeof(*tid));
+	bool *started = CALLOC(n_threads,sizeof(*started));
+
+	uint t;
+	for ( t = 0; t < n_threads; t++ )
 	{
-	    ImageFall(&param,&object,multi);
-	    object.zpos += object.pix_size;
-	    object.yimg += multi;
+	    job[t]	 = job0;
+	    job[t].first = t;
+	    job[t].step	 = n_threads;
 	}
-	object.xpos += object.pix_size;
-	object.ximg += multi;
+
+	for ( t = 1; t < n_threads; t++ )
+	    started[t] = !pthread_create(tid+t,0,ImageTileJob,job+t);
+	ImageTileJob(job);
+
+	for ( t = 1; t < n_threads; t++ )
+	{
+	    if (started[t])
+		pthread_join(tid[t],0);
+	    else
+		ImageTileJob(job+t);
+	}
+
+	FREE(started);
+	FREE(tid);
+	FREE(job);
     }
+    else
+	ImageTileJob(&job0);
 
 
     //--- terminate
@@ -43,6 +43,7 @@
 #include "obj-mtl-bz2.inc"
 #include <math.h>
 #include <stddef.h>
+#include <pthread.h>
 
 //
 ///////////////////////////////////////////////////////////////////////////////
@@ -2569,6 +2570,7 @@ typedef struct oct_info_t
     kcl_t		*kcl;		// current KCL
     uint		n_tri;		// number of triangles
     kcl_tri_t		*tri;		// triangle values
+    tri_soa_t		soa;		// same triangles for OverlapCubeTriSOA()
  #if SUPPORT_KCL_CUBE
     kcl_cube_list_t	*cubelist;	// NULL or a cube list for each 'tri'
  #endif
@@ -2581,8 +2583,49 @@ typedef struct oct_info_t
     uint		tused;		// number of used elements in 'tlist'
     uint		tsize;		// number of alloced elements in 'tlist'
 
+    // hash table to find duplicates of triangle lists. Each suffix of each
+    // stored list is inserted, because a search may find any suffix.
+    u32			*thash;		// hash value for each element of 'tlist'
+    u32			*tnext;		// next element with same hash, or M1
+    u32			*thead;		// first element for each hash bucket, or M1
+    uint		thead_size;	// number of buckets, power of 2
+
 } oct_info_t;
 
+//-----------------------------------------------------------------------------
+// [[oct_stream_t]]
+
+// The sub tree of a base cube is recorded as a stream of u32 tokens in
+// depth-first order: OCT_SUBCUBE is followed by the streams of the 8 sub
+// cubes, any other value N is a leaf followed by N triangle indices.
+
+#define OCT_SUBCUBE 0xffffffff
+
+typedef struct oct_stream_t
+{
+    u32			*list;		// list of tokens
+    uint		used;		// number of used elements in 'list'
+    uint		size;		// number of alloced elements in 'list'
+
+} oct_stream_t;
+
+//-----------------------------------------------------------------------------
+// [[oct_job_t]]
+
+typedef struct oct_job_t
+{
+    const oct_info_t	*oi;		// base data, read only
+    oct_stream_t	*stream;	// one stream for each base cube
+    const u32		*bstart;	// index into 'bidx' for each base cube
+    const u32		*bidx;		// triangle indices of all base cubes
+    uint		xn, yn;		// number of base cubes in x and y direction
+    uint		n_cubes;	// total number of base cubes
+    uint		cube_size;	// size of base cubes
+    uint		first;		// first base cube of this job
+    uint		step;		// step to next base cube of this job
+
+} oct_job_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -2804,23 +2847,138 @@ static bool OctCubeTriangleOverlaped
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static u32 CalcCube
+static inline u32 HashTriListKCL ( u32 hash, u16 val )
+{
+    return ( hash ^ val ) * 0x01000193;
+}
+
+//-----------------------------------------------------------------------------
+
+static void RehashTriListKCL ( oct_info_t *oi, uint new_size )
+{
+    DASSERT(oi);
+    DASSERT( !( new_size & new_size-1 ) );
+
+    FREE(oi->thead);
+    oi->thead_size = new_size;
+    oi->thead = MALLOC( new_size * sizeof(*oi->thead) );
+    memset(oi->thead,0xff,new_size*sizeof(*oi->thead));
+
+    // insert in ascending order => each chain is sorted descending
+    const uint mask = new_size - 1;
+    for ( uint i = 0; i < oi->tused; i++ )
+    {
+	const uint slot = oi->thash[i] & mask;
+	oi->tnext[i] = oi->thead[slot];
+	oi->thead[slot] = i;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static int FindTriListKCL
+(
+    // Returns the index of the first occurrence of a NULL terminated list
+    // in 'oi->tlist' or -1, if not found. Only lists before 'tdata' are
+    // searched. This is the same result as a linear search by memcmp().
+
+    oct_info_t		*oi,		// base data
+    const u16		*tdata,		// list to search, NULL terminated
+    uint		tcount,		// number of elements of 'tdata' incl. NULL
+    u32			hash		// hash of 'tdata'
+)
+{
+    DASSERT(oi);
+    DASSERT(tdata);
+
+    int found = -1;
+    const uint tsize = tcount * sizeof(*tdata);
+    for ( u32 i = oi->thead[ hash & oi->thead_size-1 ]; i != M1(i); i = oi->tnext[i] )
+	if ( oi->thash[i] == hash && !memcmp(oi->tlist+i,tdata,tsize) )
+	    found = i;
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+
+static void InsertTriListKCL
 (
+    // insert all suffixes of the list at 'oi->tused' into the hash table
+
     oct_info_t		*oi,		// base data
+    uint		tcount		// number of elements incl. NULL
+)
+{
+    DASSERT(oi);
+
+    const uint new_used = oi->tused + tcount;
+    if ( new_used > 2 * oi->thead_size )
+    {
+	oi->tused = new_used;
+	uint new_size = oi->thead_size;
+	while ( new_used > new_size )
+	    new_size *= 2;
+	RehashTriListKCL(oi,new_size);
+	return;
+    }
+
+    const uint mask = oi->thead_size - 1;
+    for ( uint i = oi->tused; i < new_used; i++ )
+    {
+	const uint slot = oi->thash[i] & mask;
+	oi->tnext[i] = oi->thead[slot];
+	oi->thead[slot] = i;
+    }
+    oi->tused = new_used;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static u32 * GrowStreamKCL ( oct_stream_t *st, uint n )
+{
+    // reserve 'n' elements and return a pointer to them
+
+    DASSERT(st);
+    if ( st->used + n > st->size )
+    {
+	st->size = st->size ? 2 * st->size : 0x100;
+	while ( st->used + n > st->size )
+	    st->size *= 2;
+	st->list = REALLOC( st->list, st->size * sizeof(*st->list) );
+    }
+    u32 *res = st->list + st->used;
+    st->used += n;
+    return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void SelectCube
+(
+    // Select the triangles of a cube and record the sub tree in 'st'.
+    // This function only reads 'oi' and is thread safe.
+
+    const oct_info_t	*oi,		// base data
+    oct_stream_t	*st,		// append the tokens to this stream
     kcl_cube_t		*cube,		// cube info
-    uint		depth		// current depth, also used for select level
+    uint		depth,		// current depth
+    const u32		*tidx,		// candidates: sorted list of triangle indices
+    uint		n_tidx		// number of elements in 'tidx'
 )
 {
+    // Only the triangles of the parent cube ('tidx') are tested.
+    // The triangles of this cube are passed to the sub cubes.
+
     DASSERT(oi);
     DASSERT(oi->kcl);
+    DASSERT(st);
     DASSERT(cube);
+    DASSERT( tidx || !n_tidx );
 
     noPRINT("CUBE*: min=%6u,%6u,%6u, max=%6u,%6u,%6u\n",
 	    cube->min[0], cube->min[1], cube->min[2],
 	    cube->max[0], cube->max[1], cube->max[2] );
 
-    uint tri_count = 0;
-
     const uint cube_blow = oi->kcl->cube_blow;
     cube->min[0] -= cube_blow;
     cube->min[1] -= cube_blow;
@@ -2829,28 +2987,31 @@ static u32 CalcCube
     cube->max[1] += cube_blow;
     cube->max[2] += cube_blow;
 
+    u32 *sel = n_tidx ? MALLOC( n_tidx * sizeof(*sel) ) : 0;
+    uint tri_count = 0;
+
  #if SUPPORT_KCL_CUBE
-    kcl_tri_t *tri, *end = oi->tri + oi->n_tri;
     kcl_cube_list_t *cl = oi->cubelist;
-    for ( tri = oi->tri ; tri < end; tri++ )
+    if (cl)
     {
-	if ( tri->select == depth && OctCubeTriangleOverlaped(cube,tri,cl) )
-	{
-	    tri->select++;
-	    tri_count++;
-	}
-	if (cl)
-	    cl++;
+	for ( uint i = 0; i < n_tidx; i++ )
+	    if (OctCubeTriangleOverlaped(cube,oi->tri+tidx[i],cl+tidx[i]))
+		sel[tri_count++] = tidx[i];
     }
- #else
-    kcl_tri_t *tri, *end = oi->tri + oi->n_tri;
-    for ( tri = oi->tri ; tri < end; tri++ )
-	if ( tri->select == depth && OctCubeTriangleOverlaped(cube,tri) )
+    else
+ #endif
+    {
+	// same calculation as OctCubeTriangleOverlaped(), but vectorized
+	soa_cube_t sc;
+	sc.half = ( cube->max[0] - cube->min[0] ) / 2;
+	for ( uint p = 0; p < 3; p++ )
 	{
-	    tri->select++;
-	    tri_count++;
+	    sc.min.v[p] = cube->min[p];
+	    sc.max.v[p] = cube->max[p];
+	    sc.mid.v[p] = cube->min[p] + (int)sc.half;
 	}
- #endif
+	tri_count = OverlapCubeTriSOA(&oi->soa,&sc,tidx,n_tidx,sel);
+    }
 
     cube->min[0] += cube_blow;
     cube->min[1] += cube_blow;
@@ -2871,43 +3032,10 @@ static u32 CalcCube
 		cube->min[0], cube->min[1], cube->min[2],
 		depth, kcl->max_octree_depth );
 
-	if (!tri_count)
-	    return 0;
-
-	if ( oi->tused + tri_count + 1 > oi->tsize )
-	{
-	    oi->tsize *= 2;
-	    TRACE("REALLOC(tlist), new size = %u\n",oi->tsize);
-	    oi->tlist = REALLOC( oi->tlist, oi->tsize * sizeof(*oi->tlist) );
-	}
-	u32 result = 0x80000000 | oi->tused * sizeof(*oi->tlist);
-
-	// create the list
-	u16 *tdata = oi->tlist + oi->tused;
-	u16 *tptr = tdata;
-	for ( tri = oi->tri ; tri < end; tri++ )
-	    if ( tri->select == depth )
-	    {
-		tri->select--;
-		write_be16( tptr++, tri - oi->tri + 1 );
-	    }
-	write_be16( tptr++, 0);
-	DASSERT( tptr - oi->tlist <= oi->tsize );
-	DASSERT( tptr - oi->tlist == oi->tused + tri_count + 1 );
-
-	if (!oi->kcl->fast)
-	{
-	    // try to find a duplicate
-	    u16 *tmax = tdata - tri_count - 1;
-	    const uint tsize = ( tri_count + 1 ) * sizeof(*oi->tlist);
-	    for ( tptr = oi->tlist; tptr <= tmax; tptr++ )
-		if (!memcmp(tptr,tdata,tsize))
-		    return ( tptr - oi->tlist ) * sizeof(*oi->tlist) | 0x80000000;
-	}
-
-	// no duplicate found
-	oi->tused += tri_count + 1;
-	return result;
+	u32 *dest = GrowStreamKCL(st,tri_count+1);
+	*dest++ = tri_count;
+	if (tri_count)
+	    memcpy(dest,sel,tri_count*sizeof(*dest));
     }
     else
     {
@@ -2916,16 +3044,7 @@ static u32 CalcCube
 		cube->min[0], cube->min[1], cube->min[2],
 		depth, kcl->max_octree_depth );
 
-	if ( oi->oused + 8 > oi->osize )
-	{
-	    oi->osize *= 2;
-	    TRACE("REALLOC(olist), new size = %u\n",oi->osize);
-	    oi->olist = REALLOC( oi->olist, oi->osize * sizeof(*oi->olist) );
-	}
-	u32 result = oi->oused * sizeof(*oi->olist);
-	uint ores = oi->oused;
-	oi->oused += 8;
-	DASSERT( oi->oused <= oi->osize );
+	*GrowStreamKCL(st,1) = OCT_SUBCUBE;
 
 	cube_size /= 2;
 	uint zi;
@@ -2944,19 +3063,172 @@ static u32 CalcCube
 		    subcube.max[1] = subcube.min[1] + cube_size;
 		    subcube.min[2] = cube->min[2] + zi * cube_size;
 		    subcube.max[2] = subcube.min[2] + cube_size;
-
-		    // 2 steps, because oi->olist may be realloced
-		    const u32 result = CalcCube(oi,&subcube,depth);
-		    oi->olist[ores++] = result;
+		    SelectCube(oi,st,&subcube,depth,sel,tri_count);
 		}
 	    }
 	}
+    }
+
+    FREE(sel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static u32 StoreCube
+(
+    // Store the sub tree recorded by SelectCube() into 'oi->olist' and
+    // 'oi->tlist'. The streams must be stored in order of the base cubes.
+
+    oct_info_t		*oi,		// base data
+    const u32		**ptr		// pointer to current stream position
+)
+{
+    DASSERT(oi);
+    DASSERT(ptr);
+    DASSERT(*ptr);
+
+    const u32 *tok = *ptr;
+    if ( *tok == OCT_SUBCUBE )
+    {
+	*ptr = tok + 1;
+
+	if ( oi->oused + 8 > oi->osize )
+	{
+	    oi->osize *= 2;
+	    TRACE("REALLOC(olist), new size = %u\n",oi->osize);
+	    oi->olist = REALLOC( oi->olist, oi->osize * sizeof(*oi->olist) );
+	}
+	u32 result = oi->oused * sizeof(*oi->olist);
+	uint ores = oi->oused;
+	oi->oused += 8;
+	DASSERT( oi->oused <= oi->osize );
 
-	for ( tri = oi->tri ; tri < end; tri++ )
-	    if ( tri->select == depth )
-		tri->select--;
+	uint i;
+	for ( i = 0; i < 8; i++ )
+	{
+	    // 2 steps, because oi->olist may be realloced
+	    const u32 result = StoreCube(oi,ptr);
+	    oi->olist[ores++] = result;
+	}
 	return result;
     }
+
+    const uint tri_count = *tok++;
+    const u32 *sel = tok;
+    *ptr = tok + tri_count;
+    if (!tri_count)
+	return 0;
+
+    if ( oi->tused + tri_count + 1 > oi->tsize )
+    {
+	while ( oi->tused + tri_count + 1 > oi->tsize )
+	    oi->tsize *= 2;
+	TRACE("REALLOC(tlist), new size = %u\n",oi->tsize);
+	oi->tlist = REALLOC( oi->tlist, oi->tsize * sizeof(*oi->tlist) );
+	if (oi->thash)
+	{
+	    oi->thash = REALLOC( oi->thash, oi->tsize * sizeof(*oi->thash) );
+	    oi->tnext = REALLOC( oi->tnext, oi->tsize * sizeof(*oi->tnext) );
+	}
+    }
+    u32 result = 0x80000000 | oi->tused * sizeof(*oi->tlist);
+
+    // create the list
+    u16 *tdata = oi->tlist + oi->tused;
+    u16 *tptr = tdata;
+    for ( uint i = 0; i < tri_count; i++ )
+	write_be16( tptr++, sel[i] + 1 );
+    write_be16( tptr++, 0);
+    DASSERT( tptr - oi->tlist <= oi->tsize );
+    DASSERT( tptr - oi->tlist == oi->tused + tri_count + 1 );
+
+    if (oi->thash)
+    {
+	// calculate the hashes of all suffixes, then try to find a duplicate
+	u32 *hptr = oi->thash + oi->tused + tri_count;
+	u32 hash = HashTriListKCL(0x811c9dc5,0);
+	*hptr = hash;
+	for ( int i = tri_count - 1; i >= 0; i-- )
+	    *--hptr = hash = HashTriListKCL(hash,tdata[i]);
+
+	const int found = FindTriListKCL(oi,tdata,tri_count+1,hash);
+	if ( found >= 0 )
+	    return found * sizeof(*oi->tlist) | 0x80000000;
+
+	// no duplicate found
+	InsertTriListKCL(oi,tri_count+1);
+    }
+    else
+	oi->tused += tri_count + 1;
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void SelectBaseCube
+(
+    const oct_job_t	*job,		// job data
+    oct_stream_t	*st,		// valid stream, will be reset
+    uint		ci		// index of base cube
+)
+{
+    DASSERT(job);
+    DASSERT(st);
+    DASSERT( ci < job->n_cubes );
+
+    const uint xi = ci % job->xn;
+    const uint yi = ci / job->xn % job->yn;
+    const uint zi = ci / job->xn / job->yn;
+
+    kcl_cube_t cube;
+    cube.min[0] = xi * job->cube_size;
+    cube.max[0] = cube.min[0] + job->cube_size;
+    cube.min[1] = yi * job->cube_size;
+    cube.max[1] = cube.min[1] + job->cube_size;
+    cube.min[2] = zi * job->cube_size;
+    cube.max[2] = cube.min[2] + job->cube_size;
+
+    st->used = 0;
+    SelectCube( job->oi, st, &cube, 0,
+		job->bidx + job->bstart[ci], job->bstart[ci+1] - job->bstart[ci] );
+}
+
+//-----------------------------------------------------------------------------
+
+static void * SelectCubeJobKCL ( void *param )
+{
+    const oct_job_t *job = param;
+    DASSERT(job);
+
+    for ( uint ci = job->first; ci < job->n_cubes; ci += job->step )
+	SelectBaseCube(job,job->stream+ci,ci);
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline bool GetBaseCubeRange
+(
+    // returns false, if the range is empty
+
+    uint		*r,		// store first and last index here
+    const kcl_tri_t	*tri,		// valid triangle
+    uint		coord,		// coordinate index 0..2
+    uint		cube_size,	// size of base cubes
+    uint		n_cubes,	// number of base cubes in this direction
+    uint		cube_blow	// value of kcl->cube_blow
+)
+{
+    // calculate a superset of the base cubes touched by the bounding box
+
+    const int lo = floor( (double)( tri->cube.min[coord] - (int)cube_blow ) / cube_size ) - 1;
+    const int hi = floor( (double)( tri->cube.max[coord] + (int)cube_blow ) / cube_size );
+    if ( hi < 0 || lo >= (int)n_cubes )
+	return false;
+
+    r[0] = lo < 0 ? 0 : lo;
+    r[1] = hi < (int)n_cubes ? hi : (int)n_cubes - 1;
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3130,6 +3402,13 @@ enumError CreateOctreeKCL
     oi.tused	= 0;
     oi.tlist	= CALLOC(oi.tsize,sizeof(*oi.tlist));
 
+    if (!kcl->fast)
+    {
+	oi.thash = CALLOC(oi.tsize,sizeof(*oi.thash));
+	oi.tnext = CALLOC(oi.tsize,sizeof(*oi.tnext));
+	RehashTriListKCL(&oi,0x1000);
+    }
+
     if ( verbose >= 0 && !(KCL_MODE & KCLMD_SILENT) && !kcl->silent_octree )
 	fprintf(stdlog,
 		"  - create octree: rshift=%u, n_bcube=%u, cube_size=%u..%u, blow=%u,"
@@ -3138,6 +3417,8 @@ enumError CreateOctreeKCL
 		kcl->min_cube_size, kcl->max_cube_size, kcl->cube_blow,
 		kcl->max_cube_triangles, kcl->max_octree_depth, kcl->fast);
 
+    SetupTriSOA(&oi.soa,oi.n_tri);
+
     uint t;
     kcl_tri_t *tri = oi.tri;
     const kcl_tridata_t *td = (kcl_tridata_t*)kcl->tridata.list;
@@ -3148,6 +3429,11 @@ enumError CreateOctreeKCL
      #else
 	setup_oct_tri(kcl,tri,td);
      #endif
+
+	double3 pt[3];
+	for ( p = 0; p < 9; p++ )
+	    pt[p/3].v[p%3] = tri->pt[p/3][p%3];
+	SetTriSOA(&oi.soa,t,pt+0,pt+1,pt+2);
 	noPRINT("%5u: min=%5d,%5d,%5d, max=%5d,%5d,%5d, select=%d\n",
 	    t,
 	    tri->min[0], tri->min[1], tri->min[2],
@@ -3156,32 +3442,132 @@ enumError CreateOctreeKCL
     }
 
 
-    //--- now create the octree (start recursion)
+    //--- assign the triangles to the base cubes by their bounding boxes
 
     const uint cube_size = 1 << rshift;
+    const uint blow = kcl->cube_blow;
 
-    uint zi;
-    for ( zi = 0; zi < zn; zi++ )
+    // pass 1 counts the triangles for each base cube, pass 2 stores
+    // the triangle indices in ascending order.
+
+    u32 *bstart = CALLOC(n_cubes+1,sizeof(*bstart));
+    u32 *bidx = 0, *bpos = 0;
+
+    uint pass;
+    for ( pass = 0; pass < 2; pass++ )
     {
-	uint yi;
-	for ( yi = 0; yi < yn; yi++ )
+	if (pass)
 	{
-	    uint xi;
-	    for ( xi = 0; xi < xn; xi++ )
-	    {
-		kcl_cube_t cube;
-		cube.min[0] = xi * cube_size;
-		cube.max[0] = cube.min[0] + cube_size;
-		cube.min[1] = yi * cube_size;
-		cube.max[1] = cube.min[1] + cube_size;
-		cube.min[2] = zi * cube_size;
-		cube.max[2] = cube.min[2] + cube_size;
+	    for ( p = 0; p < n_cubes; p++ )
+		bstart[p+1] += bstart[p];
+	    bidx = MALLOC( ( bstart[n_cubes] + 1 ) * sizeof(*bidx) );
+	    bpos = MEMDUP( bstart, n_cubes * sizeof(*bpos) );
+	}
+
+	for ( t = 0, tri = oi.tri; t < oi.n_tri; t++, tri++ )
+	{
+	    if ( tri->select == M1(tri->select) )
+		continue;
 
-		// 2 steps, because oi.olist may be realloced
-		const u32 result = CalcCube(&oi,&cube,0);
-		oi.olist[ores++] = result;
+	    uint rx[2], ry[2], rz[2];
+	    if (   !GetBaseCubeRange(rx,tri,0,cube_size,xn,blow)
+		|| !GetBaseCubeRange(ry,tri,1,cube_size,yn,blow)
+		|| !GetBaseCubeRange(rz,tri,2,cube_size,zn,blow) )
+	    {
+		continue;
 	    }
+
+	    uint zi, yi, xi;
+	    for ( zi = rz[0]; zi <= rz[1]; zi++ )
+		for ( yi = ry[0]; yi <= ry[1]; yi++ )
+		    for ( xi = rx[0]; xi <= rx[1]; xi++ )
+		    {
+			const uint ci = ( zi * yn + yi ) * xn + xi;
+			if (pass)
+			    bidx[bpos[ci]++] = t;
+			else
+			    bstart[ci+1]++;
+		    }
+	}
+    }
+    FREE(bpos);
+
+
+    //--- now create the octree (start recursion)
+
+    oct_job_t job0;
+    memset(&job0,0,sizeof(job0));
+    job0.oi		= &oi;
+    job0.bstart		= bstart;
+    job0.bidx		= bidx;
+    job0.xn		= xn;
+    job0.yn		= yn;
+    job0.n_cubes	= n_cubes;
+    job0.cube_size	= cube_size;
+    job0.step		= 1;
+
+    uint n_threads = opt_kcl_threads < n_cubes ? opt_kcl_threads : n_cubes;
+    if ( n_threads > 1 )
+    {
+	// select the triangles of the base cubes by threads, job #0 is done
+	// by the current thread. Then store the streams in order.
+
+	if ( logging >= 1 )
+	    fprintf(stdlog,">>KCL octree: %u base cubes, %u threads\n",
+			n_cubes, n_threads );
+
+	oct_stream_t *stream = CALLOC(n_cubes,sizeof(*stream));
+	oct_job_t *job = CALLOC(n_threads,sizeof(*job));
+	pthread_t *tid = CALLOC(n_threads,sizeof(*tid));
+	bool *started = CALLOC(n_threads,sizeof(*started));
+
+	for ( t = 0; t < n_threads; t++ )
+	{
+	    job[t]	  = job0;
+	    job[t].stream = stream;
+	    job[t].first  = t;
+	    job[t].step	  = n_threads;
+	}
+
+	for ( t = 1; t < n_threads; t++ )
+	    started[t] = !pthread_create(tid+t,0,SelectCubeJobKCL,job+t);
+	SelectCubeJobKCL(job);
+
+	for ( t = 1; t < n_threads; t++ )
+	{
+	    if (started[t])
+		pthread_join(tid[t],0);
+	    else
+		SelectCubeJobKCL(job+t);
+	}
+
+	for ( ores = 0; ores < n_cubes; ores++ )
+	{
+	    // 2 steps, because oi.olist may be realloced
+	    const u32 *ptr = stream[ores].list;
+	    const u32 result = StoreCube(&oi,&ptr);
+	    oi.olist[ores] = result;
+	    FREE(stream[ores].list);
+	}
+
+	FREE(started);
+	FREE(tid);
+	FREE(job);
+	FREE(stream);
+    }
+    else
+    {
+	oct_stream_t stream = {0};
+	for ( ores = 0; ores < n_cubes; ores++ )
+	{
+	    SelectBaseCube(&job0,&stream,ores);
+
+	    // 2 steps, because oi.olist may be realloced
+	    const u32 *ptr = stream.list;
+	    const u32 result = StoreCube(&oi,&ptr);
+	    oi.olist[ores] = result;
 	}
+	FREE(stream.list);
     }
 
     PRINT("*** O-USED = %u, T-USED = %u, n_CUBES = %u\n",oi.oused,oi.tused,n_cubes);
@@ -3238,6 +3624,12 @@ enumError CreateOctreeKCL
 
     //FREE(oi.olist); don't free this. it's already realloced!
     FREE(oi.tlist);
+    FREE(oi.thash);
+    FREE(oi.tnext);
+    FREE(oi.thead);
+    ResetTriSOA(&oi.soa);
+    FREE(bstart);
+    FREE(bidx);
  #if SUPPORT_KCL_CUBE
     FREE(oi.cubelist);
  #endif
@@ -4285,6 +4677,15 @@ ccp kcl_auto_ref_fname = 0;
 
 int ScanOptLoadKcl ( ccp arg )
 {
+    if ( kcl_ref && ( !kcl_ref_fname || !arg || strcmp(kcl_ref_fname,arg) ) )
+    {
+	// loaded from another file (server mode) => reload on demand
+	PRINT("UNLOAD REF KCL\n");
+	ResetKCL(kcl_ref);
+	FREE(kcl_ref);
+	kcl_ref = 0;
+    }
+
     kcl_ref_fname = arg;
     SetupReferenceKCL(0);
     return 0;
@@ -4470,7 +4871,7 @@ static enumError F_kcl_fall_flag
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static enumError F_isKCL
+static enumError F_kcl_flag
 (
     struct Var_t	* res,		// store result here
     struct Var_t	* param,	// parameters, modified
@@ -4481,19 +4882,59 @@ static enumError F_isKCL
 {
     DASSERT(res);
     DASSERT(param);
+    DASSERT(n_param>=1);
 
-    uint result = 0;
-    if ( si && si->kcl )
+    int flag = -1;
+    kcl_t *kcl = GetReferenceKCL();
+    if ( !kcl && si )
+	kcl = si->kcl;
+    if (kcl)
     {
-	result = 1;
-
-	if (si->kcl->fname)
-	{
-	    ccp fname = strrchr(si->kcl->fname,'/');
-	    if (fname)
-		fname++;
-	    else
-		fname = si->kcl->fname;
+	ToVectorV(param);
+	kcl_query_t query;
+	memset(&query,0,sizeof(query));
+	query.pt = param->d3;
+
+	const uint width = n_param > 1 && param[1].mode != VAR_UNSET
+			? GetIntV(param+1) : 1;
+	u32 typemask = n_param > 2 && param[2].mode != VAR_UNSET
+			? GetIntV(param+2)
+			: M1(typemask);
+	FlagListKCL(kcl,&query,1,width,typemask);
+	flag = query.kcl_flag;
+    }
+
+    res->i    = flag;
+    res->mode = VAR_INT;
+    return ERR_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError F_isKCL
+(
+    struct Var_t	* res,		// store result here
+    struct Var_t	* param,	// parameters, modified
+    uint		n_param,	// number of parameters
+    struct ScanInfo_t	* si,		// not NULL: use for error messages
+    const FuncParam_t	* fpar		// pointer to user parameter
+)
+{
+    DASSERT(res);
+    DASSERT(param);
+
+    uint result = 0;
+    if ( si && si->kcl )
+    {
+	result = 1;
+
+	if (si->kcl->fname)
+	{
+	    ccp fname = strrchr(si->kcl->fname,'/');
+	    if (fname)
+		fname++;
+	    else
+		fname = si->kcl->fname;
 
 	    if ( !strcasecmp(fname,"course.kcl")
 		|| !strcasecmp(fname,"course.txt")
@@ -4530,6 +4971,17 @@ static const struct FuncTable_t kcl_ref_func_tab[] =
 	" The return value is the KCL flag of the colliding triangle,"
 	" or -1 if no collision was found." },
 
+    { 1, 3, "KCL$FLAG", F_kcl_flag, 0,
+	"int", "kcl$flag(pt[,width[,typemask]])",
+	" If a reference KCL is defined, return the KCL flag of the first"
+	" triangle, that collides with a cube of edge length 'width'"
+	" (default 1) around 'pt'."
+	" The octree cube of 'pt' is searched first,"
+	" and then all other octree cubes overlapped by the cube."
+	" If 'typemask' is set, only KCL types with related bit number set"
+	" are recognized."
+	" The result is -1 if no collision was found." },
+
     { 0, 0, "ISKCL", F_isKCL, 0,	// replace only function call
 	"int", "isKCL()", 0 },		// but not info
 
@@ -6074,30 +6526,23 @@ static int TraverseOctree
 
 ///////////////////////////////////////////////////////////////////////////////
 
-enumError TraverseOctreeKCL
+static void PrintTriList
 (
+    // print a triangle list found by TraverseOctree()
+
     kcl_t		*kcl,		// pointer to valid KCL
-    FILE		*f,		// output file, if NULL set verbosity:=0
-    double3		pt,		// point to analyze
-    bool		print_tri_val,	// true: print tri values instead of index
-    uint		verbosity	// verbose level
-					//   >=1: print base calculations
-					//   >=2: print step calculations
+    FILE		*f,		// output file
+    double3		pt,		// searched point
+    u16			*tri_ptr,	// triangle list
+    int			stat,		// number of triangles in 'tri_ptr'
+    bool		print_tri_val	// true: print tri values instead of index
 )
 {
     DASSERT(kcl);
-    CreateOctreeKCL(kcl);
-    u16 *tri_ptr;
-    int stat = TraverseOctree(kcl,f,pt,verbosity+1,0,0,&tri_ptr);
-    if ( stat < 0 )
-	return ERR_WARNING;
+    DASSERT(f);
 
     const int fw_tlist = GetTermWidth(80,40) - 7;
 
-    if (!f)
-	verbosity = 0;
-    else if (verbosity>0)
-	fputc('\n',f);
     fprintf(f,"List with %u triangles found at offset %#x\n",
 		stat, (int)((u8*)tri_ptr - kcl->octree) );
 
@@ -6145,15 +6590,247 @@ enumError TraverseOctreeKCL
 	}
     }
     fputs("\n\n",f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+enumError TraverseOctreeKCL
+(
+    kcl_t		*kcl,		// pointer to valid KCL
+    FILE		*f,		// output file, if NULL set verbosity:=0
+    double3		pt,		// point to analyze
+    bool		print_tri_val,	// true: print tri values instead of index
+    uint		verbosity	// verbose level
+					//   >=1: print base calculations
+					//   >=2: print step calculations
+)
+{
+    DASSERT(kcl);
+    CreateOctreeKCL(kcl);
+    u16 *tri_ptr;
+    int stat = TraverseOctree(kcl,f,pt,verbosity+1,0,0,&tri_ptr);
+    if ( stat < 0 )
+	return ERR_WARNING;
+
+    if (!f)
+	verbosity = 0;
+    else if (verbosity>0)
+	fputc('\n',f);
+    PrintTriList(kcl,f,pt,tri_ptr,stat,print_tri_val);
     return ERR_OK;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			octree cursor			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// An octree cursor remembers the path of the last traversal. The next
+// traversal continues at the deepest node, that the new point shares with
+// the previous one. It is used by TraverseListKCL() and FallKCL().
+
+typedef struct kcl_query_level_t
+{
+    u32		baseoff;		// base offset of the current node list
+    u32		offset;			// offset of the current node
+    u32		idx_mask;		// width of the current cube
+    u32		child;			// child index used to leave this level
+    double3	add;			// offset of the cube relative to base cube
+
+} kcl_query_level_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct kcl_octree_cursor_t
+{
+    kcl_query_level_t level[34];	// path of the last traversal
+    uint	n_level;		// number of valid levels, 0: none
+    u32		prev_index;		// index of the base cube of 'level'
+
+} kcl_octree_cursor_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool GetOctreeBaseKCL
+(
+    // Calculate the rounded octree coordinates of a point with the same
+    // conditions as TraverseOctree(). Returns false, if the point is
+    // outside of the octree.
+
+    const kcl_t		*kcl,		// valid KCL
+    const double3	*pt,		// point to analyze
+    u32			*base		// store 3 coordinates here
+)
+{
+    DASSERT(kcl);
+    DASSERT(pt);
+    DASSERT(base);
+
+    if (   pt->x < kcl->min_octree.x
+	|| pt->y < kcl->min_octree.y
+	|| pt->z < kcl->min_octree.z )
+    {
+	return false;
+    }
+
+    double3 basept;
+    Sub3(basept,*pt,kcl->min_octree);
+    if ( basept.x > 2e9 || basept.y > 2e9 || basept.z > 2e9 )
+	return false;
+
+    uint p, failed = 0;
+    for ( p = 0; p < 3; p++ )
+    {
+	base[p] = round(basept.v[p]);
+	if ( base[p] & kcl->mask[p] )
+	    failed++;
+    }
+    return !failed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int TraverseCursorKCL
+(
+    // Same as TraverseOctree() without logging, but continue the traversal
+    // of the previous call at the deepest shared node.
+    // returns	 -1: octree invalid or octree data invalid
+    //		>=0: number of triangles
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_octree_cursor_t	*cur,		// valid cursor, 'n_level=0' for a new one
+    double3		pt,		// point to analyze
+    double3		*cube_min,	// store cube data here
+    uint		*cube_width,	// store cube width here
+    u16			**tri_list	// store pointer to triangle list here
+)
+{
+    DASSERT(kcl);
+    DASSERT(cur);
+    DASSERT( cube_min && cube_width && tri_list );
+
+    memset(cube_min,0,sizeof(*cube_min));
+    *cube_width = 0;
+    *tri_list = 0;
+
+    if ( !kcl->octree || !kcl->octree_valid )
+	return -1;
+
+    u32 base[3];
+    if (!GetOctreeBaseKCL(kcl,&pt,base))
+    {
+	cur->n_level = 0;
+	return 0;
+    }
+
+    const u32 oct_index = base[0] >> kcl->coord_rshift
+			| base[1] >> kcl->coord_rshift << kcl->y_lshift
+			| base[2] >> kcl->coord_rshift << kcl->z_lshift;
+
+    //--- find the deepest node shared with the previous point
+
+    kcl_query_level_t *level = cur->level;
+    uint lev = 0;
+    if ( cur->n_level && oct_index == cur->prev_index )
+    {
+	for ( ; lev < cur->n_level - 1; lev++ )
+	{
+	    const u32 mask = level[lev].idx_mask >> 1;
+	    const u32 child = ( base[0] & mask ? 1 : 0 )
+			    | ( base[1] & mask ? 2 : 0 )
+			    | ( base[2] & mask ? 4 : 0 );
+	    if ( child != level[lev].child )
+		break;
+	}
+    }
+    else
+    {
+	memset(level,0,sizeof(*level));
+	level[0].offset   = oct_index * 4;
+	level[0].idx_mask = 1 << kcl->coord_rshift;
+    }
+    cur->prev_index = oct_index;
+    cur->n_level = 0;
+
+
+    //--- traverse the octree, same checks as TraverseOctree()
+
+    for (;;)
+    {
+	kcl_query_level_t *l = level + lev;
+	if ( l->baseoff + 0x20 > kcl->octree_size || l->offset & 3 )
+	    return -1;
+
+	const u32 val = be32( kcl->octree + l->offset );
+	if ( val & 0x80000000 )
+	{
+	    const u32 offset = l->baseoff + ( val & 0x7ffffff ) + 2;
+	    if ( offset+2 > kcl->octree_size || offset & 1 )
+		return -1;
+
+	    double3 basept;
+	    Sub3(basept,pt,kcl->min_octree);
+	    for ( uint p = 0; p < 3; p++ )
+		cube_min->v[p] = trunc( basept.v[p] / level->idx_mask )
+				* level->idx_mask
+				+ kcl->min_octree.v[p] + l->add.v[p];
+	    *cube_width = l->idx_mask;
+	    *tri_list = (u16*)( kcl->octree + offset );
+
+	    u32 off;
+	    for ( off = offset; off < kcl->octree_size; off += 2 )
+		if (!be16( kcl->octree + off ))
+		    break;
+	    cur->n_level = lev + 1;
+	    return ( off - offset ) / 2;
+	}
+
+	if ( lev + 1 >= sizeof(cur->level)/sizeof(*cur->level) )
+	    return -1;
+
+	kcl_query_level_t *next = l + 1;
+	next->idx_mask = l->idx_mask >> 1;
+	next->add = l->add;
+	l->child = 0;
+	for ( uint p = 0; p < 3; p++ )
+	    if ( next->idx_mask & base[p] )
+	    {
+		l->child |= 1 << p;
+		next->add.v[p] += next->idx_mask;
+	    }
+	next->baseoff = l->baseoff + val;
+	next->offset  = next->baseoff + 4 * l->child;
+	lev++;
+    }
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			FallKCL()			///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 #define N_FALL_LIST 10
+#define N_FALL_LINE 7
+#define N_FALL_SEEN 16
+#define FALL_EPS    1e-7
+
+//-----------------------------------------------------------------------------
+
+typedef struct kcl_fall_line_t
+{
+    double	x, z;			// x and z of a sample point of Collide1()
+    int		next;			// next octree y coordinate to scan, <0: done
+
+} kcl_fall_line_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct kcl_fall_range_t
+{
+    double	ymin, ymax;		// range of 'y' for Collide1(), that
+					// may find a triangle
+} kcl_fall_range_t;
+
+//-----------------------------------------------------------------------------
 
 typedef struct kcl_fall_t
 {
@@ -6161,6 +6838,7 @@ typedef struct kcl_fall_t
     FILE	*f;			// log file
     int		verbose;		// verbose level
     u32		type_mask;		// kcl type selector (bit field)
+    kcl_octree_cursor_t *cursor;	// cursor for TraverseCursorKCL()
 
     kcl_cube_t	cube;			// cube to test
     uint	width;			// width of cube
@@ -6172,75 +6850,860 @@ typedef struct kcl_fall_t
     double3	last_min;		// last traversed cube min
     uint	last_width;		// last traversed cube width
 
-} kcl_fall_t;
+    //--- column scan, see fall_find()
+
+    kcl_fall_line_t line[N_FALL_LINE];	// vertical lines of the sample points
+    double	col_min[3];		// absolute column of the cube, x and z only,
+    double	col_max[3];		//   extended by 1.0 for rounding issues
+    uint	n_line;			// number of valid 'line'
+    int		walked;			// all octree cubes at and above this
+					// y coordinate are scanned
+
+    u16		*seen[N_FALL_SEEN];	// recently scanned triangle lists
+    uint	seen_idx;		// next index to store into 'seen'
+
+    kcl_fall_range_t *range;		// list of ranges, where a hit is possible
+    uint	n_range;		// number of used elements in 'range'
+    uint	size_range;		// number of alloced elements in 'range'
+    kcl_fall_range_t range_buf[64];	// static buffer for 'range'
+
+} kcl_fall_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int fall_traverse
+(
+    // Call TraverseOctree() if logging is enabled,
+    // and TraverseCursorKCL() otherwise.
+
+    kcl_fall_t		*kf,		// valid data
+    double3		pt,		// point to analyze
+    double3		*cube_min,	// store cube data here
+    uint		*cube_width,	// store cube width here
+    u16			**tri_list	// store pointer to triangle list here
+)
+{
+    DASSERT(kf);
+    return kf->verbose > 1
+	? TraverseOctree(kf->kcl,kf->f,pt,kf->verbose-1,
+				cube_min,cube_width,tri_list)
+	: TraverseCursorKCL(kf->kcl,kf->cursor,pt,
+				cube_min,cube_width,tri_list);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int Collide2
+(
+    kcl_fall_t		*kf,		// valid data
+    double3		pt		// point for octree search
+)
+{
+    DASSERT(kf);
+    noPRINT("Collide2() n=%u, v=%d, pt=%.0f %.0f %.0f\n",
+	    kf->n_tri_list, kf->last_valid, pt.x, pt.y, pt.z );
+
+
+    //--- test if point is in previous cube
+
+    if ( kf->last_valid
+	&& pt.x >= kf->last_min.x && pt.x <= kf->last_min.x + kf->last_width
+	&& pt.y >= kf->last_min.y && pt.y <= kf->last_min.y + kf->last_width
+	&& pt.z >= kf->last_min.z && pt.z <= kf->last_min.z + kf->last_width
+       )
+    {
+	return -1;
+    }
+
+    //--- find tri list
+
+    u16 *tri_list;
+    int stat = fall_traverse(kf,pt,&kf->last_min,&kf->last_width,&tri_list);
+    if ( stat < 0 )
+	return -1;
+
+    kf->last_valid = true;
+    if ( !tri_list || !*tri_list )
+	return -1;
+
+    uint i;
+    for ( i = 0; i < kf->n_tri_list; i++ )
+	if (kf->tri_list[i] == tri_list )
+	    return -1;
+
+    if ( kf->n_tri_list < N_FALL_LIST )
+	kf->tri_list[kf->n_tri_list++] = tri_list;
+
+    uint ti;
+    for ( ti = 0; ti < stat; ti++ )
+    {
+	DASSERT(tri_list);
+	uint tidx = be16(tri_list+ti);
+	if (!tidx--)
+	    break;
+	if ( tidx >= kf->kcl->tridata.used )
+	    continue;
+
+	const kcl_tridata_t *td = (kcl_tridata_t*)kf->kcl->tridata.list + tidx;
+	if ( td->cur_flag >= N_KCL_TYPE || ( 1u << (td->cur_flag&0x1f) & kf->type_mask ) )
+	{
+	    kcl_tri_t ot;
+	 #if SUPPORT_KCL_CUBE
+	    setup_oct_tri(kf->kcl,&ot,0,td); // use [[cube]] list param?
+	    if (OctCubeTriangleOverlaped(&kf->cube,&ot,0)) // [use [[cube]] list param?
+		return td->cur_flag;
+	 #else
+	    setup_oct_tri(kf->kcl,&ot,td);
+	    if (OctCubeTriangleOverlaped(&kf->cube,&ot))
+		return td->cur_flag;
+	 #endif
+	}
+    }
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int Collide1
+(
+    kcl_fall_t		*kf,		// valid data
+    double		y		// y point to test
+)
+{
+    DASSERT(kf);
+    kf->n_tri_list = 0;
+    kf->last_valid = false;
+
+    kf->cube.min[1] = round ( y - kf->kcl->min_octree.y );
+    kf->cube.max[1] = kf->cube.min[1] + kf->width;
+
+    noPRINT("OCT=%d,%d,%d .. %d,%d,%d\n",
+		kf->cube.min[0], kf->cube.min[1], kf->cube.min[2],
+		kf->cube.max[0], kf->cube.max[1], kf->cube.max[2] );
+
+    double3 pt;
+    double3 *min = &kf->kcl->min_octree;
+    pt.x = min->x + ( kf->cube.min[0] + kf->cube.max[0] ) / 2;
+    pt.y = min->y +   kf->cube.min[1];
+    pt.z = min->z + ( kf->cube.min[2] + kf->cube.max[2] ) / 2;
+    int stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.x = min->x + kf->cube.min[0];
+    pt.z = min->z + kf->cube.min[2];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.z = min->z + kf->cube.max[2];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.x = min->x + kf->cube.max[0];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.z = min->z + kf->cube.min[2];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.y = min->y + kf->cube.max[1];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.z = min->z + kf->cube.max[2];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.x = min->y + kf->cube.min[0];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.z = min->z + kf->cube.min[2];
+    stat = Collide2(kf,pt);
+    if ( stat >= 0 )
+	return stat;
+
+    pt.x = min->x + ( kf->cube.min[0] + kf->cube.max[0] ) / 2;
+    pt.z = min->z + ( kf->cube.min[2] + kf->cube.max[2] ) / 2;
+    return Collide2(kf,pt);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Collide1() is the reference for all collision tests, but a fall search
+// calls it only at heights, where a hit is possible at all. For this, the
+// octree is scanned once top-down along the vertical lines of all sample
+// points of Collide1(). Each found triangle is clipped by the column of the
+// cube to get the range of heights, where it may collide.
+
+static uint fall_clip
+(
+    // clip a convex polygon by a plane, that is orthogonal to an axis
+
+    double3		*dest,		// destination, at least n+1 elements
+    const double3	*src,		// source polygon
+    uint		n,		// number of points in 'src'
+    uint		p,		// coordinate index: 0=x, 1=y, 2=z
+    double		limit,		// clip limit
+    double		sign		// +1.0: keep v>=limit, -1.0: keep v<=limit
+)
+{
+    DASSERT( dest && src );
+    if (!n)
+	return 0;
+
+    uint n_dest = 0;
+    const double3 *prev = src + n - 1;
+    double dprev = sign * ( prev->v[p] - limit );
+
+    for ( uint i = 0; i < n; i++ )
+    {
+	const double3 *cur = src + i;
+	const double dcur = sign * ( cur->v[p] - limit );
+	if ( ( dcur >= 0.0 ) != ( dprev >= 0.0 ) )
+	{
+	    const double t = dprev / ( dprev - dcur );
+	    double3 *d = dest + n_dest++;
+	    d->x = prev->x + t * ( cur->x - prev->x );
+	    d->y = prev->y + t * ( cur->y - prev->y );
+	    d->z = prev->z + t * ( cur->z - prev->z );
+	    d->v[p] = limit;
+	}
+	if ( dcur >= 0.0 )
+	    dest[n_dest++] = *cur;
+	prev  = cur;
+	dprev = dcur;
+    }
+    return n_dest;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void fall_add_triangle
+(
+    kcl_fall_t		*kf,		// valid data
+    uint		tidx		// valid triangle index
+)
+{
+    DASSERT(kf);
+    DASSERT( tidx < kf->kcl->tridata.used );
+
+    const kcl_tridata_t *td = (kcl_tridata_t*)kf->kcl->tridata.list + tidx;
+    if ( td->cur_flag < N_KCL_TYPE && !( 1u << (td->cur_flag&0x1f) & kf->type_mask ) )
+	return;
+
+    // fast test by the unrounded coordinates
+    const double3 *d3 = td->pt;
+    for ( uint p = 0; p < 3; p += 2 )
+    {
+	if (   d3[0].v[p] < kf->col_min[p] && d3[1].v[p] < kf->col_min[p]
+	    && d3[2].v[p] < kf->col_min[p]
+	    || d3[0].v[p] > kf->col_max[p] && d3[1].v[p] > kf->col_max[p]
+	    && d3[2].v[p] > kf->col_max[p] )
+	{
+	    return;
+	}
+    }
+
+    kcl_tri_t ot;
+ #if SUPPORT_KCL_CUBE
+    setup_oct_tri(kf->kcl,&ot,0,td);
+ #else
+    setup_oct_tri(kf->kcl,&ot,td);
+ #endif
+
+    //--- bullet 1 of OctCubeTriangleOverlaped(), x and z only
+
+    const kcl_cube_t *cube = &kf->cube;
+    if ( ot.select == M1(ot.select)
+	|| ot.cube.min[0] > cube->max[0] || ot.cube.max[0] < cube->min[0]
+	|| ot.cube.min[2] > cube->max[2] || ot.cube.max[2] < cube->min[2] )
+    {
+	return;
+    }
+
+    //--- clip by the column of the separating axis tests
+
+    const int cubehalf = kf->width / 2;
+    double3 buf1[8], buf2[8];
+    for ( uint i = 0; i < 3; i++ )
+    {
+	buf1[i].x = ot.pt[i][0];
+	buf1[i].y = ot.pt[i][1];
+	buf1[i].z = ot.pt[i][2];
+    }
+
+    uint n = fall_clip(buf2,buf1,3,0,cube->min[0]-FALL_EPS,+1.0);
+    n = fall_clip(buf1,buf2,n,0,cube->min[0]+2*cubehalf+FALL_EPS,-1.0);
+    n = fall_clip(buf2,buf1,n,2,cube->min[2]-FALL_EPS,+1.0);
+    n = fall_clip(buf1,buf2,n,2,cube->min[2]+2*cubehalf+FALL_EPS,-1.0);
+    if (!n)
+	return;
+
+    double ymin = buf1[0].y, ymax = ymin;
+    for ( uint i = 1; i < n; i++ )
+    {
+	if ( ymin > buf1[i].y )
+	     ymin = buf1[i].y;
+	if ( ymax < buf1[i].y )
+	     ymax = buf1[i].y;
+    }
+
+    //--- possible values of 'cube.min[1]', then convert to 'y' of Collide1()
+
+    double cmin = ymin - 2*cubehalf;
+    if ( cmin < ot.cube.min[1] - (int)kf->width )
+	 cmin = ot.cube.min[1] - (int)kf->width;
+    double cmax = ymax < ot.cube.max[1] ? ymax : ot.cube.max[1];
+    cmin = ceil( cmin - FALL_EPS );
+    cmax = floor( cmax + FALL_EPS );
+    if ( cmin > cmax )
+	return;
+
+    if ( kf->n_range == kf->size_range )
+    {
+	kf->size_range *= 2;
+	if ( kf->range == kf->range_buf )
+	{
+	    kf->range = MALLOC( kf->size_range * sizeof(*kf->range) );
+	    memcpy(kf->range,kf->range_buf,sizeof(kf->range_buf));
+	}
+	else
+	    kf->range = REALLOC( kf->range, kf->size_range * sizeof(*kf->range) );
+    }
+
+    kcl_fall_range_t *r = kf->range + kf->n_range++;
+    r->ymin = kf->kcl->min_octree.y + cmin - 0.5 - FALL_EPS;
+    r->ymax = kf->kcl->min_octree.y + cmax + 0.5 + FALL_EPS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void fall_walk
+(
+    // scan all octree cubes of all lines down to y coordinate 'target'
+
+    kcl_fall_t		*kf,		// valid data
+    int			target		// minimal octree y coordinate to scan
+)
+{
+    DASSERT(kf);
+    kcl_t *kcl = kf->kcl;
+
+    for ( uint l = 0; l < kf->n_line; l++ )
+    {
+	kcl_fall_line_t *line = kf->line + l;
+	while ( line->next >= target )
+	{
+	    double3 pt, cube_min;
+	    pt.x = line->x;
+	    pt.y = kcl->min_octree.y + line->next;
+	    pt.z = line->z;
+
+	    uint cube_width;
+	    u16 *tri_list;
+	    int stat = fall_traverse(kf,pt,&cube_min,&cube_width,&tri_list);
+	    if ( stat < 0 || !cube_width )
+	    {
+		line->next = -1;
+		break;
+	    }
+	    line->next = (int)round( cube_min.y - kcl->min_octree.y ) - 1;
+	    if ( !stat || !tri_list )
+		continue;
+
+	    uint i;
+	    for ( i = 0; i < N_FALL_SEEN; i++ )
+		if ( kf->seen[i] == tri_list )
+		    break;
+	    if ( i < N_FALL_SEEN )
+		continue;
+	    kf->seen[kf->seen_idx++%N_FALL_SEEN] = tri_list;
+
+	    for ( uint ti = 0; ti < stat; ti++ )
+	    {
+		uint tidx = be16(tri_list+ti);
+		if (!tidx--)
+		    break;
+		if ( tidx < kcl->tridata.used )
+		    fall_add_triangle(kf,tidx);
+	    }
+	}
+    }
+    kf->walked = target;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void fall_setup_lines
+(
+    kcl_fall_t		*kf,		// valid data, 'cube' and 'width' are set
+    double		y		// highest 'y' for Collide1()
+)
+{
+    DASSERT(kf);
+    const kcl_t *kcl = kf->kcl;
+    const double3 *min = &kcl->min_octree;
+
+    // same x and z coordinates as used by Collide1()
+    const double x[4] =
+    {
+	min->x + ( kf->cube.min[0] + kf->cube.max[0] ) / 2,
+	min->x + kf->cube.min[0],
+	min->x + kf->cube.max[0],
+	min->y + kf->cube.min[0],
+    };
+    const double z[3] =
+    {
+	min->z + ( kf->cube.min[2] + kf->cube.max[2] ) / 2,
+	min->z + kf->cube.min[2],
+	min->z + kf->cube.max[2],
+    };
+    static const u8 xz[N_FALL_LINE][2] =
+	{ {0,0}, {1,1}, {1,2}, {2,2}, {2,1}, {3,2}, {3,1} };
+
+    for ( uint p = 0; p < 3; p += 2 )
+    {
+	kf->col_min[p] = min->v[p] + kf->cube.min[p] - 1.0;
+	kf->col_max[p] = min->v[p] + kf->cube.max[p] + 1.0;
+    }
+
+    int top = (int)round( y - min->y ) + kf->width + 1;
+    if ( kcl->mask[1] && top > (int)~kcl->mask[1] )
+	top = ~kcl->mask[1];
+
+    kf->n_line = 0;
+    for ( uint i = 0; i < N_FALL_LINE; i++ )
+    {
+	const double lx = x[xz[i][0]];
+	const double lz = z[xz[i][1]];
+
+	uint l;
+	for ( l = 0; l < kf->n_line; l++ )
+	    if ( kf->line[l].x == lx && kf->line[l].z == lz )
+		break;
+	if ( l == kf->n_line )
+	{
+	    kcl_fall_line_t *line = kf->line + kf->n_line++;
+	    line->x = lx;
+	    line->z = lz;
+	    line->next = top;
+	}
+    }
+    kf->walked = top + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool fall_find
+(
+    // Find the highest 'y' <= 'y_max', for which Collide1() may find a
+    // triangle. Return false, if there is none.
+
+    kcl_fall_t		*kf,		// valid data
+    double		y_max,		// max value for 'y'
+    double		*res		// store result here
+)
+{
+    DASSERT(kf);
+    DASSERT(res);
+    const double min_y = kf->kcl->min_octree.y;
+
+    for(;;)
+    {
+	bool found = false;
+	double best = 0.0;
+	const kcl_fall_range_t *r, *rend = kf->range + kf->n_range;
+	for ( r = kf->range; r < rend; r++ )
+	    if ( r->ymin <= y_max )
+	    {
+		const double val = r->ymax < y_max ? r->ymax : y_max;
+		if ( !found || best < val )
+		{
+		    best  = val;
+		    found = true;
+		}
+	    }
+
+	// triangles of not scanned cubes can't hit at or above 'walked'
+	const int cbest = found ? (int)round( best - min_y ) : 0;
+	if ( found && ( cbest >= kf->walked || kf->walked <= 0 ) )
+	{
+	    *res = best;
+	    return true;
+	}
+	if ( kf->walked <= 0 )
+	    return false;
+
+	fall_walk(kf, cbest > 0 ? cbest : 0 );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int fall_collide
+(
+    kcl_fall_t		*kf,		// valid data
+    double		y		// y point to test
+)
+{
+    double hit;
+    return fall_find(kf,y,&hit) && hit == y ? Collide1(kf,y) : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static double fall_kcl
+(
+    // FallKCL() with an octree cursor, that is kept between the calls.
+    // The octree must be created before.
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_octree_cursor_t	*cursor,	// valid cursor, 'n_level=0' for a new one
+    FILE		*f,		// output file, if NULL: verbose:=0
+    double3		pt,		// mid point of cube to analyze
+    uint		width,		// width of cube
+    int			verbosity,	// verbose level
+    u32			type_mask,	// kcl type selector (bit field)
+    int			*res_kcl_flag	// not NULL: store KCL flag here
+)
+{
+    DASSERT(kcl);
+    DASSERT(cursor);
+    if ( !kcl->octree || !kcl->octree_valid || pt.y < 0.0  )
+    {
+	if (res_kcl_flag)
+	    *res_kcl_flag = -1;
+	return -1.0;
+    }
+
+    if ( width < 1 )
+	 width = 1;
+
+    kcl_fall_t kf;
+    memset(&kf,0,sizeof(kf));
+    kf.kcl	 = kcl;
+    kf.f	 = f;
+    kf.verbose	 = f ? verbosity : 0;
+    kf.cursor	 = cursor;
+    kf.width	 = width;
+    kf.type_mask = type_mask;
+    kf.range	 = kf.range_buf;
+    kf.size_range = sizeof(kf.range_buf)/sizeof(*kf.range_buf);
+
+    uint p;
+    for ( p = 0; p < 3; p++ )
+    {
+	kf.cube.min[p] = round ( pt.v[p] - kcl->min_octree.v[p] - width/2);
+	kf.cube.max[p] = kf.cube.min[p] + width;
+    }
+    fall_setup_lines(&kf,pt.y);
+
+    if ( width > 1 )
+	 width--;
+
+    // very first test
+    int stat = fall_collide(&kf,pt.y);
+    if ( stat >= 0 )
+	goto abort;
+
+    const double y_start = ceil( pt.y - width ); // round only if really falling!
+    pt.y = y_start;
+    for(;;)
+    {
+	// skip all steps, that can't hit a triangle
+	double hit;
+	if (!fall_find(&kf,pt.y,&hit))
+	    goto fail;
+	if ( hit < pt.y )
+	{
+	    if ( pt.y <= 0.0 || hit < 0.0 )
+		goto fail;
+	    pt.y = y_start - ceil( ( y_start - hit ) / width ) * width;
+	    if ( pt.y < 0.0 )
+		pt.y = 0.0;
+	    continue;
+	}
+
+	stat = Collide1(&kf,pt.y);
+	if ( stat >= 0 )
+	    break;
+	if ( pt.y <= 0.0 )
+	    goto fail;
+	pt.y -= width;
+	if ( pt.y < 0.0 )
+	    pt.y = 0.0;
+    }
+
+    pt.y += width;
+    while ( width > 1 )
+    {
+	width = (width+1)/2;
+	pt.y -= width;
+	int stat2 = fall_collide(&kf,pt.y);
+	if ( stat2 >= 0 )
+	{
+	    stat = stat2;
+	    pt.y += width;
+	}
+    }
+
+    if ( pt.y >= 0.0 )
+	goto abort;
+
+ fail:
+    pt.y = -1.0;
+    stat = -1;
+
+ abort:
+    if ( kf.range != kf.range_buf )
+	FREE(kf.range);
+    if (res_kcl_flag)
+	*res_kcl_flag = stat;
+    return pt.y;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+double FallKCL
+(
+    // returns the height or -1.0 on fail
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    FILE		*f,		// output file, if NULL: verbose:=0
+    double3		pt,		// mid point of cube to analyze
+    uint		width,		// width of cube
+    int			verbosity,	// verbose level
+					//   <=0: silent
+					//   >=1: log triangle search
+					//   >=2: print base calculations
+					//   >=3: print step calculations
+    u32			type_mask,	// kcl type selector (bit field)
+    int			*res_kcl_flag	// not NULL: store KCL flag here
+)
+{
+    DASSERT(kcl);
+    CreateOctreeKCL(kcl);
+
+    kcl_octree_cursor_t cursor;
+    cursor.n_level = 0;
+    return fall_kcl(kcl,&cursor,f,pt,width,verbosity,type_mask,res_kcl_flag);
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			batch queries			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// The queries are sorted by the Morton code of their octree coordinates.
+// So neighbored points are processed one after another and a traversal
+// of the octree can continue at the deepest node, that the current point
+// shares with the previous one (see TraverseCursorKCL()).
+
+typedef struct kcl_query_order_t
+{
+    u64		key;			// Morton code, M1: point outside octree
+    uint	idx;			// index into the query list
+    u32		base[3];		// rounded octree coordinates
+
+} kcl_query_order_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct kcl_fall_job_t
+{
+    kcl_t		*kcl;		// valid KCL with valid octree
+    kcl_query_t		*query;		// list with queries
+    const kcl_query_order_t *order;	// processing order
+    uint		first;		// index of first 'order' to process
+    uint		end;		// index of last 'order' to process + 1
+    uint		width;		// width of cube
+    u32			type_mask;	// kcl type selector (bit field)
+
+} kcl_fall_job_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static u64 SpreadBits3 ( u32 val )
+{
+    u64 x = val & 0x1fffff;
+    x = ( x | x << 32 ) & 0x001f00000000ffffull;
+    x = ( x | x << 16 ) & 0x001f0000ff0000ffull;
+    x = ( x | x <<  8 ) & 0x100f00f00f00f00full;
+    x = ( x | x <<  4 ) & 0x10c30c30c30c30c3ull;
+    x = ( x | x <<  2 ) & 0x1249249249249249ull;
+    return x;
+}
+
+//-----------------------------------------------------------------------------
+
+static int sort_query_order ( const kcl_query_order_t *a, const kcl_query_order_t *b )
+{
+    return a->key < b->key ? -1 : a->key > b->key ? 1 : (int)a->idx - (int)b->idx;
+}
+
+//-----------------------------------------------------------------------------
+
+static kcl_query_order_t * SortQueryKCL
+(
+    // returns an alloced list with 'n_query' elements, call FREE() for it
+
+    const kcl_t		*kcl,		// valid KCL
+    const kcl_query_t	*query,		// list with queries
+    uint		n_query		// number of elements in 'query'
+)
+{
+    DASSERT(kcl);
+    DASSERT( query || !n_query );
+
+    kcl_query_order_t *order = MALLOC( (n_query+1) * sizeof(*order) );
+    for ( uint i = 0; i < n_query; i++ )
+    {
+	kcl_query_order_t *o = order + i;
+	o->idx = i;
+	o->key = M1(o->key);
+	if (GetOctreeBaseKCL(kcl,&query[i].pt,o->base))
+	    o->key = SpreadBits3(o->base[0])
+		   | SpreadBits3(o->base[1]) << 1
+		   | SpreadBits3(o->base[2]) << 2;
+    }
+
+    qsort( order, n_query, sizeof(*order), (qsort_func)sort_query_order );
+    return order;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static int Collide2
+uint TraverseListKCL
 (
-    kcl_fall_t		*kf,		// valid data
-    double3		pt		// point for octree search
+    // Find the octree cube and its triangle list for each query.
+    // The results are the same as by TraverseOctreeKCL().
+    // Returns the number of queries with a not empty triangle list.
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_query_t		*query,		// list with queries
+    uint		n_query		// number of elements in 'query'
 )
 {
-    DASSERT(kf);
-    noPRINT("Collide2() n=%u, v=%d, pt=%.0f %.0f %.0f\n",
-	    kf->n_tri_list, kf->last_valid, pt.x, pt.y, pt.z );
+    DASSERT(kcl);
+    DASSERT( query || !n_query );
+
+    for ( uint i = 0; i < n_query; i++ )
+    {
+	kcl_query_t *q = query + i;
+	q->tri_list	= 0;
+	q->n_tri	= 0;
+	q->cube_width	= 0;
+	memset(&q->cube_min,0,sizeof(q->cube_min));
+    }
 
+    CreateOctreeKCL(kcl);
+    if ( !n_query || !kcl->octree || !kcl->octree_valid )
+	return 0;
 
-    //--- test if point is in previous cube
+    kcl_query_order_t *order = SortQueryKCL(kcl,query,n_query);
+    kcl_octree_cursor_t cur;
+    cur.n_level = 0;
+    uint n_found = 0;
 
-    if ( kf->last_valid
-	&& pt.x >= kf->last_min.x && pt.x <= kf->last_min.x + kf->last_width
-	&& pt.y >= kf->last_min.y && pt.y <= kf->last_min.y + kf->last_width
-	&& pt.z >= kf->last_min.z && pt.z <= kf->last_min.z + kf->last_width
-       )
+    for ( uint oi = 0; oi < n_query; oi++ )
     {
-	return -1;
+	const kcl_query_order_t *o = order + oi;
+	if ( o->key == M1(o->key) )
+	    break; // all other points are outside, too
+
+	kcl_query_t *q = query + o->idx;
+	const int stat = TraverseCursorKCL( kcl, &cur, q->pt,
+				&q->cube_min, &q->cube_width, &q->tri_list );
+	if ( stat > 0 )
+	{
+	    q->n_tri = stat;
+	    n_found++;
+	}
     }
 
-    //--- find tri list
+    FREE(order);
+    return n_found;
+}
 
-    u16 *tri_list;
-    int stat = TraverseOctree(kf->kcl,kf->f,pt,
-		kf->verbose-1, &kf->last_min,&kf->last_width,&tri_list);
-    if ( stat < 0 )
-	return -1;
+///////////////////////////////////////////////////////////////////////////////
 
-    kf->last_valid = true;
-    if ( !tri_list || !*tri_list )
-	return -1;
+enumError PrintTraverseListKCL
+(
+    // Print the results of TraverseListKCL() in the format of
+    // TraverseOctreeKCL(). Queries without octree cube are passed to
+    // TraverseOctreeKCL() to print its warnings. Returns the max error.
 
-    uint i;
-    for ( i = 0; i < kf->n_tri_list; i++ )
-	if (kf->tri_list[i] == tri_list )
-	    return -1;
+    kcl_t		*kcl,		// pointer to valid KCL
+    FILE		*f,		// output file
+    const kcl_query_t	*query,		// list with queries
+    uint		n_query,	// number of elements in 'query'
+    bool		print_tri_val	// true: print tri values instead of index
+)
+{
+    DASSERT(kcl);
+    DASSERT(f);
+    DASSERT( query || !n_query );
 
-    if ( kf->n_tri_list < N_FALL_LIST )
-	kf->tri_list[kf->n_tri_list++] = tri_list;
+    enumError max_err = ERR_OK;
+    for ( uint i = 0; i < n_query; i++ )
+    {
+	const kcl_query_t *q = query + i;
+	if (q->cube_width)
+	    PrintTriList(kcl,f,q->pt,q->tri_list,q->n_tri,print_tri_val);
+	else
+	{
+	    const enumError err = TraverseOctreeKCL(kcl,f,q->pt,print_tri_val,0);
+	    if ( max_err < err )
+		 max_err = err;
+	}
+    }
+    return max_err;
+}
 
-    uint ti;
-    for ( ti = 0; ti < stat; ti++ )
+///////////////////////////////////////////////////////////////////////////////
+
+static int flag_tri_list
+(
+    // return the KCL flag of the first triangle of 'tri_list',
+    // that collides with 'cube', or -1 if none found
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_cube_t		*cube,		// cube to test
+    const u16		*tri_list,	// triangle list, terminated by 0
+    const u16		*tri_end,	// end of octree data
+    u32			type_mask	// kcl type selector (bit field)
+)
+{
+    DASSERT(kcl);
+    DASSERT(cube);
+
+    for ( ; tri_list < tri_end; tri_list++ )
     {
-	DASSERT(tri_list);
-	uint tidx = be16(tri_list+ti);
+	uint tidx = be16(tri_list);
 	if (!tidx--)
 	    break;
-	if ( tidx >= kf->kcl->tridata.used )
+	if ( tidx >= kcl->tridata.used )
 	    continue;
 
-	const kcl_tridata_t *td = (kcl_tridata_t*)kf->kcl->tridata.list + tidx;
-	if ( td->cur_flag >= N_KCL_TYPE || ( 1u << (td->cur_flag&0x1f) & kf->type_mask ) )
+	const kcl_tridata_t *td = (kcl_tridata_t*)kcl->tridata.list + tidx;
+	if ( td->cur_flag >= N_KCL_TYPE || ( 1u << (td->cur_flag&0x1f) & type_mask ) )
 	{
 	    kcl_tri_t ot;
 	 #if SUPPORT_KCL_CUBE
-	    setup_oct_tri(kf->kcl,&ot,0,td); // use [[cube]] list param?
-	    if (OctCubeTriangleOverlaped(&kf->cube,&ot,0)) // [use [[cube]] list param?
-		return td->cur_flag;
+	    setup_oct_tri(kcl,&ot,0,td);
+	    if (OctCubeTriangleOverlaped(cube,&ot,0))
 	 #else
-	    setup_oct_tri(kf->kcl,&ot,td);
-	    if (OctCubeTriangleOverlaped(&kf->cube,&ot))
-		return td->cur_flag;
+	    setup_oct_tri(kcl,&ot,td);
+	    if (OctCubeTriangleOverlaped(cube,&ot))
 	 #endif
+		return td->cur_flag;
 	}
     }
     return -1;
@@ -6248,171 +7711,240 @@ static int Collide2
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static int Collide1
+static int flag_octree_node
 (
-    kcl_fall_t		*kf,		// valid data
-    double		y		// y point to test
+    // search all leaves of an octree node, that overlap 'cube',
+    // and return the KCL flag of the first colliding triangle or -1
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_cube_t		*cube,		// cube to test
+    u32			type_mask,	// kcl type selector (bit field)
+    const u16		*skip,		// NULL or triangle list to ignore
+    u32			baseoff,	// base offset of the node list
+    u32			offset,		// offset of the node
+    const s64		*cmin,		// minimum of the node cube
+    u32			width		// width of the node cube
 )
 {
-    DASSERT(kf);
-    kf->n_tri_list = 0;
-    kf->last_valid = false;
-
-    kf->cube.min[1] = round ( y - kf->kcl->min_octree.y );
-    kf->cube.max[1] = kf->cube.min[1] + kf->width;
-
-    noPRINT("OCT=%d,%d,%d .. %d,%d,%d\n",
-		kf->cube.min[0], kf->cube.min[1], kf->cube.min[2],
-		kf->cube.max[0], kf->cube.max[1], kf->cube.max[2] );
-
-    double3 pt;
-    double3 *min = &kf->kcl->min_octree;
-    pt.x = min->x + ( kf->cube.min[0] + kf->cube.max[0] ) / 2;
-    pt.y = min->y +   kf->cube.min[1];
-    pt.z = min->z + ( kf->cube.min[2] + kf->cube.max[2] ) / 2;
-    int stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
-
-    pt.x = min->x + kf->cube.min[0];
-    pt.z = min->z + kf->cube.min[2];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
-
-    pt.z = min->z + kf->cube.max[2];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+    DASSERT(kcl);
+    DASSERT(cube);
+    DASSERT(cmin);
 
-    pt.x = min->x + kf->cube.max[0];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+    for ( uint p = 0; p < 3; p++ )
+	if ( cmin[p] > cube->max[p] || cmin[p] + width < cube->min[p] )
+	    return -1;
 
-    pt.z = min->z + kf->cube.min[2];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+    if ( baseoff + 0x20 > kcl->octree_size || offset & 3 )
+	return -1;
 
-    pt.y = min->y + kf->cube.max[1];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+    const u32 val = be32( kcl->octree + offset );
+    if ( val & 0x80000000 )
+    {
+	offset = baseoff + ( val & 0x7ffffff ) + 2;
+	if ( offset+2 > kcl->octree_size || offset & 1 )
+	    return -1;
 
-    pt.z = min->z + kf->cube.max[2];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+	const u16 *tri_list = (u16*)( kcl->octree + offset );
+	return tri_list == skip ? -1
+		: flag_tri_list( kcl, cube, tri_list,
+				(u16*)( kcl->octree + kcl->octree_size ), type_mask );
+    }
 
-    pt.x = min->y + kf->cube.min[0];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+    if ( width < 2 )
+	return -1;
+    width >>= 1;
+    baseoff += val;
 
-    pt.z = min->z + kf->cube.min[2];
-    stat = Collide2(kf,pt);
-    if ( stat >= 0 )
-	return stat;
+    for ( uint child = 0; child < 8; child++ )
+    {
+	s64 child_min[3];
+	for ( uint p = 0; p < 3; p++ )
+	    child_min[p] = cmin[p] + ( child & 1 << p ? width : 0 );
 
-    pt.x = min->x + ( kf->cube.min[0] + kf->cube.max[0] ) / 2;
-    pt.z = min->z + ( kf->cube.min[2] + kf->cube.max[2] ) / 2;
-    return Collide2(kf,pt);
+	const int flag = flag_octree_node( kcl, cube, type_mask, skip,
+				baseoff, baseoff + 4*child, child_min, width );
+	if ( flag >= 0 )
+	    return flag;
+    }
+    return -1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-double FallKCL
+uint FlagListKCL
 (
-    // returns the height or -1.0 on fail
+    // Find the KCL flag of the first triangle, that collides with a cube
+    // of edge length 'width' around each query point. The octree cube of
+    // the point itself is tested first, and then all other octree cubes
+    // overlapped by the cube. Returns the number of queries with a collision.
 
     kcl_t		*kcl,		// pointer to valid KCL
-    FILE		*f,		// output file, if NULL: verbose:=0
-    double3		pt,		// mid point of cube to analyze
+    kcl_query_t		*query,		// list with queries
+    uint		n_query,	// number of elements in 'query'
     uint		width,		// width of cube
-    int			verbosity,	// verbose level
-					//   <=0: silent
-					//   >=1: log triangle search
-					//   >=2: print base calculations
-					//   >=3: print step calculations
-    u32			type_mask,	// kcl type selector (bit field)
-    int			*res_kcl_flag	// not NULL: store KCL flag here
+    u32			type_mask	// kcl type selector (bit field)
 )
 {
     DASSERT(kcl);
-    CreateOctreeKCL(kcl);
-    if ( !kcl->octree || !kcl->octree_valid || pt.y < 0.0  )
-	return -1.0;
+    DASSERT( query || !n_query );
 
+    TraverseListKCL(kcl,query,n_query);
     if ( width < 1 )
 	 width = 1;
 
-    kcl_fall_t kf;
-    memset(&kf,0,sizeof(kf));
-    kf.kcl	 = kcl;
-    kf.f	 = f;
-    kf.verbose	 = f ? verbosity : 0;
-    kf.width	 = width;
-    kf.type_mask = type_mask;
+    //--- number of base cubes for each axis
 
-    uint p;
-    for ( p = 0; p < 3; p++ )
+    const uint rshift = kcl->coord_rshift;
+    s64 n_base[3];
+    for ( uint p = 0; p < 3; p++ )
+	n_base[p] = ( (u64)(u32)~kcl->mask[p] + 1 ) >> rshift;
+
+    const u16 *tri_end = (u16*)( kcl->octree + kcl->octree_size );
+    uint n_found = 0;
+
+    for ( uint i = 0; i < n_query; i++ )
     {
-	kf.cube.min[p] = round ( pt.v[p] - kcl->min_octree.v[p] - width/2);
-	kf.cube.max[p] = kf.cube.min[p] + width;
+	kcl_query_t *q = query + i;
+	q->kcl_flag = -1;
+	if ( !kcl->octree || !kcl->octree_valid )
+	    continue;
+
+	kcl_cube_t cube;
+	s64 lo[3], hi[3];
+	for ( uint p = 0; p < 3; p++ )
+	{
+	    cube.min[p] = round ( q->pt.v[p] - kcl->min_octree.v[p] - width/2);
+	    cube.max[p] = cube.min[p] + width;
+
+	    lo[p] = cube.min[p] < 0 ? 0 : cube.min[p] >> rshift;
+	    hi[p] = cube.max[p] < 0 ? -1 : cube.max[p] >> rshift;
+	    if ( hi[p] >= n_base[p] )
+		 hi[p] = n_base[p] - 1;
+	}
+
+	//--- the octree cube of the point itself first
+
+	if (q->tri_list)
+	    q->kcl_flag = flag_tri_list(kcl,&cube,q->tri_list,tri_end,type_mask);
+
+	//--- then all other base cubes and their children
+
+	for ( s64 z = lo[2]; z <= hi[2] && q->kcl_flag < 0; z++ )
+	    for ( s64 y = lo[1]; y <= hi[1] && q->kcl_flag < 0; y++ )
+		for ( s64 x = lo[0]; x <= hi[0] && q->kcl_flag < 0; x++ )
+		{
+		    const s64 cmin[3] = { x << rshift, y << rshift, z << rshift };
+		    const u32 oct_index = x
+					| y << kcl->y_lshift
+					| z << kcl->z_lshift;
+		    q->kcl_flag = flag_octree_node( kcl, &cube, type_mask,
+					q->tri_list, 0, oct_index*4, cmin, 1 << rshift );
+		}
+
+	if ( q->kcl_flag >= 0 )
+	    n_found++;
     }
+    return n_found;
+}
 
-    if ( width > 1 )
-	 width--;
+///////////////////////////////////////////////////////////////////////////////
 
-    // very first test
-    int stat = Collide1(&kf,pt.y);
-    if ( stat >= 0 )
+static void * FallListJob ( void *arg )
+{
+    const kcl_fall_job_t *job = arg;
+    DASSERT(job);
+
+    // the queries are sorted, so the cursor is reused between them
+    kcl_octree_cursor_t cursor;
+    cursor.n_level = 0;
+
+    for ( uint i = job->first; i < job->end; i++ )
     {
-	if (res_kcl_flag)
-	    *res_kcl_flag = stat;
-	return pt.y;
+	kcl_query_t *q = job->query + job->order[i].idx;
+	q->height = fall_kcl(job->kcl,&cursor,0,q->pt,job->width,0,
+				job->type_mask,&q->kcl_flag);
     }
+    return 0;
+}
 
-    pt.y = ceil( pt.y - width ); // round only if really falling!
-    for(;;)
+//-----------------------------------------------------------------------------
+
+uint FallListKCL
+(
+    // Call FallKCL() for each query and store the results in 'height' and
+    // 'kcl_flag'. The queries are processed in octree order by
+    // --kcl-threads threads. Returns the number of queries with a hit.
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_query_t		*query,		// list with queries
+    uint		n_query,	// number of elements in 'query'
+    uint		width,		// width of cube
+    u32			type_mask	// kcl type selector (bit field)
+)
+{
+    DASSERT(kcl);
+    DASSERT( query || !n_query );
+
+    // create the octree before starting any thread
+    CreateOctreeKCL(kcl);
+    kcl_query_order_t *order = SortQueryKCL(kcl,query,n_query);
+
+    kcl_fall_job_t job0 =
     {
-	stat = Collide1(&kf,pt.y);
-	if ( stat >= 0 )
-	    break;
-	if ( pt.y <= 0.0 )
+	.kcl	   = kcl,
+	.query	   = query,
+	.order	   = order,
+	.end	   = n_query,
+	.width	   = width,
+	.type_mask = type_mask,
+    };
+
+    // small jobs are not worth a thread
+    const uint max_threads = n_query / 16;
+    uint n_threads = opt_kcl_threads < max_threads ? opt_kcl_threads : max_threads;
+    if ( n_threads > 1 )
+    {
+	// each thread gets a continuous part of the sorted list,
+	// job #0 is done by the current thread
+
+	kcl_fall_job_t *job = CALLOC(n_threads,sizeof(*job));
+	pthread_t *tid = CALLOC(n_threads,sizeof(*tid));
+	bool *started = CALLOC(n_threads,sizeof(*started));
+
+	uint t;
+	for ( t = 0; t < n_threads; t++ )
 	{
-	    if (res_kcl_flag)
-		*res_kcl_flag = -1;
-	    return -1.0;
+	    job[t]	 = job0;
+	    job[t].first = (u64)n_query *  t    / n_threads;
+	    job[t].end	 = (u64)n_query * (t+1) / n_threads;
 	}
-	pt.y -= width;
-	if ( pt.y < 0.0 )
-	    pt.y = 0.0;
-    }
 
-    pt.y += width;
-    while ( width > 1 )
-    {
-	width = (width+1)/2;
-	pt.y -= width;
-	int stat2 = Collide1(&kf,pt.y);
-	if ( stat2 >= 0 )
+	for ( t = 1; t < n_threads; t++ )
+	    started[t] = !pthread_create(tid+t,0,FallListJob,job+t);
+	FallListJob(job);
+
+	for ( t = 1; t < n_threads; t++ )
 	{
-	    stat = stat2;
-	    pt.y += width;
+	    if (started[t])
+		pthread_join(tid[t],0);
+	    else
+		FallListJob(job+t);
 	}
-    }
 
-    if ( pt.y < 0.0 )
-    {
-	pt.y = -1.0;
-	stat = -1;
+	FREE(started);
+	FREE(tid);
+	FREE(job);
     }
+    else
+	FallListJob(&job0);
 
-    if (res_kcl_flag)
-	*res_kcl_flag = stat;
-    return pt.y;
+    FREE(order);
+
+    uint n_found = 0;
+    for ( uint i = 0; i < n_query; i++ )
+	if ( query[i].kcl_flag >= 0 )
+	    n_found++;
+    return n_found;
 }
 
 //
@@ -8937,7 +10469,6 @@ static const struct FuncTable_t func_tab[] =
 	" that are inside of the cube including the border."
 	" If 'tri_index' is invalid, -1 is returned." },
 
- #ifdef TEST // [[2do]]
     { 3, 3, "TRI$OVERLAPCUBE", F_tri_OverlapCube, 1,
 	"int", "tri$OverlapCube(tri_index,cube_mid,cube_width)",
 	" 'tri_index' (0..) is a triangle index."
@@ -8946,7 +10477,6 @@ static const struct FuncTable_t func_tab[] =
 	" The function returns -1 for an invalid triangle index,"
 	" or 1, if the cube and the triangle are overlapped."
 	" Otherwise 0 is returned." },
- #endif
 
     { 1, 2, "TRI$FLAG", F_tri_flag, 0,
 	"int", "tri$flag(tri_index[,mode])",
@@ -579,6 +579,7 @@ typedef struct kcl_t
 
 extern kcl_t * kcl_ref;		 // NULL or reference KCL for calculations
 extern kcl_t * kcl_ref_prio;	// NULL or prioreference KCL for calculations
+extern ccp kcl_ref_fname;	// NULL or file name of option --load-kcl
 
 //
 ///////////////////////////////////////////////////////////////////////////////
@@ -1050,6 +1051,73 @@ double FallKCL
     int			*res_kcl_flag	// not NULL: store KCL flag here
 );
 
+//-----------------------------------------------------------------------------
+// Batch queries: The queries are processed in octree (Morton) order, so that
+// neighbored points share the octree traversal. The results are stored in
+// the query list itself in the original order.
+
+typedef struct kcl_query_t
+{
+    double3		pt;		// input: point to analyze
+
+    //--- results of TraverseListKCL(), also set by FlagListKCL()
+
+    u16			*tri_list;	// NULL or triangle list of octree cube
+    uint		n_tri;		// number of triangles in 'tri_list'
+    double3		cube_min;	// minimum of octree cube
+    uint		cube_width;	// width of octree cube, 0 if not found
+
+    //--- results of FlagListKCL() and FallListKCL()
+
+    int			kcl_flag;	// KCL flag or -1 if not found
+    double		height;		// FallListKCL() only: height or -1.0
+
+} kcl_query_t;
+
+//-----------------------------------------------------------------------------
+
+uint TraverseListKCL
+(
+    // returns the number of queries with a not empty triangle list
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_query_t		*query,		// list with queries
+    uint		n_query		// number of elements in 'query'
+);
+
+enumError PrintTraverseListKCL
+(
+    // print the results of TraverseListKCL() like TraverseOctreeKCL()
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    FILE		*f,		// output file
+    const kcl_query_t	*query,		// list with queries
+    uint		n_query,	// number of elements in 'query'
+    bool		print_tri_val	// true: print tri values instead of index
+);
+
+uint FlagListKCL
+(
+    // returns the number of queries with a collision
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_query_t		*query,		// list with queries
+    uint		n_query,	// number of elements in 'query'
+    uint		width,		// width of cube
+    u32			type_mask	// kcl type selector (bit field)
+);
+
+uint FallListKCL
+(
+    // returns the number of queries with a hit
+
+    kcl_t		*kcl,		// pointer to valid KCL
+    kcl_query_t		*query,		// list with queries
+    uint		n_query,	// number of elements in 'query'
+    uint		width,		// width of cube
+    u32			type_mask	// kcl type selector (bit field)
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 
 int CheckKCL
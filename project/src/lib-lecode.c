@@ -45,6 +45,7 @@
 #include "lecode.inc"
 
 #include <stddef.h>
+#include <dirent.h>
 
 //
 ///////////////////////////////////////////////////////////////////////////////
@@ -3615,6 +3616,308 @@ void DumpLEAnalyse ( FILE *f, uint indent, const le_analyze_t *ana )
     fputc('\n',f);
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			track directory index		///////////////
+///////////////////////////////////////////////////////////////////////////////
+// The track files of each directory are scanned once and stored in a hash
+// table. A directory is rescanned if its mtime has changed, but the mtime is
+// checked at most once per TRACK_DIR_CHECK_MSEC. Own file transfers update
+// the affected entries immediately. On case insensitive file systems the
+// keys are stored in lower case. If a directory exists but can't be read,
+// the files are searched by stat().
+
+#define TRACK_DIR_CHECK_MSEC 1000
+
+#if defined(HAVE_CASE_INSENSITIVE_FS) || defined(__CYGWIN__)
+  #define TRACK_DIR_FOLD_CASE 1
+#else
+  #define TRACK_DIR_FOLD_CASE 0
+#endif
+
+typedef struct track_dir_t
+{
+    bool		valid;		// false: check mtime at next access
+    bool		listed;		// true: directory was read by readdir()
+    u64			mtime;		// mtime of directory in nsec, 0: not found
+    u_msec_t		check_msec;	// time of last mtime check
+    ParamHash_t		files;		// key: file name without '.szs'
+					// data: track_dir_file_t
+
+} track_dir_t;
+
+static ParamHash_t track_dir_index = {0};
+
+///////////////////////////////////////////////////////////////////////////////
+
+static u64 GetTrackDirMTime ( const struct stat *st )
+{
+    DASSERT(st);
+ #if HAVE_STATTIME_NSEC
+    return st->st_mtim.tv_sec * NSEC_PER_SEC + st->st_mtim.tv_nsec;
+ #else
+    return st->st_mtime * NSEC_PER_SEC;
+ #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static ccp GetTrackDirKey ( char *buf, uint bufsize, ccp name, uint len )
+{
+    DASSERT(buf);
+    DASSERT(name);
+
+ #if TRACK_DIR_FOLD_CASE
+    mem_t mem = { name, len };
+    MemLowerS(buf,bufsize,mem);
+ #else
+    StringCopySM(buf,bufsize,name,len);
+ #endif
+    return buf;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static track_dir_file_t * InsertTrackDirFile ( track_dir_t *td, ccp name, uint len )
+{
+    DASSERT(td);
+    DASSERT(name);
+
+    char key[PATH_MAX];
+    GetTrackDirKey(key,sizeof(key),name,len);
+    ParamFieldItem_t *it = FindInsertParamHash(&td->files,key,false,0,0);
+    if (!it->data)
+	it->data = CALLOC(1,sizeof(track_dir_file_t));
+    return it->data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void ScanTrackDir ( track_dir_t *td, ccp dir_name, u64 mtime )
+{
+    DASSERT(td);
+    DASSERT(dir_name);
+    PRINT("SCAN TRACK DIR: %s\n",dir_name);
+
+    ResetParamHash(&td->files);
+    td->files.pf.free_data = true;
+    td->mtime = mtime;
+
+    DIR * dir = opendir(dir_name);
+    td->listed = dir != 0;
+    if (!dir)
+	return;
+
+    char path[PATH_MAX];
+    for(;;)
+    {
+	struct dirent * dent = readdir(dir);
+	if (!dent)
+	    break;
+
+	ccp name = dent->d_name;
+     #if TRACK_DIR_FOLD_CASE
+	char lname[PATH_MAX];
+	StringLowerS(lname,sizeof(lname),name);
+	name = lname;
+     #endif
+	const uint len = strlen(name);
+	if ( len <= 4 || memcmp(name+len-4,".szs",4) )
+	    continue;
+
+	struct stat st;
+	if ( stat(PathCatPP(path,sizeof(path),dir_name,name),&st)
+		|| !S_ISREG(st.st_mode) )
+	{
+	    continue;
+	}
+
+	InsertTrackDirFile(td,name,len-4)->have_std = true;
+	if ( len > 6 && !memcmp(name+len-6,"_d",2) )
+	    InsertTrackDirFile(td,name,len-6)->have_d = true;
+    }
+    closedir(dir);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static track_dir_t * GetTrackDir ( ccp dir_name )
+{
+    DASSERT(dir_name);
+
+    bool found;
+    ParamFieldItem_t *it = FindInsertParamHash(&track_dir_index,dir_name,false,0,&found);
+    if (!found)
+	it->data = CALLOC(1,sizeof(track_dir_t));
+    track_dir_t *td = it->data;
+
+    const u_msec_t now = GetTimerMSec();
+    if ( !td->valid || now >= td->check_msec + TRACK_DIR_CHECK_MSEC )
+    {
+	td->valid = true;
+	td->check_msec = now;
+	struct stat st;
+	const u64 mtime = !stat(dir_name,&st) && S_ISDIR(st.st_mode)
+			? GetTrackDirMTime(&st) : 0;
+	if ( !mtime )
+	{
+	    ResetParamHash(&td->files);
+	    td->mtime = 0;
+	    td->listed = false;
+	}
+	else if ( mtime != td->mtime )
+	    ScanTrackDir(td,dir_name,mtime);
+    }
+    return td;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+const track_dir_file_t * FindTrackDirFile ( ccp dir, ccp name )
+{
+    if ( !name || !*name )
+	return 0;
+
+    char path[PATH_MAX];
+    ccp dir_name = ".", fname = name;
+    if ( ( dir && *dir ) || strchr(name,'/') )
+    {
+	PathCatBufPP(path,sizeof(path),dir,name);
+	char *slash = strrchr(path,'/');
+	if (slash)
+	{
+	    *slash = 0;
+	    dir_name = slash > path ? path : "/";
+	    fname = slash + 1;
+	}
+	else
+	    fname = path;
+    }
+
+    track_dir_t *td = GetTrackDir(dir_name);
+    const uint len = strlen(fname);
+    char key[PATH_MAX];
+    const ParamFieldItem_t *it
+	= FindParamHash(&td->files,GetTrackDirKey(key,sizeof(key),fname,len));
+    if ( it || td->listed || !td->mtime )
+	return it ? it->data : 0;
+
+
+    //--- directory exists, but can't be read => stat() the files
+
+    char fpath[PATH_MAX];
+    struct stat st;
+    const bool have_std
+	= !stat(PathCatBufPPE(fpath,sizeof(fpath),dir_name,fname,".szs"),&st)
+	&& S_ISREG(st.st_mode);
+    const bool have_d
+	= !stat(PathCatBufPPE(fpath,sizeof(fpath),dir_name,fname,"_d.szs"),&st)
+	&& S_ISREG(st.st_mode);
+    if ( !have_std && !have_d )
+	return 0;
+
+    track_dir_file_t *tf = InsertTrackDirFile(td,fname,len);
+    tf->have_std = have_std;
+    tf->have_d   = have_d;
+    return tf;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool IsTrackFile ( ccp path, uint *size )
+{
+    if ( !path || !*path )
+	return false;
+
+    const uint len = strlen(path);
+    if ( len > 4 && len < PATH_MAX && !memcmp(path+len-4,".szs",4) )
+    {
+	// the index finds missing files fast, but an existing file
+	// may have been modified since the scan => stat() it anyway
+	char name[PATH_MAX];
+	StringCopySM(name,sizeof(name),path,len-4);
+	const track_dir_file_t *tf = FindTrackDirFile(0,name);
+	if ( !tf || !tf->have_std )
+	    return false;
+    }
+
+    struct stat st;
+    if ( !stat(path,&st) && S_ISREG(st.st_mode) )
+    {
+	if (size)
+	    *size = st.st_size;
+	return true;
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void UpdateTrackDirFile ( ccp path )
+{
+    // update the index after an own transfer => no rescan is needed
+
+    char dir_name[PATH_MAX];
+    StringCopyS(dir_name,sizeof(dir_name),path);
+    char *slash = strrchr(dir_name,'/');
+    ccp name = path;
+    if (!slash)
+	StringCopyS(dir_name,sizeof(dir_name),".");
+    else
+    {
+	name += slash - dir_name + 1;
+	if ( slash > dir_name )
+	    *slash = 0;
+	else
+	    slash[1] = 0;
+    }
+
+    ParamFieldItem_t *it = FindParamHash(&track_dir_index,dir_name);
+    if (!it)
+	return;
+    track_dir_t *td = it->data;
+    if ( !td->valid || !td->mtime )
+	return;
+
+ #if TRACK_DIR_FOLD_CASE
+    char lname[PATH_MAX];
+    StringLowerS(lname,sizeof(lname),name);
+    name = lname;
+ #endif
+    const uint len = strlen(name);
+    if ( len <= 4 || memcmp(name+len-4,".szs",4) )
+	return;
+
+    struct stat st;
+    const bool have_file = !stat(path,&st) && S_ISREG(st.st_mode);
+
+    InsertTrackDirFile(td,name,len-4)->have_std = have_file;
+    if ( len > 6 && !memcmp(name+len-6,"_d",2) )
+	InsertTrackDirFile(td,name,len-6)->have_d = have_file;
+
+    if ( !stat(dir_name,&st) && S_ISDIR(st.st_mode) )
+	td->mtime = GetTrackDirMTime(&st);
+    else
+	td->valid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+static enumError TransferTrackDirFile
+	( LogFile_t *log, ccp dest, ccp src, TransferMode_t tfer_mode )
+{
+    // TransferFile() + UpdateTrackDirFile()
+
+    const enumError err = TransferFile(log,dest,src,tfer_mode,0666);
+    if (!( tfer_mode & TFMD_F_TEST ))
+    {
+	UpdateTrackDirFile(dest);
+	if ( tfer_mode & (TFMD_J_MOVE|TFMD_J_MOVE1|TFMD_J_RM_SRC) )
+	    UpdateTrackDirFile(src);
+    }
+    return err;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			find + copy track files		///////////////
@@ -3628,14 +3931,12 @@ ccp FindTrackFile ( ccp src_name, TransferMode_t *tfer_mode )
 	ParamFieldItem_t *ptr = opt_track_source.field, *end;
 	for ( end = ptr + opt_track_source.used; ptr < end; ptr++ )
 	{
-	    PathCatBufPPE(src,sizeof(src),ptr->key,src_name,".szs");
-
-	    struct stat st;
-	    if ( !stat(src,&st) && S_ISREG(st.st_mode) )
+	    const track_dir_file_t *tf = FindTrackDirFile(ptr->key,src_name);
+	    if ( tf && tf->have_std )
 	    {
 		if (tfer_mode)
 		    *tfer_mode = ptr->num;
-		return STRDUP(src);
+		return STRDUP(PathCatBufPPE(src,sizeof(src),ptr->key,src_name,".szs"));
 	    }
 	}
     }
@@ -3661,22 +3962,19 @@ void TransferTrackFile
 	ParamFieldItem_t *ptr = opt_track_source.field, *end;
 	for ( end = ptr + opt_track_source.used; ptr < end; ptr++ )
 	{
-	    PathCatBufPPE(src,sizeof(src),ptr->key,src_name,".szs");
-
-	    struct stat st;
-	    if ( !stat(src,&st) && S_ISREG(st.st_mode) )
+	    const track_dir_file_t *tf = FindTrackDirFile(ptr->key,src_name);
+	    if ( tf && tf->have_std )
 	    {
+		const bool have_d = tf->have_d;
+		PathCatBufPPE(src,sizeof(src),ptr->key,src_name,".szs");
 		ccp format = lecode_04x ? "%s/%04x.szs" : "%s/%03x.szs";
 		snprintf(dest,sizeof(dest),format,opt_track_dest,dest_slot);
-		if (!TransferFile(log,dest,src,ptr->num|flags,0666))
+		if ( !TransferTrackDirFile(log,dest,src,ptr->num|flags) && have_d )
 		{
 		    PathCatBufPPE(src,sizeof(src),ptr->key,src_name,"_d.szs");
-		    if ( !stat(src,&st) && S_ISREG(st.st_mode) )
-		    {
-			ccp format = lecode_04x ? "%s/%04x_d.szs" : "%s/%03x_d.szs";
-			snprintf(dest,sizeof(dest),format,opt_track_dest,dest_slot);
-			TransferFile(log,dest,src,ptr->num|flags,0666);
-		    }
+		    ccp format = lecode_04x ? "%s/%04x_d.szs" : "%s/%03x_d.szs";
+		    snprintf(dest,sizeof(dest),format,opt_track_dest,dest_slot);
+		    TransferTrackDirFile(log,dest,src,ptr->num|flags);
 		}
 		break;
 	    }
@@ -3702,12 +4000,12 @@ void TransferTrackBySlot
 	snprintf( dest, sizeof(dest), format, opt_track_dest, dest_slot );
 	snprintf( src,  sizeof(src),  format, opt_track_dest, src_slot  );
 
-	if (!TransferFile(log,dest,src,TFMD_LINK|flags,0666))
+	if (!TransferTrackDirFile(log,dest,src,TFMD_LINK|flags))
 	{
 	    ccp format = lecode_04x ? "%s/%04x_d.szs" : "%s/%03x_d.szs";
 	    snprintf( dest, sizeof(dest), format, opt_track_dest, dest_slot );
 	    snprintf( src,  sizeof(src),  format, opt_track_dest, src_slot  );
-	    TransferFile(log,dest,src,TFMD_LINK|flags,0666);
+	    TransferTrackDirFile(log,dest,src,TFMD_LINK|flags);
 	}
     }
 }
@@ -1490,6 +1490,30 @@ ccp GetLEInValid ( le_valid_t valid );
 void CalculateStatsLE ( le_analyze_t *ana );
 void DumpLEAnalyse ( FILE *f, uint indent, const le_analyze_t *ana );
 
+//-----------------------------------------------------------------------------
+// [[track_dir_file_t]]
+// Track files of a directory, see FindTrackDirFile().
+// The key is the file name without '.szs'. The index is only used to find
+// names. A file may be modified after the scan, so use stat() for its size.
+
+typedef struct track_dir_file_t
+{
+    bool		have_std;	// true: '<name>.szs' is a regular file
+    bool		have_d;		// true: '<name>_d.szs' is a regular file
+}
+track_dir_file_t;
+
+// Find '<dir>/<name>.szs' and '<dir>/<name>_d.szs' in the directory index.
+// The index of a directory is created at first access. Returns NULL if
+// the name is unknown, else check 'have_std' and 'have_d'.
+const track_dir_file_t * FindTrackDirFile ( ccp dir, ccp name );
+
+// Like stat(path) && S_ISREG(). For '*.szs', unknown names are rejected
+// by the directory index without calling stat().
+bool IsTrackFile ( ccp path, uint *size );
+
+//-----------------------------------------------------------------------------
+
 ccp FindTrackFile ( ccp src_name, TransferMode_t *tfer_mode ); // returns NULL or alloced path
 void TransferTrackFile   ( LogFile_t *log, uint dest_slot, ccp  src_name, TransferMode_t flags );
 void TransferTrackBySlot ( LogFile_t *log, uint dest_slot, uint src_slot, TransferMode_t flags );
@@ -8210,21 +8210,22 @@ static enumError close_lta ( lta_manager_t *lm )
 
 //-----------------------------------------------------------------------------
 
-static void load_file_lta
+static void prepare_file_lta
 (
+    // load and convert a file, but don't store it
+
     lta_manager_t	*lm,	// lta manager
-    lta_node_record_t	*rec,	// record to process
+    lta_file_t		*lf,	// data to initialize
     ccp			fname,	// file name
-    bool		is_d	// TRUE: is _d file
+    uint		fsize	// size of file
 )
 {
     DASSERT(lm);
-    DASSERT(rec);
+    DASSERT(lf);
     DASSERT(fname);
 
-    progress_lta(lm,false);
-
-    uint fsize = rec->szs_size;
+    memset(lf,0,sizeof(*lf));
+    lf->info.file_size = fsize;
     if (!fsize)
 	return;
 
@@ -8236,106 +8237,339 @@ static void load_file_lta
     }
 
     u8 *fdata = lm->buf;
-    if (!LoadFILE(fname,0,0,fdata,fsize,0,0,false))
-    {
-	lm->progress_tracks++;
-
-	if (lm->rm_source)
-	    InsertStringField(&lm->ld->remove_files,fname,false);
+    if (LoadFILE(fname,0,0,fdata,fsize,0,0,false))
+	return;
 
-	szs_file_t szs;
-	AssignSZS(&szs,true,fdata,fsize,false,FF_UNKNOWN,fname);
-	PRINT0("data=%d,%zu, cdata=data=%d,%zu, ff=%s\n",
-		szs.data!=0, szs.size,szs.cdata!=0, szs.csize, GetNameFF_SZS(&szs) );
+    lf->info.loaded = true;
+    szs_file_t *szs = &lf->szs;
+    AssignSZS(szs,true,fdata,fsize,false,FF_UNKNOWN,fname);
+    PRINT0("data=%d,%zu, cdata=data=%d,%zu, ff=%s\n",
+		szs->data!=0, szs->size,szs->cdata!=0, szs->csize, GetNameFF_SZS(szs) );
 
-	if ( lm->force_ff != FF_UNKNOWN && lm->force_ff != szs.fform_file )
+    if ( lm->force_ff != FF_UNKNOWN && lm->force_ff != szs->fform_file )
+    {
+	enumError err = CompressWith(szs,COMPR_DEFAULT,false,lm->force_ff,FF_UNKNOWN);
+	if ( !err && szs->cdata )
 	{
-	    enumError err = CompressWith(&szs,COMPR_DEFAULT,false,lm->force_ff,FF_UNKNOWN);
-	    if ( !err && szs.cdata )
+	    fdata = szs->cdata;
+	    fsize = szs->csize;
+	    if (szs->cache_used)
+		lf->info.cache_used = true;
+	    else
 	    {
-		fdata = szs.cdata;
-		fsize = szs.csize;
-		if (szs.cache_used)
-		    lm->cache_count++;
-		else
+		lf->info.converted = true;
+	     #if 0
+		if ( !err && szs->cache_fname )
 		{
-		    lm->convert_count++;
-		 #if 0
-		    if ( !err && szs.cache_fname )
-		    {
-			File_t F;
-			CreateFile(&F,true,szs.cache_fname,FM_SILENT|FM_REMOVE);
-			if (F.f)
-			    fwrite(fdata,1,fsize,F.f);
-			ResetFile(&F,false);
-		    }
-		 #endif
+		    File_t F;
+		    CreateFile(&F,true,szs->cache_fname,FM_SILENT|FM_REMOVE);
+		    if (F.f)
+			fwrite(fdata,1,fsize,F.f);
+		    ResetFile(&F,false);
 		}
+	     #endif
 	    }
 	}
+    }
 
-	ccp ext = GetExtFF(szs.fform_file,szs.fform_arch);
-	if (ext)
-	    AppendFastBuf(&lm->ext,ext+1,strlen(ext));
-	else
-	    AppendFastBuf(&lm->ext,EmptyString,1);
+    lf->info.fform_file = szs->fform_file;
+    lf->info.fform_arch = szs->fform_arch;
+    lf->info.data_size  = fsize;
+    lf->data = fdata;
+}
 
-	if (is_d)
-	    lm->d_count++;
-	else
-	    lm->std_count++;
+//-----------------------------------------------------------------------------
+
+static void create_lfl_lta ( lta_file_t *lf )
+{
+    DASSERT(lf);
+    if ( lf->info.have_lfl || !lf->info.loaded )
+	return;
+
+    szs_file_t *szs = &lf->szs;
+    DecodeWU8(szs);
+    CollectCommonFilesSZS(szs,true,SORT_NONE);
+    CreateLFL(szs,0,true,true); // sorting is defined here
+    PRINT0("LFL: %p %zu\n",szs->data,szs->size);
+    if (szs->size)
+    {
+	lf->lfl = szs->data;
+	lf->info.lfl_size = szs->size;
+	szs->fname = 0;
+    }
+    lf->info.have_lfl = true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void reset_file_lta ( lta_file_t *lf )
+{
+    DASSERT(lf);
+    ResetSZS(&lf->szs);
+    FREE(lf->buf);
+    memset(lf,0,sizeof(*lf));
+}
 
-	sha1_size_b64_t sha1_szs;
-	CreateSS64(fdata,fsize,sha1_szs);
+//-----------------------------------------------------------------------------
+
+static void store_file_lta
+(
+    lta_manager_t	*lm,	// lta manager
+    lta_node_record_t	*rec,	// record to process
+    ccp			fname,	// file name
+    bool		is_d,	// TRUE: is _d file
+    lta_file_t		*lf	// prepared file
+)
+{
+    DASSERT(lm);
+    DASSERT(rec);
+    DASSERT(fname);
+    DASSERT(lf);
 
+    if (!lf->info.loaded)
+	return;
+
+    lm->progress_tracks++;
+
+    if (lm->rm_source)
+	InsertStringField(&lm->ld->remove_files,fname,false);
+
+    if (lf->info.cache_used)
+	lm->cache_count++;
+    else if (lf->info.converted)
+	lm->convert_count++;
+
+    ccp ext = GetExtFF(lf->info.fform_file,lf->info.fform_arch);
+    if (ext)
+	AppendFastBuf(&lm->ext,ext+1,strlen(ext));
+    else
+	AppendFastBuf(&lm->ext,EmptyString,1);
+
+    if (is_d)
+	lm->d_count++;
+    else
+	lm->std_count++;
+
+    const uint fsize = lf->info.data_size;
+    sha1_size_b64_t sha1_szs;
+    CreateSS64(lf->data,fsize,sha1_szs);
+
+    bool old_found;
+    exmem_key_t *eml_szs = FindInsertEML(&lm->stored_szs,sha1_szs,CPM_COPY,&old_found);
+    if (old_found)
+    {
+	lm->szs_dup_count++;
+	*rec = *(lta_node_record_t*)eml_szs->data.data.ptr;
+	return;
+    }
+
+    rec->szs_off = lm->data_offset;
+    rec->szs_size = fsize;
+    WriteFileAt(&lm->F,&lm->current_offset,lm->data_offset,lf->data,fsize);
+    lm->data_offset += ALIGN32(fsize,opt_align_lta);
+
+    create_lfl_lta(lf);
+    if (lf->info.lfl_size)
+    {
+	sha1_size_b64_t sha1_lfl;
+	CreateSS64(lf->lfl,lf->info.lfl_size,sha1_lfl);
 	bool old_found;
-	exmem_key_t *eml_szs = FindInsertEML(&lm->stored_szs,sha1_szs,CPM_COPY,&old_found);
+	exmem_key_t *eml_lfl = FindInsertEML(&lm->stored_lfl,sha1_lfl,CPM_COPY,&old_found);
 	if (old_found)
 	{
-	    lm->szs_dup_count++;
-	    *rec = *(lta_node_record_t*)eml_szs->data.data.ptr;
-	    return;
+	    lm->lfl_dup_count++;
+	    lta_node_par_t *temp = (lta_node_par_t*)eml_lfl->data.data.ptr;
+	    rec->lfl_off  = temp->offset;
+	    rec->lfl_size = temp->size;
 	}
+	else
+	{
+	    rec->lfl_off  = lm->data_offset;
+	    rec->lfl_size = lf->info.lfl_size;
+	    WriteFileAt(&lm->F,&lm->current_offset,lm->data_offset,lf->lfl,lf->info.lfl_size);
+	    lm->data_offset += ALIGN32(lf->info.lfl_size,opt_align_lta);
+	    lm->lfl_count++;
 
-	rec->szs_off = lm->data_offset;
-	rec->szs_size = fsize;
-	WriteFileAt(&lm->F,&lm->current_offset,lm->data_offset,fdata,fsize);
-	lm->data_offset += ALIGN32(fsize,opt_align_lta);
+	    lta_node_par_t par = { .offset = rec->lfl_off, .size = rec->lfl_size };
+	    eml_lfl->data = ExMemDup(&par,sizeof(par));
+	}
+    }
+    eml_szs->data = ExMemDup(rec,sizeof(*rec));
+}
 
-	DecodeWU8(&szs);
-	CollectCommonFilesSZS(&szs,true,SORT_NONE);
-	CreateLFL(&szs,0,true,true); // sorting is defined here
-	PRINT0("LFL: %p %zu\n",szs.data,szs.size);
-	if (szs.size)
+//-----------------------------------------------------------------------------
+
+static void load_file_lta
+(
+    lta_manager_t	*lm,	// lta manager
+    lta_node_record_t	*rec,	// record to process
+    ccp			fname,	// file name
+    bool		is_d	// TRUE: is _d file
+)
+{
+    DASSERT(lm);
+    DASSERT(rec);
+    DASSERT(fname);
+
+    progress_lta(lm,false);
+
+    lta_file_t lf;
+    prepare_file_lta(lm,&lf,fname,rec->szs_size);
+    store_file_lta(lm,rec,fname,is_d,&lf);
+    reset_file_lta(&lf);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Parallel mode: The files are loaded and converted by forked workers
+// (see NextParallelJob()). The results are read in order of the slots and
+// stored by the main process, so that the layout of the LTA files is the
+// same as in sequential mode.
+
+static enumError prepare_file_lta_job ( ccp fname, void *param )
+{
+    DASSERT(fname);
+    DASSERT(param);
+    DASSERT(parallel_job_result);
+
+    lta_manager_t *lm = param;
+    FILE *f = parallel_job_result;
+
+    struct stat st;
+    lta_file_t lf;
+    prepare_file_lta(lm,&lf,fname,
+		!stat(fname,&st) && S_ISREG(st.st_mode) ? st.st_size : 0 );
+
+    // the data may be modified by create_lfl_lta() => write it first
+    // and update the header at the end
+
+    fwrite(&lf.info,sizeof(lf.info),1,f);
+    if (lf.info.data_size)
+	fwrite(lf.data,lf.info.data_size,1,f);
+    create_lfl_lta(&lf);
+    if (lf.info.lfl_size)
+	fwrite(lf.lfl,lf.info.lfl_size,1,f);
+    rewind(f);
+    fwrite(&lf.info,sizeof(lf.info),1,f);
+
+    reset_file_lta(&lf);
+    return ferror(f) ? ERR_WRITE_FAILED : ERR_OK;
+}
+
+//-----------------------------------------------------------------------------
+
+static void plan_jobs_lta ( lta_manager_t *lm, StringField_t *plist )
+{
+    // one job for each call of fetch_file_lta() in the same order,
+    // so the list must not be sorted and duplicates must be kept
+
+    DASSERT(lm);
+    DASSERT(plist);
+
+    le_distrib_t *ld = lm->ld;
+    lm->slot_files = CALLOC(lm->distrib_end_slot+1,sizeof(*lm->slot_files));
+    lm->pfile_slot[0] = lm->pfile_slot[1] = -1;
+
+    for ( int slot = 0; slot < lm->distrib_end_slot; slot++ )
+    {
+	le_track_t *lt = GetTrackLD(ld,slot);
+	if (!IsActiveLT(lt))
+	    continue;
+
+	ccp fname = GetPathL2(ld,lt,ld->spar.opt,0);
+	if (!fname)
+	    continue;
+
+	if (!IsTrackFile(fname,0))
+	    continue;
+
+	lm->slot_files[slot] = 1;
+	AppendStringField(plist,fname,false);
+
+	char path[PATH_MAX];
+	Insert_d(path,sizeof(path),fname);
+	if (IsTrackFile(path,0))
 	{
-	    sha1_size_b64_t sha1_lfl;
-	    CreateSS64(szs.data,szs.size,sha1_lfl);
-	    bool old_found;
-	    exmem_key_t *eml_lfl = FindInsertEML(&lm->stored_lfl,sha1_lfl,CPM_COPY,&old_found);
-	    if (old_found)
-	    {
-		lm->lfl_dup_count++;
-		lta_node_par_t *temp = (lta_node_par_t*)eml_lfl->data.data.ptr;
-		rec->lfl_off  = temp->offset;
-		rec->lfl_size = temp->size;
-	    }
-	    else
-	    {
-		rec->lfl_off  = lm->data_offset;
-		rec->lfl_size = szs.size;
-		WriteFileAt(&lm->F,&lm->current_offset,lm->data_offset,szs.data,szs.size);
-		lm->data_offset += ALIGN32(szs.size,opt_align_lta);
-		lm->lfl_count++;
-
-		lta_node_par_t par = { .offset = rec->lfl_off, .size = rec->lfl_size };
-		eml_lfl->data = ExMemDup(&par,sizeof(par));
-	    }
+	    lm->slot_files[slot] |= 2;
+	    AppendStringField(plist,path,false);
+	}
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void close_jobs_lta ( lta_manager_t *lm )
+{
+    DASSERT(lm);
+    if (lm->pjobs)
+    {
+	ResetParallelJobs(lm->pjobs);
+	lm->pjobs = 0;
+    }
+    reset_file_lta(lm->pfile);
+    reset_file_lta(lm->pfile+1);
+    FREE(lm->slot_files);
+    lm->slot_files = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static enumError fetch_file_lta
+(
+    // returns an error, if the worker of the file did not finish;
+    // the LTA would be incomplete then
+
+    lta_manager_t	*lm,	// lta manager
+    lta_node_record_t	*rec,	// record to process
+    ccp			fname,	// file name
+    bool		is_d,	// TRUE: is _d file
+    int			slot	// current slot
+)
+{
+    DASSERT(lm);
+    DASSERT(lm->pjobs);
+    DASSERT(rec);
+    DASSERT(fname);
+
+    progress_lta(lm,false);
+
+    // a slot is processed twice if a new LTA file is started => keep results
 
-	    szs.fname = 0;
+    lta_file_t *lf = lm->pfile + is_d;
+    if ( lm->pfile_slot[is_d] != slot )
+    {
+	reset_file_lta(lf);
+	lm->pfile_slot[is_d] = slot;
+
+	FILE *f;
+	enumError err;
+	if ( NextParallelJob(lm->pjobs,&err,&f) < 0 || !f )
+	    return ERROR0(ERR_ERROR,"Worker not finished: %s\n",fname);
+
+	if ( err > ERR_WARNING )
+	{
+	    fclose(f);
+	    return ERROR0(ERR_ERROR,"Worker failed: %s\n",fname);
 	}
-	ResetSZS(&szs);
-	eml_szs->data = ExMemDup(rec,sizeof(*rec));
+
+	if ( fread(&lf->info,sizeof(lf->info),1,f) != 1 )
+	    err = ERR_READ_FAILED;
+	else if (lf->info.loaded)
+	{
+	    const uint size = lf->info.data_size + lf->info.lfl_size;
+	    lf->buf  = MALLOC( size ? size : 1 );
+	    lf->data = lf->buf;
+	    lf->lfl  = lf->buf + lf->info.data_size;
+	    if ( size && fread(lf->buf,size,1,f) != 1 )
+		err = ERR_READ_FAILED;
+	}
+	fclose(f);
+	if ( err > ERR_WARNING )
+	    return ERROR0(err,"Can't read result of worker: %s\n",fname);
     }
+
+    rec->szs_size = lf->info.file_size;
+    store_file_lta(lm,rec,fname,is_d,lf);
+    return ERR_OK;
 }
 
 //-----------------------------------------------------------------------------
@@ -8445,8 +8679,7 @@ enumError CreateTrackArchivesLD ( le_distrib_t *ld, ccp destdir, mem_t mem_opt )
 	if (!fname)
 	    continue;
 
-	struct stat st;
-	if ( stat(fname,&st) || !S_ISREG(st.st_mode) )
+	if (!IsTrackFile(fname,0))
 	    continue;
 
 	lm.distrib_end_slot = slot + 1;
@@ -8455,6 +8688,20 @@ enumError CreateTrackArchivesLD ( le_distrib_t *ld, ccp destdir, mem_t mem_opt )
     }
 
 
+    //--- parallel mode: load and convert the files by workers
+
+    StringField_t plist;
+    InitializeStringField(&plist);
+    parallel_jobs_t pjobs;
+    if ( opt_threads > 1 )
+    {
+	plan_jobs_lta(&lm,&plist);
+	SetupParallelJobs(&pjobs,&plist,opt_threads,prepare_file_lta_job,&lm,true);
+	pjobs.stop_on_error = true;
+	lm.pjobs = &pjobs;
+    }
+
+
     //--- main loop
 
     for ( int slot = 0; slot < lm.distrib_end_slot; slot++ )
@@ -8473,8 +8720,10 @@ enumError CreateTrackArchivesLD ( le_distrib_t *ld, ccp destdir, mem_t mem_opt )
 	if (!fname)
 	    goto cont;
 
-	struct stat st;
-	if ( stat(fname,&st) || !S_ISREG(st.st_mode) )
+	uint size = 0;
+	if ( lm.slot_files
+		? !( lm.slot_files[slot] & 1 )
+		: !IsTrackFile(fname,&size) )
 	    goto cont;
 
 	if ( slot >= lm.base_slot + LTA_MAX_NODES )
@@ -8495,27 +8744,51 @@ enumError CreateTrackArchivesLD ( le_distrib_t *ld, ccp destdir, mem_t mem_opt )
 	    PathCatBufPPE(path,sizeof(path),lm.destdir,tname,".lta");
 	    enumError err = CreateFileOpt(&lm.F,true,path,false,0);
 	    if (err)
+	    {
+		close_jobs_lta(&lm);
+		ResetStringField(&plist);
 		return err;
+	    }
 	}
 
 	const uint saved_data_offset = lm.data_offset;
 	const uint saved_ext_size = GetFastBufLen(&lm.ext);
-	lta_node_t node = { .std.szs_size = st.st_size };
-	load_file_lta(&lm,&node.std,fname,false);
+	lta_node_t node = { .std.szs_size = size };
+	enumError err = ERR_OK;
+	if (lm.pjobs)
+	    err = fetch_file_lta(&lm,&node.std,fname,false,slot);
+	else
+	    load_file_lta(&lm,&node.std,fname,false);
 
 
 	//--- _d file
 
 	Insert_d(path,sizeof(path),fname);
-	const bool have_d = !stat(path,&st) && S_ISREG(st.st_mode);
+	const bool have_d = lm.slot_files
+		? ( lm.slot_files[slot] & 2 ) != 0
+		: IsTrackFile(path,&size);
 	if (have_d)
 	{
-	    node.d.szs_size = st.st_size;
-	    load_file_lta(&lm,&node.d,path,true);
+	    node.d.szs_size = size;
+	    if (!lm.pjobs)
+		load_file_lta(&lm,&node.d,path,true);
+	    else if (!err)
+		err = fetch_file_lta(&lm,&node.d,path,true,slot);
 	}
 	else
 	    AppendFastBuf(&lm.ext,EmptyString,1);
 
+	if (err)
+	{
+	    // a worker failed => remove the incomplete LTA by ResetFile()
+	    if ( lm.F.max_err < err )
+		 lm.F.max_err = err;
+	    ResetFile(&lm.F,0);
+	    close_jobs_lta(&lm);
+	    ResetStringField(&plist);
+	    return err;
+	}
+
 	if (!node.d.szs_off)
 	    node.d = node.std;
 
@@ -8534,6 +8807,8 @@ enumError CreateTrackArchivesLD ( le_distrib_t *ld, ccp destdir, mem_t mem_opt )
 	lm.last_slot = slot;
     }
     close_lta(&lm);
+    close_jobs_lta(&lm);
+    ResetStringField(&plist);
 
 
     //--- create lta.szs
@@ -4112,7 +4112,7 @@ ccp RenameForSlot42MDL
 	    for ( sect = 0; sect < S42M__N; sect++ )
 		if (rename[sect])
 		{
-		    ParamFieldItem_t *par = FindParamField(&mdl.spool.pf,rename[sect]);
+		    ParamFieldItem_t *par = FindParamHash(&mdl.spool.ph,rename[sect]);
 		    ccp pdata = par ? par->data : 0;
 		    fprintf(stdlog,"\t  %-13s <- %-30s %p %s\n",
 				Slot42MaterialInfo[sect].name, rename[sect],
@@ -4133,7 +4133,7 @@ ccp RenameForSlot42MDL
 	for ( sect = 0; sect < S42M__N; sect++ )
 	    if (rename[sect])
 	    {
-		ParamFieldItem_t *par = FindParamField(&mdl.spool.pf,rename[sect]);
+		ParamFieldItem_t *par = FindParamHash(&mdl.spool.ph,rename[sect]);
 		if ( !par || !par->data )
 		{
 		    errmsg = "Internal Error";
@@ -203,6 +203,81 @@ int ScanOptMaxFileSize ( ccp arg )
 
 //-----------------------------------------------------------------------------
 
+static int ScanThreadsHelper ( u32 *num, ccp arg, ccp opt_name )
+{
+    DASSERT(num);
+
+    static const KeywordTab_t tab[] =
+    {
+	{  0,	"OFF",	    0,		0 },
+	{  1,	"AUTO",	    0,		0 },
+	{ 0,0,0,0 }
+    };
+
+    const KeywordTab_t * cmd = ScanKeyword(0,arg,tab);
+    if (cmd)
+    {
+	if (cmd->id)
+	{
+	    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+	    *num = n > 0 ? n : 1;
+	}
+	else
+	    *num = 0;
+	return 0;
+    }
+
+    return ScanSizeOptU32(
+		num,			// u32 * num
+		arg,			// ccp source
+		1,			// default_factor1
+		0,			// int force_base
+		opt_name,		// ccp opt_name
+		0,			// u64 min
+		1000,			// u64 max
+		0,			// u32 multiple
+		0,			// u32 pow2
+		true			// bool print_err
+		) != ERR_OK;
+}
+
+//-----------------------------------------------------------------------------
+
+int ScanOptThreads ( ccp arg )
+{
+    return ScanThreadsHelper(&opt_threads,arg,"threads");
+}
+
+//-----------------------------------------------------------------------------
+
+int ScanOptComprThreads ( ccp arg )
+{
+    return ScanThreadsHelper(&opt_compr_threads,arg,"compr-threads");
+}
+
+//-----------------------------------------------------------------------------
+
+int ScanOptKclThreads ( ccp arg )
+{
+    return ScanThreadsHelper(&opt_kcl_threads,arg,"kcl-threads");
+}
+
+//-----------------------------------------------------------------------------
+
+int ScanOptCmprThreads ( ccp arg )
+{
+    return ScanThreadsHelper(&opt_cmpr_threads,arg,"cmpr-threads");
+}
+
+//-----------------------------------------------------------------------------
+
+int ScanOptPalThreads ( ccp arg )
+{
+    return ScanThreadsHelper(&opt_pal_threads,arg,"pal-threads");
+}
+
+//-----------------------------------------------------------------------------
+
 int ScanOptEpsilon ( ccp arg )
 {
     // [[2do]] ???
@@ -311,6 +386,30 @@ int ScanOptMipmapSize ( ccp arg )
     return stat;
 }
 
+//-----------------------------------------------------------------------------
+
+int ScanOptMipmapFilter ( ccp arg )
+{
+    static const KeywordTab_t tab[] =
+    {
+	{ MMF_SMART,	"SMART",	"DEFAULT",	0 },
+	{ MMF_BOX,	"BOX",		0,		0 },
+	{ MMF_BILINEAR,	"BILINEAR",	"LINEAR",	0 },
+	{ MMF_LANCZOS,	"LANCZOS",	0,		0 },
+	{ 0,0,0,0 }
+    };
+
+    const KeywordTab_t * cmd = ScanKeyword(0,arg,tab);
+    if (cmd)
+    {
+	opt_mipmap_filter = cmd->id;
+	return 0;
+    }
+
+    ERROR0(ERR_SYNTAX,"Invalid mipmap filter (option --mipmap-filter): '%s'\n",arg);
+    return 1;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			  scan num/range		///////////////
@@ -1200,10 +1299,253 @@ bool OverlapCubeTri
     double3		*pt3		// third point of triangle
 )
 {
-    ERROR0(ERR_NOT_IMPLEMENTED,0);
-    return false;
+    DASSERT(cube_mid);
+    DASSERT( pt1 && pt2 && pt3 );
+
+    // a single triangle: use a stack buffer instead of SetupTriSOA()
+    double buf[TSOA__N];
+    tri_soa_t soa;
+    soa.n = 1;
+    for ( uint i = 0; i < TSOA__N; i++ )
+	soa.d[i] = buf + i;
+    SetTriSOA(&soa,0,pt1,pt2,pt3);
+
+    soa_cube_t cube;
+    cube.half = cube_width / 2;
+    cube.mid = *cube_mid;
+    cube.min.x = cube_mid->x - cube.half;
+    cube.min.y = cube_mid->y - cube.half;
+    cube.min.z = cube_mid->z - cube.half;
+    cube.max.x = cube_mid->x + cube.half;
+    cube.max.y = cube_mid->y + cube.half;
+    cube.max.z = cube_mid->z + cube.half;
+
+    const u32 idx = 0;
+    u32 res;
+    return OverlapCubeTriSOA(&soa,&cube,&idx,1,&res) > 0;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    tri_soa_t			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SetupTriSOA ( tri_soa_t *soa, uint n_tri )
+{
+    DASSERT(soa);
+    memset(soa,0,sizeof(*soa));
+    soa->n = n_tri;
+
+    // one block for all arrays
+    double *d = n_tri ? MALLOC( TSOA__N * n_tri * sizeof(*d) ) : 0;
+    for ( uint i = 0; i < TSOA__N; i++, d += n_tri )
+	soa->d[i] = d;
+}
+
+//-----------------------------------------------------------------------------
+
+void ResetTriSOA ( tri_soa_t *soa )
+{
+    if (soa)
+    {
+	FREE(soa->d[0]);
+	memset(soa,0,sizeof(*soa));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetTriSOA
+(
+    tri_soa_t		*soa,		// valid data
+    uint		idx,		// index of triangle, < soa->n
+    const double3	*pt1,		// first point of triangle
+    const double3	*pt2,		// second point of triangle
+    const double3	*pt3		// third point of triangle
+)
+{
+    DASSERT(soa);
+    DASSERT( idx < soa->n );
+    DASSERT( pt1 && pt2 && pt3 );
+
+    double3 e0, e1, e2, norm;
+    Sub3(e0,*pt2,*pt1);
+    Sub3(e1,*pt3,*pt2);
+    Sub3(e2,*pt1,*pt3);
+    CrossProd3(norm,e0,e1);
+
+    double **d = soa->d;
+    for ( uint p = 0; p < 3; p++ )
+    {
+	d[TSOA_P0X+p][idx] = pt1->v[p];
+	d[TSOA_P1X+p][idx] = pt2->v[p];
+	d[TSOA_P2X+p][idx] = pt3->v[p];
+	d[TSOA_E0X+p][idx] = e0.v[p];
+	d[TSOA_E1X+p][idx] = e1.v[p];
+	d[TSOA_E2X+p][idx] = e2.v[p];
+	d[TSOA_NX +p][idx] = norm.v[p];
+
+	double min, max;
+	MinMax3p(min,max,pt1->v[p],pt2->v[p],pt3->v[p]);
+	d[TSOA_MINX+p][idx] = min;
+	d[TSOA_MAXX+p][idx] = max;
+    }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The kernel uses vector extensions of GCC (see SIMD_CLONES).
+
+#define TSOA_VLEN 4
+typedef double    tsoa_vd __attribute__ ((vector_size(TSOA_VLEN*sizeof(double))));
+typedef long long tsoa_vl __attribute__ ((vector_size(TSOA_VLEN*sizeof(double))));
+
+//-----------------------------------------------------------------------------
+
+// separating axis test for an edge: 'ok' becomes 0 for separated lanes
+
+#define TSOA_AXIS(pa,pb) \
+	ok &= ~( ( pa > rad & pb > rad ) | ( pa < -rad & pb < -rad ) );
+
+// select a where mask m is set, and b otherwise
+
+#define TSOA_SELECT(m,a,b) \
+	(tsoa_vd)( (tsoa_vl)(a) & (m) | (tsoa_vl)(b) & ~(m) )
+
+// absolute value by clearing the sign bit
+
+#define TSOA_ABS(a) \
+	(tsoa_vd)( (tsoa_vl)(a) & 0x7fffffffffffffffll )
+
+//-----------------------------------------------------------------------------
+
+SIMD_CLONES uint OverlapCubeTriSOA
+(
+    const tri_soa_t	*soa,		// triangle data
+    const soa_cube_t	*cube,		// cube to test
+    const u32		*idx,		// list of triangle indices
+    uint		n_idx,		// number of elements in 'idx'
+    u32			*res		// store indices of overlapping triangles
+					// here; may be the same as 'idx'
+)
+{
+    //------------------------------------------------------------
+    // we use this algorithm:
+    // http://jgt.akpeters.com/papers/AkenineMoller01/tribox.html
+    // The calculation order is the same as in the scalar version.
+    //------------------------------------------------------------
+
+    DASSERT(soa);
+    DASSERT(cube);
+    DASSERT( idx || !n_idx );
+    DASSERT( res || !n_idx );
+
+    double *const* d = soa->d;
+    const double half = cube->half;
+    uint n_res = 0;
+
+    for ( uint i = 0; i < n_idx; i += TSOA_VLEN )
+    {
+	//--- gather the triangles, fill the last packet with the last index
+
+	u32 ti[TSOA_VLEN];
+	for ( uint l = 0; l < TSOA_VLEN; l++ )
+	    ti[l] = idx[ i+l < n_idx ? i+l : n_idx-1 ];
+
+	#undef LOAD
+	#define LOAD(a) (tsoa_vd){ d[a][ti[0]], d[a][ti[1]], d[a][ti[2]], d[a][ti[3]] }
+
+	//--- Bullet 1:  test the cube, that surrounds the triangle
+
+	tsoa_vl ok
+	    =  ( LOAD(TSOA_MINX) <= cube->max.x ) & ( LOAD(TSOA_MAXX) >= cube->min.x )
+	     & ( LOAD(TSOA_MINY) <= cube->max.y ) & ( LOAD(TSOA_MAXY) >= cube->min.y )
+	     & ( LOAD(TSOA_MINZ) <= cube->max.z ) & ( LOAD(TSOA_MAXZ) >= cube->min.z );
+
+	if ( !ok[0] && !ok[1] && !ok[2] && !ok[3] )
+	    continue;
+
+	//--- center cube and triangle
+
+	const tsoa_vd v0x = LOAD(TSOA_P0X) - cube->mid.x;
+	const tsoa_vd v0y = LOAD(TSOA_P0Y) - cube->mid.y;
+	const tsoa_vd v0z = LOAD(TSOA_P0Z) - cube->mid.z;
+	const tsoa_vd v1x = LOAD(TSOA_P1X) - cube->mid.x;
+	const tsoa_vd v1y = LOAD(TSOA_P1Y) - cube->mid.y;
+	const tsoa_vd v1z = LOAD(TSOA_P1Z) - cube->mid.z;
+	const tsoa_vd v2x = LOAD(TSOA_P2X) - cube->mid.x;
+	const tsoa_vd v2y = LOAD(TSOA_P2Y) - cube->mid.y;
+	const tsoa_vd v2z = LOAD(TSOA_P2Z) - cube->mid.z;
+
+	//--- Bullet 3:
+
+	tsoa_vd ex, ey, ez, fx, fy, fz, p0, p1, p2, rad;
+
+	ex = LOAD(TSOA_E0X); fx = TSOA_ABS(ex);
+	ey = LOAD(TSOA_E0Y); fy = TSOA_ABS(ey);
+	ez = LOAD(TSOA_E0Z); fz = TSOA_ABS(ez);
+
+	p0 = ez*v0y - ey*v0z; p2 = ez*v2y - ey*v2z;	// X01
+	rad = ( fz + fy ) * half; TSOA_AXIS(p0,p2);
+	p0 = -ez*v0x + ex*v0z; p2 = -ez*v2x + ex*v2z;	// Y02
+	rad = ( fz + fx ) * half; TSOA_AXIS(p0,p2);
+	p1 = ey*v1x - ex*v1y; p2 = ey*v2x - ex*v2y;	// Z12
+	rad = ( fy + fx ) * half; TSOA_AXIS(p1,p2);
+
+	ex = LOAD(TSOA_E1X); fx = TSOA_ABS(ex);
+	ey = LOAD(TSOA_E1Y); fy = TSOA_ABS(ey);
+	ez = LOAD(TSOA_E1Z); fz = TSOA_ABS(ez);
+
+	p0 = ez*v0y - ey*v0z; p2 = ez*v2y - ey*v2z;	// X01
+	rad = ( fz + fy ) * half; TSOA_AXIS(p0,p2);
+	p0 = -ez*v0x + ex*v0z; p2 = -ez*v2x + ex*v2z;	// Y02
+	rad = ( fz + fx ) * half; TSOA_AXIS(p0,p2);
+	p0 = ey*v0x - ex*v0y; p1 = ey*v1x - ex*v1y;	// Z0
+	rad = ( fy + fx ) * half; TSOA_AXIS(p0,p1);
+
+	ex = LOAD(TSOA_E2X); fx = TSOA_ABS(ex);
+	ey = LOAD(TSOA_E2Y); fy = TSOA_ABS(ey);
+	ez = LOAD(TSOA_E2Z); fz = TSOA_ABS(ez);
+
+	p0 = ez*v0y - ey*v0z; p1 = ez*v1y - ey*v1z;	// X2
+	rad = ( fz + fy ) * half; TSOA_AXIS(p0,p1);
+	p0 = -ez*v0x + ex*v0z; p1 = -ez*v1x + ex*v1z;	// Y1
+	rad = ( fz + fx ) * half; TSOA_AXIS(p0,p1);
+	p1 = ey*v1x - ex*v1y; p2 = ey*v2x - ex*v2y;	// Z12
+	rad = ( fy + fx ) * half; TSOA_AXIS(p1,p2);
+
+	//--- Bullet 2:
+	//  test if the box intersects the plane of the triangle
+
+	const tsoa_vd nx = LOAD(TSOA_NX);
+	const tsoa_vd ny = LOAD(TSOA_NY);
+	const tsoa_vd nz = LOAD(TSOA_NZ);
+
+	const tsoa_vl px = nx > 0.0, py = ny > 0.0, pz = nz > 0.0;
+	const tsoa_vd minx = TSOA_SELECT( px, -half - v0x,  half - v0x );
+	const tsoa_vd miny = TSOA_SELECT( py, -half - v0y,  half - v0y );
+	const tsoa_vd minz = TSOA_SELECT( pz, -half - v0z,  half - v0z );
+	const tsoa_vd maxx = TSOA_SELECT( px,  half - v0x, -half - v0x );
+	const tsoa_vd maxy = TSOA_SELECT( py,  half - v0y, -half - v0y );
+	const tsoa_vd maxz = TSOA_SELECT( pz,  half - v0z, -half - v0z );
+
+	ok &= ( nx*minx + ny*miny + nz*minz <= 0.0 )
+	    & ( nx*maxx + ny*maxy + nz*maxz >= 0.0 );
+
+	//--- store result
+
+	const uint n = n_idx - i < TSOA_VLEN ? n_idx - i : TSOA_VLEN;
+	for ( uint l = 0; l < n; l++ )
+	    if (ok[l])
+		res[n_res++] = ti[l];
+	#undef LOAD
+    }
+    return n_res;
+}
+
+#undef TSOA_AXIS
+#undef TSOA_SELECT
+#undef TSOA_ABS
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			  triangles			///////////////
@@ -1880,6 +2222,50 @@ int ScanOptCmprDefault ( ccp arg )
     return 0;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+int ScanOptCmprFit ( ccp arg )
+{
+    static const KeywordTab_t tab[] =
+    {
+	{ CMPR_FIT_RANGE,	"RANGE",	"DEFAULT",	0 },
+	{ CMPR_FIT_CLUSTER,	"CLUSTER",	0,		0 },
+	{ 0,0,0,0 }
+    };
+
+    const KeywordTab_t * cmd = ScanKeyword(0,arg,tab);
+    if (cmd)
+    {
+	opt_cmpr_fit = cmd->id;
+	return 0;
+    }
+
+    ERROR0(ERR_SYNTAX,"Invalid CMPR fit mode (option --cmpr-fit): '%s'\n",arg);
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int ScanOptPalQuant ( ccp arg )
+{
+    static const KeywordTab_t tab[] =
+    {
+	{ PAL_QUANT_MEDIAN_CUT,	"MEDIAN-CUT",	"DEFAULT",	0 },
+	{ PAL_QUANT_KMEANS,	"K-MEANS",	"KMEANS",	0 },
+	{ 0,0,0,0 }
+    };
+
+    const KeywordTab_t * cmd = ScanKeyword(0,arg,tab);
+    if (cmd)
+    {
+	opt_pal_quant = cmd->id;
+	return 0;
+    }
+
+    ERROR0(ERR_SYNTAX,"Invalid palette quantizer (option --pal-quant): '%s'\n",arg);
+    return 1;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			color conversion tables		///////////////
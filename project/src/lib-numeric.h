@@ -306,10 +306,16 @@ int ScanOptAlignBREFF	( ccp arg );
 int ScanOptAlignBREFT	( ccp arg );
 int ScanOptAlign	( ccp arg );
 int ScanOptMaxFileSize	( ccp arg );
+int ScanOptThreads	( ccp arg );
+int ScanOptComprThreads	( ccp arg );
+int ScanOptKclThreads	( ccp arg );
+int ScanOptCmprThreads	( ccp arg );
+int ScanOptPalThreads	( ccp arg );
 int ScanOptEpsilon	( ccp arg );
 int ScanOptNMipmaps	( ccp arg );
 int ScanOptMaxMipmaps	( ccp arg );
 int ScanOptMipmapSize	( ccp arg );
+int ScanOptMipmapFilter	( ccp arg );
 int ScanOptPtDir	( ccp arg );
 int ScanOptRecurse	( ccp arg );
 int ScanOptCase		( ccp arg );
@@ -515,6 +521,73 @@ bool OverlapCubeTri
     double3		*pt3		// third point of triangle
 );
 
+//-----------------------------------------------------------------------------
+// [[tri_soa_t]]
+
+// Triangles in a structure-of-arrays layout for OverlapCubeTriSOA().
+// The index TSOA_* selects the array, the triangle index the element.
+
+enum
+{
+    TSOA_P0X, TSOA_P0Y, TSOA_P0Z,	// first point
+    TSOA_P1X, TSOA_P1Y, TSOA_P1Z,	// second point
+    TSOA_P2X, TSOA_P2Y, TSOA_P2Z,	// third point
+    TSOA_E0X, TSOA_E0Y, TSOA_E0Z,	// edge p1-p0
+    TSOA_E1X, TSOA_E1Y, TSOA_E1Z,	// edge p2-p1
+    TSOA_E2X, TSOA_E2Y, TSOA_E2Z,	// edge p0-p2
+    TSOA_NX,  TSOA_NY,  TSOA_NZ,	// normal = e0 x e1
+    TSOA_MINX,TSOA_MINY,TSOA_MINZ,	// minimum of bounding box
+    TSOA_MAXX,TSOA_MAXY,TSOA_MAXZ,	// maximum of bounding box
+
+    TSOA__N				// number of arrays
+};
+
+typedef struct tri_soa_t
+{
+    uint		n;		// number of triangles
+    double		*d[TSOA__N];	// arrays with 'n' elements each
+
+} tri_soa_t;
+
+//-----------------------------------------------------------------------------
+
+typedef struct soa_cube_t
+{
+    double3		min;		// minimum for bounding box test
+    double3		max;		// maximum for bounding box test
+    double3		mid;		// middle of the cube for axis tests
+    double		half;		// half width of the cube for axis tests
+
+} soa_cube_t;
+
+//-----------------------------------------------------------------------------
+
+void SetupTriSOA ( tri_soa_t *soa, uint n_tri );
+void ResetTriSOA ( tri_soa_t *soa );
+
+void SetTriSOA
+(
+    tri_soa_t		*soa,		// valid data
+    uint		idx,		// index of triangle, < soa->n
+    const double3	*pt1,		// first point of triangle
+    const double3	*pt2,		// second point of triangle
+    const double3	*pt3		// third point of triangle
+);
+
+uint OverlapCubeTriSOA
+(
+    // Test a cube against many triangles (vectorized separating axis test).
+    // Returns the number of overlapping triangles. Their indices are stored
+    // in 'res' in the order of 'idx'.
+
+    const tri_soa_t	*soa,		// triangle data
+    const soa_cube_t	*cube,		// cube to test
+    const u32		*idx,		// list of triangle indices
+    uint		n_idx,		// number of elements in 'idx'
+    u32			*res		// store indices of overlapping triangles
+					// here; may be the same as 'idx'
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			  triangles			///////////////
@@ -1030,6 +1103,13 @@ void MoveAllInitV ( Var_t *dest, Var_t * src );
 ///////////////////////////////////////////////////////////////////////////////
 // [[VarMap_t]]
 
+// A hash index is created for variable maps with at least this number of
+// elements. Smaller maps are searched by binary search only. Inserting and
+// removing elements only mark the hash index as dirty. It is rebuilt at
+// the next lookup, so that a sequence of inserts costs a single rebuild.
+
+#define VARMAP_HASH_MIN 16
+
 typedef struct VarMap_t
 {
     Var_t		*list;		// pointer to the item list
@@ -1037,6 +1117,11 @@ typedef struct VarMap_t
     uint		size;		// number of allocated  elements of 'list'
     LowerUpper_t	force_case;	// change case if LOUP_UPPER | LOUP_LOWER
 
+    uint		*hash;		// NULL or hash index of the names:
+					//   0=unused, else index+1 of 'list'
+    uint		hash_size;	// number of elements of 'hash', power of 2
+    bool		hash_dirty;	// true: rebuild 'hash' before next lookup
+
 } VarMap_t;
 
 //-----------------------------------------------------------------------------
@@ -2446,6 +2531,8 @@ static inline u16 RGB_to_RGB565 ( u32 rgb )
 }
 
 int ScanOptCmprDefault	( ccp arg );
+int ScanOptCmprFit	( ccp arg );
+int ScanOptPalQuant	( ccp arg );
 
 //
 ///////////////////////////////////////////////////////////////////////////////
@@ -4944,7 +4944,6 @@ static const struct FuncTable_t func_tab[] =
     { 3, MAX_FUNC_PARAM, "PTINCUBOIDS", F_ptsInCuboid, 1,	// altenative name
 	0,0,0 },
 
- #ifdef TEST // [[2do]]
     { 5, 5, "OVERLAPCUBETRI", F_OverlapCubeTri, 1,
 	"int", "OverlapCubeTri(cube_mid,cube_width,pt1,pt2,pt3)",
 	"'cube_mid' is the middle point of a cube"
@@ -4952,7 +4951,6 @@ static const struct FuncTable_t func_tab[] =
 	" 'pt1'..'pt3' are the 3 points of the triangle."
 	" The functions returns 1, if the cube and the triangle"
 	" are overlapped. Otherwise 0 is returned." },
- #endif
 
 
     //----- simple mathematical functions
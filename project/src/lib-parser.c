@@ -1366,6 +1366,11 @@ void ClearVarMap
 	vm->used = 0;
 	// not needed: memset(vm->list,0,sizeof(*vm->list)*vm->size);
     }
+
+    FREE(vm->hash);
+    vm->hash = 0;
+    vm->hash_size = 0;
+    vm->hash_dirty = false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1425,8 +1430,66 @@ void MoveVarMap
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static uint FindVarMapHelper ( const VarMap_t * vm, bool * p_found, ccp name )
+static uint * GetVarMapSlot ( const VarMap_t * vm, ccp name )
+{
+    // return the slot of 'name' or the empty slot to insert 'name'
+
+    DASSERT(vm);
+    DASSERT(vm->hash);
+    DASSERT(name);
+
+    const uint mask = vm->hash_size - 1;
+    uint idx = HashStringFNV(name) & mask;
+    while (vm->hash[idx])
+    {
+	if (!strcmp(name,vm->list[vm->hash[idx]-1].name))
+	    break;
+	idx = ( idx + 1 ) & mask;
+    }
+    return vm->hash + idx;
+}
+
+//-----------------------------------------------------------------------------
+
+static void RebuildVarMapHash ( VarMap_t * vm )
+{
+    // create, rebuild or remove the hash index, depending on 'vm->used'
+
+    DASSERT(vm);
+    vm->hash_dirty = false;
+
+    if ( vm->used < VARMAP_HASH_MIN )
+    {
+	FREE(vm->hash);
+	vm->hash = 0;
+	vm->hash_size = 0;
+	return;
+    }
+
+    // linear probing => load factor <= 50%
+    uint size = 0x40;
+    while ( size < 2*vm->used )
+	size <<= 1;
+
+    if ( size != vm->hash_size )
+    {
+	FREE(vm->hash);
+	vm->hash = CALLOC(size,sizeof(*vm->hash));
+	vm->hash_size = size;
+    }
+    else
+	memset(vm->hash,0,size*sizeof(*vm->hash));
+
+    for ( uint i = 0; i < vm->used; i++ )
+	*GetVarMapSlot(vm,vm->list[i].name) = i + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+static uint SearchVarMap ( const VarMap_t * vm, bool * p_found, ccp name )
 {
+    // binary search: return the index of 'name' or the index to insert it
+
     ASSERT(vm);
 
     int beg = 0;
@@ -1443,7 +1506,7 @@ static uint FindVarMapHelper ( const VarMap_t * vm, bool * p_found, ccp name )
 		beg = idx + 1;
 	    else
 	    {
-		TRACE("FindVarMapHelper(%s) FOUND=%d/%d/%d\n",
+		TRACE("SearchVarMap(%s) FOUND=%d/%d/%d\n",
 			name, idx, vm->used, vm->size );
 		if (p_found)
 		    *p_found = true;
@@ -1452,7 +1515,7 @@ static uint FindVarMapHelper ( const VarMap_t * vm, bool * p_found, ccp name )
 	}
     }
 
-    TRACE("FindVarMapHelper(%s) failed=%d/%d/%d\n",
+    TRACE("SearchVarMap(%s) failed=%d/%d/%d\n",
 		name, beg, vm->used, vm->size );
 
     if (p_found)
@@ -1460,6 +1523,36 @@ static uint FindVarMapHelper ( const VarMap_t * vm, bool * p_found, ccp name )
     return beg;
 }
 
+//-----------------------------------------------------------------------------
+
+static uint LookupVarMap ( const VarMap_t * vm, bool * p_found, ccp name )
+{
+    // Return the index of 'name'. If not found, the index to insert 'name'
+    // is only returned for maps without valid hash index (see SearchVarMap()).
+
+    if ( vm && name && vm->hash && !vm->hash_dirty )
+    {
+	const uint *slot = GetVarMapSlot(vm,name);
+	if (p_found)
+	    *p_found = *slot != 0;
+	return *slot ? *slot - 1 : vm->used;
+    }
+
+    return SearchVarMap(vm,p_found,name);
+}
+
+//-----------------------------------------------------------------------------
+
+static uint FindVarMapHelper ( const VarMap_t * vm, bool * p_found, ccp name )
+{
+    // like LookupVarMap(), but rebuild a dirty hash index first;
+    // the hash index is only a cache => modify it even for const maps
+
+    if ( vm && vm->hash_dirty )
+	RebuildVarMapHash((VarMap_t*)vm);
+    return LookupVarMap(vm,p_found,name);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 int FindVarMapIndex
@@ -1494,6 +1587,8 @@ bool RemoveVarMap
 	FreeV(dest);
 	FREE((char*)dest->name);
 	memmove(dest,dest+1,(vm->used-idx)*sizeof(*dest));
+	if (vm->hash)
+	    vm->hash_dirty = true;
     }
     return found;
 }
@@ -1530,8 +1625,9 @@ Var_t * InsertVarMap
 	move_varname = true;
     }
 
+    // don't rebuild a dirty hash index for each insert
     bool my_found;
-    const int idx = FindVarMapHelper(vm,&my_found,varname);
+    int idx = LookupVarMap(vm,&my_found,varname);
     if (found)
 	*found = my_found;
 
@@ -1561,6 +1657,9 @@ Var_t * InsertVarMap
 	    vm->list = REALLOC(vm->list,vm->size*sizeof(*vm->list));
 	}
 
+	if ( vm->hash && !vm->hash_dirty )
+	    idx = SearchVarMap(vm,0,varname);
+
 	DASSERT( idx <= vm->used );
 	var = vm->list + idx;
 	memmove(var+1,var,(vm->used-idx)*sizeof(*var));
@@ -1568,6 +1667,11 @@ Var_t * InsertVarMap
 
 	var->name = move_varname ? varname : STRDUP(varname);
 	var->mode = VAR_UNSET;
+
+	// the indices behind 'idx' have changed => rebuild the hash index
+	// at the next lookup, see FindVarMapHelper()
+	if ( vm->hash || vm->used >= VARMAP_HASH_MIN )
+	    vm->hash_dirty = true;
     }
 
     return var;
@@ -5546,10 +5650,15 @@ TextCommand_t GetTextCommand
     ccp			name		// name to scan, upper case is assumed
 )
 {
-    static FormatField_t cmdtab = {0};
-    if (!cmdtab.used)
+    // the commands are stored in a hash table with linear probing
+
+    enum { HASH_SIZE = 0x200 }; // power of 2, more than twice the number of commands
+    struct tcmdtab_t { ccp name; int id; };
+    static const struct tcmdtab_t *hashtab[HASH_SIZE];
+    static bool hashtab_valid = false;
+
+    if (!hashtab_valid)
     {
-	struct tcmdtab_t { ccp name; int id; };
 	static const struct tcmdtab_t def_tab[] =
 	{
 	    //--- messages
@@ -5687,16 +5796,143 @@ TextCommand_t GetTextCommand
 
 	const struct tcmdtab_t * cp;
 	for ( cp = def_tab; cp->name; cp++ )
-	    InsertFormatField(&cmdtab,cp->name,0,0,0)->num = cp->id;
+	{
+	    uint idx = HashStringFNV(cp->name) & (HASH_SIZE-1);
+	    while (hashtab[idx])
+		idx = ( idx + 1 ) & (HASH_SIZE-1);
+	    hashtab[idx] = cp;
+	}
+	hashtab_valid = true;
     }
 
-    FormatFieldItem_t * item = FindFormatField(&cmdtab,name);
-    return item ? item->num : TCMD_NONE;
+    uint idx = HashStringFNV(name) & (HASH_SIZE-1);
+    while (hashtab[idx])
+    {
+	if (!strcmp(name,hashtab[idx]->name))
+	    return hashtab[idx]->id;
+	idx = ( idx + 1 ) & (HASH_SIZE-1);
+    }
+    return TCMD_NONE;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+static bool FastScanTextCommand
+(
+    // Scan a text command of a simple line without saving the complete
+    // ScanFile_t, which is expensive because of the parameter stack.
+    // The result is the same as for the generic code of ScanTextCommand().
+    // Returns false without modifying anything, if the line is not simple
+    // (index expression, continuation line, end of text, long name).
+
+    ScanInfo_t		* si,		// valid data
+    TextCommand_t	* res		// store the result here
+)
+{
+    DASSERT(si);
+    DASSERT(res);
+    ScanFile_t *sf = si->cur_file;
+    DASSERT(sf);
+
+    ccp ptr = sf->ptr;
+    ccp end = sf->end;
+
+    //--- skip blanks and '@', see NextCharSI()
+
+    while ( ptr < end && (uchar)*ptr <= ' ' && *ptr != '\n' )
+	ptr++;
+    if ( ptr < end && *ptr == '@' )
+	ptr++;
+    while ( ptr < end && (uchar)*ptr <= ' ' && *ptr != '\n' )
+	ptr++;
+
+
+    //--- scan name, see ScanNameSI()
+
+    ccp name_beg = ptr;
+    char name[VARNAME_SIZE+1], *dest = name;
+    while ( ptr < end )
+    {
+	char ch = *ptr;
+	if ( ch >= 'a' && ch <= 'z' )
+	    ch += 'A' - 'a';
+	else if (!( ch >= 'A' && ch <= 'Z'
+		 || ch >= '0' && ch <= '9'
+		 || ch == '_' || ch == '.' || ch == '$' || ch == '-' ))
+	    break;
+
+	if ( dest == name + VARNAME_SIZE )
+	    return false;
+	*dest++ = ch;
+	ptr++;
+    }
+    if ( dest == name )
+	return false;
+    *dest = 0;
+
+
+    //--- find next char, see NextCharSI() and TestContLineSI()
+
+    while ( ptr < end && (uchar)*ptr <= ' ' && *ptr != '\n' )
+	ptr++;
+    if ( ptr < end && *ptr == '#' )
+	while ( ptr < end && *ptr != '\n' )
+	    ptr++;
+    if ( ptr == end || *ptr == '[' )
+	return false;
+
+    const char next_ch = *ptr;
+    ccp prev_ptr = name_beg;
+    if ( next_ch == '\n' )
+    {
+	ccp cont = ptr;
+	while ( cont < end )
+	{
+	    if ( *cont == '#' )
+	    {
+		while ( cont < end && *cont != '\n' )
+		    cont++;
+		continue;
+	    }
+	    if ( (uchar)*cont > ' ' )
+	    {
+		if ( *cont == '>' )
+		    return false;
+		break;
+	    }
+	    cont++;
+	}
+	prev_ptr = ptr;
+    }
+
+
+    //--- evaluate
+
+    TextCommand_t tcmd = GetTextCommand(name);
+    if (!tcmd)
+    {
+	if ( next_ch == ':' )
+	    tcmd = TCMD_CALL;
+	else if ( next_ch == '>' )
+	    tcmd = TCMD_EXEC;
+	else
+	{
+	    *res = TCMD_NONE;
+	    return true;
+	}
+	ptr++;
+    }
+
+    noPRINT("CMD FOUND @ line %u: %u %s |%.10s|\n", sf->line, tcmd, name, ptr );
+    sf->ptr = ptr;
+    sf->prev_ptr = prev_ptr;
+    *res = tcmd;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 TextCommand_t ScanTextCommand
 (
     ScanInfo_t		* si		// valid data
@@ -5705,6 +5941,10 @@ TextCommand_t ScanTextCommand
     DASSERT(si);
     if ( si->fast_scan <= 0 )
     {
+	TextCommand_t tcmd;
+	if (FastScanTextCommand(si,&tcmd))
+	    return tcmd;
+
 	ScanFile_t *sf = si->cur_file;
 	DASSERT(sf);
 	ScanFile_t saved_sf;
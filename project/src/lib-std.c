@@ -37,7 +37,9 @@
 
 #include <sys/types.h>
 #include <sys/ioctl.h>
+#include <sys/wait.h>
 #include <fcntl.h>
+#include <signal.h>
 
 #include "lib-std.h"
 #include "lib-szs.h"
@@ -58,6 +60,7 @@
 #include "lib-common.h"
 #include "lib-bzip2.h"
 #include "lib-lzma.h"
+#include "lib-checksum.h"
 #include "dclib-utf8.h"
 #include "dclib-ui.h"
 #include "lib-mkw.h"
@@ -105,6 +108,7 @@ OffOn_t		opt_wim0		= OFFON_AUTO;
 ccp		opt_source		= 0;
 StringField_t	source_list		= {0};
 ccp		opt_id_list		= 0;
+bool		opt_id_list_index	= false;
 ccp		opt_reference		= 0;
 ccp		opt_dest		= 0;
 bool		opt_mkdir		= false;
@@ -155,6 +159,7 @@ ccp		opt_cache		= 0;
 ccp		opt_cname		= 0;
 ccp		opt_log_cache		= 0;
 int		parallel_count		= 0;
+uint		opt_threads		= 0;
 bool		opt_round		= false;
 int		brief_count		= 0;
 int		long_count		= 0;
@@ -177,6 +182,8 @@ ccp		opt_title_screen	= 0;
 u32		opt_max_file_size	= 100*MiB;
 int		opt_compr_mode		= 0;
 u32		opt_compr		= 9;
+uint		opt_compr_threads	= 0;
+uint		opt_kcl_threads		= 0;
 bool		opt_norm		= false;
 int		need_norm		= 0;	// enabled if > 0
 bool		opt_no_copy		= false;
@@ -188,9 +195,14 @@ bool		opt_decode		= false;
 bool		opt_cut			= false;
 bool		opt_cmpr_valid		= false;
 u8		opt_cmpr_def[8]		= { 0x00,0x00, 0x00,0x20, 0xff,0xff,0xff,0xff };
+uint		opt_cmpr_threads	= 0;
+cmpr_fit_t	opt_cmpr_fit		= CMPR_FIT_RANGE;
+pal_quant_t	opt_pal_quant		= PAL_QUANT_MEDIAN_CUT;
+uint		opt_pal_threads		= 0;
 uint		opt_n_images		= 0;
 uint		opt_max_images		= 5;
 uint		opt_min_mipmap_size	= 8;	// minimal mipmap size
+mipmap_filter_t	opt_mipmap_filter	= MMF_SMART;
 int		opt_mipmaps		= 0;
 bool		opt_strip		= false;
 bool		opt_pre_convert		= false;
@@ -3114,6 +3126,7 @@ int ScanOptCompr ( ccp arg )
 	{  1,		"FAST",		0,		1 },
 	{  9,		"BEST",		0,		1 },
 	{ 10,		"ULTRA",	0,		1 },
+	{  0,		"OPTIMAL",	0,		12 },
 	{ COMPR_DEFAULT,"DEFAULT",	0,		1 },
 
 	{ COMPR_DEFAULT,"T2",		"TRY2",		2 },
@@ -3135,6 +3148,7 @@ int ScanOptCompr ( ccp arg )
 	    {   0,  10,    0,  1 },
 	    {  91,  93,    0,  9 },
 	    { 100, 150, -100, 11 },
+	    { 200, 200, -200, 12 },
 	    { -9,0,0,0}
 	};
 
@@ -7261,6 +7275,400 @@ valid_t IsValidLTA
     return VALID_OK;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			parallel jobs			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// The library uses many global variables (options, 'iobuf', caches).
+// So parallel jobs are executed by forked worker processes. The output
+// of each worker is buffered in temporary files and printed in the order
+// of the job list. New SZS cache entries are merged into the cache of the
+// parent, which saves the cache as usual at the end.
+
+// [[parallel_job_t]]
+
+typedef struct parallel_job_t
+{
+    int			pid;		// >0: process id of running worker
+    bool		done;		// true: job finished
+    enumError		err;		// exit status of the job
+    FILE		*out;		// NULL or temp file for stdout
+    FILE		*err_out;	// NULL or temp file for stderr
+    FILE		*cache;		// NULL or temp file for new cache entries
+    FILE		*result;	// NULL or temp file for the job result
+}
+parallel_job_t;
+
+FILE *parallel_job_result = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void copy_job_output ( FILE *dest, FILE *src )
+{
+    DASSERT(dest);
+    if (src)
+    {
+	rewind(src);
+	size_t size;
+	while ( ( size = fread(iobuf,1,sizeof(iobuf),src) ) > 0 )
+	    fwrite(iobuf,1,size,dest);
+	fflush(dest);
+	fclose(src);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void close_parallel_job ( parallel_job_t *job )
+{
+    DASSERT(job);
+
+    copy_job_output(stdout,job->out);
+    copy_job_output(stderr,job->err_out);
+    job->out = job->err_out = 0;
+
+    if (job->cache)
+    {
+	rewind(job->cache);
+	ImportSZSCache(job->cache);
+	fclose(job->cache);
+	job->cache = 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void drop_parallel_jobs
+(
+    // Wait for all running workers, discard their temporary files and
+    // don't start new jobs. Used if waitpid() fails or to drop results.
+
+    parallel_jobs_t	*pj,		// valid parallel jobs
+    bool		kill_workers,	// true: kill running workers first
+    enumError		err		// exit status for not finished jobs
+)
+{
+    DASSERT(pj);
+
+    for ( uint i = pj->next_done; i < pj->next_start; i++ )
+    {
+	parallel_job_t *job = pj->list + i;
+	if ( job->pid > 0 && !job->done )
+	{
+	    if (kill_workers)
+		kill(job->pid,SIGKILL);
+	    while ( waitpid(job->pid,0,0) < 0 && errno == EINTR )
+		;
+	    job->done = true;
+	    job->err  = err;
+	}
+	job->pid = 0;
+
+	FILE **list[] = { &job->out, &job->err_out, &job->cache, &job->result };
+	for ( uint f = 0; f < sizeof(list)/sizeof(*list); f++ )
+	    if (*list[f])
+	    {
+		fclose(*list[f]);
+		*list[f] = 0;
+	    }
+    }
+
+    pj->n_jobs	  = pj->next_start;
+    pj->n_running = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int wait_parallel_worker
+(
+    // Wait for a worker of 'pj' and return its pid, or -1 on error.
+    // Only the own workers are waited for, so that other children of the
+    // process are not reaped: first all running workers are polled, and
+    // if none has finished, the worker of 'job' is waited for.
+
+    parallel_jobs_t	*pj,		// valid parallel jobs
+    parallel_job_t	*job,		// running job, that must be waited for
+    int			*wait_stat	// store the status of waitpid() here
+)
+{
+    DASSERT(pj);
+    DASSERT(job);
+    DASSERT(wait_stat);
+
+    for ( uint i = pj->next_done; i < pj->next_start; i++ )
+    {
+	const parallel_job_t *wjob = pj->list + i;
+	if ( wjob->pid > 0 && !wjob->done )
+	{
+	    const int pid = waitpid(wjob->pid,wait_stat,WNOHANG);
+	    if (pid)
+		return pid;
+	}
+    }
+
+    return waitpid(job->pid,wait_stat,0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool start_parallel_job
+(
+    // returns true, if the worker was started
+
+    parallel_job_t	*job,		// job to start
+    ccp			arg,		// argument for 'func'
+    ParallelJobFunc	func,		// job function
+    void		*param,		// user defined parameter for 'func'
+    bool		with_result	// true: create a result file
+)
+{
+    DASSERT(job);
+    DASSERT(func);
+
+    job->out	 = tmpfile();
+    job->err_out = tmpfile();
+    job->cache	 = IsSZSCacheEnabled() ? tmpfile() : 0;
+    job->result	 = with_result ? tmpfile() : 0;
+    if ( !job->out || !job->err_out
+	|| IsSZSCacheEnabled() && !job->cache
+	|| with_result && !job->result )
+    {
+	ERROR1(ERR_CANT_CREATE,"Can't create temporary file for worker: %s\n",arg);
+	close_parallel_job(job);
+	return false;
+    }
+
+    // flush all output streams, so that the worker doesn't flush them again
+    fflush(0);
+
+    job->pid = fork();
+    if ( job->pid < 0 )
+    {
+	ERROR1(ERR_ERROR,"Can't fork worker: %s\n",arg);
+	close_parallel_job(job);
+	return false;
+    }
+
+    if (!job->pid)
+    {
+	//--- worker
+
+	dup2(fileno(job->out),STDOUT_FILENO);
+	dup2(fileno(job->err_out),STDERR_FILENO);
+	RecordSZSCache(true);
+	parallel_job_result = job->result;
+
+	const enumError err = func(arg,param);
+
+	if (job->cache)
+	    ExportSZSCache(job->cache);
+	fflush(0);
+	_exit(err);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetupParallelJobs
+(
+    parallel_jobs_t	*pj,		// data structure to setup
+    const StringField_t	*plist,		// list with job arguments
+    uint		n_workers,	// max number of parallel workers, <=1: sequential
+    ParallelJobFunc	func,		// job function
+    void		*param,		// user defined parameter for 'func'
+    bool		with_result	// true: create a result file for each job
+)
+{
+    DASSERT(pj);
+    DASSERT(plist);
+    DASSERT(func);
+
+    memset(pj,0,sizeof(*pj));
+    pj->plist		= plist;
+    pj->n_jobs		= plist->used;
+    pj->n_workers	= n_workers < plist->used ? n_workers : plist->used;
+    pj->func		= func;
+    pj->param		= param;
+    pj->with_result	= with_result;
+    pj->list		= CALLOC(plist->used+1,sizeof(*pj->list));
+
+    if ( pj->n_workers > 1 && IsSZSCacheEnabled() )
+	LoadSZSCache();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetParallelJobs ( parallel_jobs_t *pj )
+{
+    DASSERT(pj);
+
+    //--- don't start more jobs, but wait for running workers
+
+    pj->n_jobs = pj->next_start;
+    FILE *result;
+    while ( NextParallelJob(pj,0,&result) >= 0 )
+	if (result)
+	    fclose(result);
+
+    FREE(pj->list);
+    memset(pj,0,sizeof(*pj));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void DropParallelJobs ( parallel_jobs_t *pj )
+{
+    DASSERT(pj);
+
+    // Running workers are not killed, because they may write files.
+    drop_parallel_jobs(pj,false,ERR_FATAL);
+    pj->next_done = pj->n_jobs;
+    ResetParallelJobs(pj);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int NextParallelJob
+(
+    // Wait until the next job in order of the job list is finished and
+    // print its output. Returns the index of the job or -1 if all jobs
+    // are done.
+
+    parallel_jobs_t	*pj,		// valid parallel jobs
+    enumError		*err,		// not NULL: store exit status of the job
+    FILE		**result	// not NULL: store the rewound result file
+					// (or NULL), the caller must close it
+)
+{
+    DASSERT(pj);
+    if (result)
+	*result = 0;
+    if ( pj->next_done >= pj->n_jobs )
+	return -1;
+
+    parallel_job_t *job = pj->list + pj->next_done;
+    ccp arg = pj->plist->field[pj->next_done];
+
+    if ( pj->n_workers <= 1 )
+    {
+	//--- sequential: execute the job directly
+
+	pj->next_start = pj->next_done + 1;
+	job->result = pj->with_result ? tmpfile() : 0;
+	if ( pj->with_result && !job->result )
+	{
+	    ERROR1(ERR_CANT_CREATE,"Can't create temporary file for job: %s\n",arg);
+	    job->err = ERR_CANT_CREATE;
+	}
+	else
+	{
+	    parallel_job_result = job->result;
+	    job->err = pj->func(arg,pj->param);
+	    parallel_job_result = 0;
+	}
+	job->done = true;
+    }
+
+    while (!job->done)
+    {
+	//--- start new workers
+
+	while ( pj->n_running < pj->n_workers && pj->next_start < pj->n_jobs )
+	{
+	    parallel_job_t *sjob = pj->list + pj->next_start;
+	    ccp sarg = pj->plist->field[pj->next_start++];
+	    if (start_parallel_job(sjob,sarg,pj->func,pj->param,pj->with_result))
+		pj->n_running++;
+	    else
+	    {
+		sjob->done = true;
+		sjob->err  = ERR_ERROR;
+		if (pj->stop_on_error)
+		    pj->n_jobs = pj->next_start;
+	    }
+	}
+
+	if (job->done)
+	    break;
+
+
+	//--- wait for a worker
+
+	int wait_stat;
+	const int pid = wait_parallel_worker(pj,job,&wait_stat);
+	if ( pid < 0 )
+	{
+	    if ( errno == EINTR )
+		continue;
+	    ERROR1(ERR_ERROR,"waitpid() failed\n");
+	    drop_parallel_jobs(pj,true,ERR_FATAL);
+	    break;
+	}
+
+	for ( uint i = pj->next_done; i < pj->next_start; i++ )
+	{
+	    parallel_job_t *wjob = pj->list + i;
+	    if ( wjob->pid == pid && !wjob->done )
+	    {
+		wjob->done = true;
+		wjob->err  = WIFEXITED(wait_stat)
+				? WEXITSTATUS(wait_stat) : ERR_FATAL;
+		pj->n_running--;
+		if ( pj->stop_on_error && wjob->err > ERR_WARNING )
+		    pj->n_jobs = pj->next_start;
+		break;
+	    }
+	}
+    }
+
+
+    //--- print the output and return the result
+
+    close_parallel_job(job);
+    if (job->result)
+    {
+	rewind(job->result);
+	if (result)
+	    *result = job->result;
+	else
+	    fclose(job->result);
+	job->result = 0;
+    }
+
+    if (err)
+	*err = job->err;
+    return pj->next_done++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+enumError ExecParallelJobs
+(
+    // returns the max error of all jobs
+
+    const StringField_t	*plist,		// list with job arguments
+    uint		n_workers,	// max number of parallel workers, <=1: sequential
+    ParallelJobFunc	func,		// job function
+    void		*param		// user defined parameter for 'func'
+)
+{
+    DASSERT(plist);
+    DASSERT(func);
+
+    parallel_jobs_t pj;
+    SetupParallelJobs(&pj,plist,n_workers,func,param,false);
+
+    enumError err, max_err = ERR_OK;
+    while ( NextParallelJob(&pj,&err,0) >= 0 )
+	if ( max_err < err )
+	     max_err = err;
+
+    ResetParallelJobs(&pj);
+    return max_err;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			xsrc/x-lib			///////////////
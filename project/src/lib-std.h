@@ -121,6 +121,16 @@ void LogSHA1 ( ccp func, ccp file, uint line, cvp data, uint size, ccp info );
 #define M1(a) ( (typeof(a))~0 )
 #define IS_M1(a) ( (a) == (typeof(a))~0 )
 
+// SIMD_CLONES marks hot kernels written with GCC vector extensions or as
+// vectorizable loops. On x86_64 Linux GCC creates an AVX2 clone, that is
+// selected at runtime, and the default SSE2 version. Elsewhere it is empty.
+
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__) && !defined(__clang__)
+  #define SIMD_CLONES __attribute__ ((target_clones("avx2","default")))
+#else
+  #define SIMD_CLONES
+#endif
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			   Setup			///////////////
@@ -1289,6 +1299,38 @@ extern const KeywordTab_t cmdtab_palette_format[];
 palette_format_t ScanPaletteFormat ( ccp arg );
 ccp GetPaletteFormatName ( palette_format_t pform, ccp unknown_value );
 
+//-----------------------------------------------------------------------------
+// [[cmpr_fit_t]]
+
+typedef enum cmpr_fit_t
+{
+    CMPR_FIT_RANGE,	// default: best pair of the colors of a block
+    CMPR_FIT_CLUSTER,	// additionally try a least squares cluster fit
+
+} cmpr_fit_t;
+
+//-----------------------------------------------------------------------------
+// [[pal_quant_t]]
+
+typedef enum pal_quant_t
+{
+    PAL_QUANT_MEDIAN_CUT,	// default: MedianCut()
+    PAL_QUANT_KMEANS,		// KMeansPalette(), median cut + k-means
+
+} pal_quant_t;
+
+//-----------------------------------------------------------------------------
+// [[mipmap_filter_t]]
+
+typedef enum mipmap_filter_t
+{
+    MMF_SMART,		// default: resize each mipmap from the source image
+    MMF_BOX,		// resize each mipmap from the previous one by ResizeIMG()
+    MMF_BILINEAR,	// like MMF_BOX, but use a bilinear filter
+    MMF_LANCZOS,	// like MMF_BOX, but use a Lanczos-3 filter
+
+} mipmap_filter_t;
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			sort mode			///////////////
@@ -2779,6 +2821,77 @@ int FindArenaSlot ( ccp name, bool allow_tracks );
 const TrackInfo_t * FindTrackInfo ( ccp name, bool allow_arenas );
 const TrackInfo_t * FindArenaInfo ( ccp name, bool allow_tracks );
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			parallel jobs			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+typedef enumError (*ParallelJobFunc) ( ccp arg, void *param );
+
+// NULL or the result file of the current job, only valid inside a job
+// function started by NextParallelJob() with 'with_result' enabled.
+extern FILE *parallel_job_result;
+
+//-----------------------------------------------------------------------------
+// [[parallel_jobs_t]]
+
+typedef struct parallel_jobs_t
+{
+    const StringField_t	*plist;		// list with job arguments
+    uint		n_jobs;		// number of jobs to start
+    uint		n_workers;	// max number of parallel workers, <=1: sequential
+    ParallelJobFunc	func;		// job function
+    void		*param;		// user defined parameter for 'func'
+    bool		with_result;	// true: create a result file for each job
+    bool		stop_on_error;	// true: don't start new jobs after a job
+					//	 failed with a status >ERR_WARNING
+
+    struct parallel_job_t *list;	// list with 'n_jobs' elements
+    uint		next_start;	// index of next job to start
+    uint		next_done;	// index of next job to return
+    uint		n_running;	// number of running workers
+}
+parallel_jobs_t;
+
+//-----------------------------------------------------------------------------
+
+void SetupParallelJobs
+(
+    parallel_jobs_t	*pj,		// data structure to setup
+    const StringField_t	*plist,		// list with job arguments
+    uint		n_workers,	// max number of parallel workers, <=1: sequential
+    ParallelJobFunc	func,		// job function
+    void		*param,		// user defined parameter for 'func'
+    bool		with_result	// true: create a result file for each job
+);
+
+void ResetParallelJobs ( parallel_jobs_t *pj );
+
+// like ResetParallelJobs(), but discard the output of the remaining jobs
+void DropParallelJobs ( parallel_jobs_t *pj );
+
+int NextParallelJob
+(
+    // Wait until the next job in order of the job list is finished and
+    // print its output. Returns the index of the job or -1 if all jobs
+    // are done.
+
+    parallel_jobs_t	*pj,		// valid parallel jobs
+    enumError		*err,		// not NULL: store exit status of the job
+    FILE		**result	// not NULL: store the rewound result file
+					// (or NULL), the caller must close it
+);
+
+enumError ExecParallelJobs
+(
+    // returns the max error of all jobs
+
+    const StringField_t	*plist,		// list with job arguments
+    uint		n_workers,	// max number of parallel workers, <=1: sequential
+    ParallelJobFunc	func,		// job function
+    void		*param		// user defined parameter for 'func'
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			apple only			///////////////
@@ -2836,6 +2949,7 @@ extern OffOn_t		opt_wim0;
 extern ccp		opt_source;
 extern StringField_t	source_list;
 extern ccp		opt_id_list;
+extern bool		opt_id_list_index;
 extern ccp		opt_reference;
 extern ccp		opt_dest;
 extern bool		opt_mkdir;
@@ -2886,6 +3000,7 @@ extern ccp		opt_cache;
 extern ccp		opt_cname;
 extern ccp		opt_log_cache;
 extern int		parallel_count;
+extern uint		opt_threads;
 extern bool		opt_round;
 extern int		brief_count;
 extern int		long_count;
@@ -2908,6 +3023,8 @@ extern ccp		opt_title_screen;
 extern u32		opt_max_file_size;
 extern int		opt_compr_mode;
 extern u32		opt_compr;
+extern uint		opt_compr_threads;
+extern uint		opt_kcl_threads;
 extern bool		opt_norm;
 extern int		need_norm;		// enabled if > 0
 extern bool		opt_no_copy;
@@ -2919,9 +3036,14 @@ extern bool		opt_decode;
 extern bool		opt_cut;
 extern bool		opt_cmpr_valid;
 extern u8		opt_cmpr_def[8];
+extern uint		opt_cmpr_threads;
+extern cmpr_fit_t	opt_cmpr_fit;
+extern pal_quant_t	opt_pal_quant;
+extern uint		opt_pal_threads;
 extern uint		opt_n_images;
 extern uint		opt_max_images;
 extern uint		opt_min_mipmap_size;	// minimal mipmap size
+extern mipmap_filter_t	opt_mipmap_filter;
 extern int		opt_mipmaps;
 extern bool		opt_strip;
 extern bool		opt_pre_convert;
@@ -138,7 +138,7 @@ szs_have_t;
 typedef struct string_pool_t
 {
     //--- incomming data
-    ParamField_t	pf;		// collected strings
+    ParamHash_t		ph;		// collected strings
 
     //--- num-to-string reference; not used elements are NULL
     ccp			*n2s_list;	// reference list
@@ -147,7 +147,7 @@ typedef struct string_pool_t
     //--- created string pool
     u8			* data;		// NULL or string pool
     uint		size;		// size of 'data'
-    u32			* offset;	// offset for each string in 'sf'
+    u32			* offset;	// offset for each string in 'ph'
 
 } string_pool_t;
 
@@ -306,6 +306,8 @@ typedef struct szs_file_t
 
     bool		cdata_alloced;	// true: 'cdata' must be freed
     bool		data_alloced;	// true: 'data' must be freed
+    u8			* cdata_mapped;	// not NULL: 'cdata' is this mapped file
+    size_t		cdata_map_size;	// size of 'cdata_mapped'
 
     u32			min_data_off;	// minimum found data offset
     u32			max_data_off;	// maximum found data offset
@@ -39,6 +39,8 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <pthread.h>
 
 #include "lib-szs.h"
 #include "lib-kcl.h"
@@ -300,6 +302,8 @@ void ResetSZS ( szs_file_t * szs )
     {
 	if (szs->cdata_alloced)
 	    FREE(szs->cdata);
+	if (szs->cdata_mapped)
+	    munmap(szs->cdata_mapped,szs->cdata_map_size);
 	if (szs->data_alloced)
 	    FREE(szs->data);
 	if (szs->obj_name_alloced)
@@ -449,6 +453,84 @@ DataContainer_t * ContainerSZS ( szs_file_t * szs )
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Compressed files of at least this size are mapped into memory by LoadSZS()
+// and decompressed directly from the mapping, if the file is read only.
+// Limitation: If another process truncates the file while it is mapped,
+// accessing the lost pages raises SIGBUS. To keep this window small, the
+// size is verified by fstat() and the mapping is populated (Linux) at once.
+
+#define SZS_MMAP_MIN_SIZE 0x10000
+
+//-----------------------------------------------------------------------------
+
+static u8 * MapFileSZS ( File_t *F )
+{
+    // returns NULL or a private (copy on write) mapping of the whole file
+
+    DASSERT(F);
+    if ( F->is_stdio || !F->f || !S_ISREG(F->st.st_mode)
+	|| F->st.st_size < SZS_MMAP_MIN_SIZE )
+    {
+	return 0;
+    }
+
+    //--- use the current size of the file, not the size of opening
+
+    const int fd = fileno(F->f);
+    struct stat st;
+    if ( fstat(fd,&st) || st.st_size != F->st.st_size )
+	return 0;
+
+ #ifdef MAP_POPULATE
+    const int flags = MAP_PRIVATE | MAP_POPULATE;
+ #else
+    const int flags = MAP_PRIVATE;
+ #endif
+
+    void *data = mmap( 0, st.st_size, PROT_READ|PROT_WRITE, flags, fd, 0 );
+    if ( data == MAP_FAILED )
+	return 0;
+
+    //--- the file may be truncated meanwhile
+
+    if ( fstat(fd,&st) || st.st_size != F->st.st_size )
+    {
+	munmap(data,F->st.st_size);
+	return 0;
+    }
+
+    madvise(data,F->st.st_size,MADV_SEQUENTIAL);
+    return data;
+}
+
+//-----------------------------------------------------------------------------
+
+static void UnmapCompressedSZS ( szs_file_t *szs )
+{
+    // replace a mapping of 'cdata' by an alloced copy or remove it
+
+    DASSERT(szs);
+    DASSERT(szs->cdata_mapped);
+
+    u8 *map = szs->cdata_mapped;
+    if ( szs->cdata == map )
+    {
+	szs->cdata = MEMDUP(map,szs->csize);
+	szs->cdata_alloced = true;
+    }
+    if ( szs->data == map )
+    {
+	szs->data = MEMDUP(map,szs->size);
+	szs->data_alloced = true;
+    }
+
+    munmap(map,szs->cdata_map_size);
+    szs->cdata_mapped = 0;
+    szs->cdata_map_size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 enumError LoadSZS
 (
     szs_file_t		* szs,		// valid szs
@@ -502,16 +584,25 @@ enumError LoadSZS
     }
     else
     {
-	szs->cdata_alloced = true;
 	szs->csize = F.st.st_size;
-	szs->cdata = MALLOC(szs->csize);
-
-	const size_t rd_size = fread(szs->cdata,1,szs->csize,F.f);
-	if ( rd_size != szs->csize )
+	szs->cdata = szs->readonly && decompress ? MapFileSZS(&F) : 0;
+	if (szs->cdata)
 	{
-	    ERROR1(ERR_READ_FAILED,"Can't read file: %s\n",fname);
-	    ResetFile(&F,false);
-	    return ERR_READ_FAILED;
+	    szs->cdata_mapped	= szs->cdata;
+	    szs->cdata_map_size	= szs->csize;
+	}
+	else
+	{
+	    szs->cdata_alloced = true;
+	    szs->cdata = MALLOC(szs->csize);
+
+	    const size_t rd_size = fread(szs->cdata,1,szs->csize,F.f);
+	    if ( rd_size != szs->csize )
+	    {
+		ERROR1(ERR_READ_FAILED,"Can't read file: %s\n",fname);
+		ResetFile(&F,false);
+		return ERR_READ_FAILED;
+	    }
 	}
 	szs->fname = F.fname;
 	F.fname = 0;
@@ -540,7 +631,21 @@ enumError LoadSZS
 // [[version-suffix]]
     szs->ff_version = GetVersionFF(szs->fform_arch,szs->data,szs->size,0);
 
-    if (decompress)
+    if (szs->cdata_mapped)
+    {
+	// decompress directly from the mapping, then drop it
+	if (IsCompressedFF(szs->fform_file))
+	{
+	    err = DecompressSZS(szs,false,0);
+	    if (!err)
+		ClearCompressedSZS(szs);
+	}
+	if (szs->cdata_mapped)
+	    UnmapCompressedSZS(szs);
+	if (!err)
+	    err = DecodeWU8(szs);
+    }
+    else if (decompress)
     {
 	err = DecompressSZS(szs,true,0);
 	if (!err)
@@ -617,15 +722,30 @@ void LinkCacheData
     if ( opt_cache && cache_fname && src_fname && data && size )
     {
 	PRINT("LinkCacheData(%d,%u) %s -> %s\n",data!=0,size,src_fname,cache_fname);
-	unlink(cache_fname);
-	if (link(src_fname,cache_fname))
+
+	// Create a temporary file and rename it, so that other processes
+	// never see a missing or incomplete cache file. Temporary files
+	// start with a '.' and are ignored by ScanSZSCache().
+
+	char temp[PATH_MAX];
+	ccp slash = strrchr(cache_fname,'/');
+	const int dir_len = slash ? slash - cache_fname + 1 : 0;
+	snprintf(temp,sizeof(temp),"%.*s.%s.%u.tmp",
+		dir_len, cache_fname, cache_fname+dir_len, getpid() );
+
+	unlink(temp);
+	bool ok = !link(src_fname,temp);
+	if (!ok)
 	{
 	    File_t F;
-	    CreateFile(&F,true,cache_fname,FM_SILENT|FM_REMOVE);
+	    CreateFile(&F,true,temp,FM_SILENT|FM_REMOVE);
 	    if (F.f)
-		fwrite(data,1,size,F.f);
+		ok = fwrite(data,1,size,F.f) == size;
 	    ResetFile(&F,false);
 	}
+	if (ok)
+	    rename(temp,cache_fname);
+	unlink(temp); // rename() does nothing if both are links to the same file
     }
 }
 
@@ -694,8 +814,10 @@ size_t GetDecompressedSizeYAZ
 
 ///////////////////////////////////////////////////////////////////////////////
 
-enumError DecompressYAZ
+static enumError DumpDecompressYAZ
 (
+    // Slow version of DecompressYAZ() with hex-dump, same parameters
+
     // returns:
     //	    ERR_OK:           compression done
     //	    ERR_WARNING:      silent==true: dest buffer too small
@@ -715,8 +837,6 @@ enumError DecompressYAZ
     DASSERT(data);
     DASSERT(dest_buf);
     DASSERT(dest_buf_size);
-    TRACE("DecompressYAZ(vers=%d) src=%p+%zu, dest=%p+%zu\n",
-		yaz_version, data, data_size, dest_buf, dest_buf_size );
 
     const u8 * src	= data;
     const u8 * src_end	= src + data_size;
@@ -881,6 +1001,242 @@ enumError DecompressYAZ
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static inline void CopyBackRefYAZ
+(
+    // Copy a back reference. Nothing is written behind 'dest+n'.
+
+    u8			*dest,		// destination
+    uint		dist,		// distance to source, >0
+    uint		n		// number of bytes to copy, >=3
+)
+{
+    const u8 *src = dest - dist;
+
+    if ( dist >= 16 )
+    {
+	// source and destination of each 16 byte chunk don't overlap
+
+	if ( n >= 16 )
+	{
+	    uint i;
+	    for ( i = 0; i + 16 <= n; i += 16 )
+		memcpy(dest+i,src+i,16);
+	    if ( i < n )
+		memcpy(dest+n-16,src+n-16,16);
+	    return;
+	}
+	if ( n >= 8 )
+	{
+	    memcpy(dest,src,8);
+	    memcpy(dest+n-8,src+n-8,8);
+	    return;
+	}
+    }
+    else if ( dist >= 8 )
+    {
+	if ( n >= 8 )
+	{
+	    uint i;
+	    for ( i = 0; i + 8 <= n; i += 8 )
+		memcpy(dest+i,src+i,8);
+	    if ( i < n )
+		memcpy(dest+n-8,src+n-8,8);
+	    return;
+	}
+    }
+    else if ( dist == 1 )
+    {
+	memset(dest,*src,n);
+	return;
+    }
+    else if ( n >= 16 )
+    {
+	// replicate the pattern: copy the first 'step' bytes byte by byte,
+	// then use 8 byte chunks with a distance of 'step' (multiple of 'dist')
+
+	const uint step = ( 8 + dist - 1 ) / dist * dist;
+	uint i;
+	for ( i = 0; i < step; i++ )
+	    dest[i] = src[i];
+	for ( ; i + 8 <= n; i += 8 )
+	    memcpy(dest+i,dest+i-step,8);
+	for ( ; i < n; i++ )
+	    dest[i] = dest[i-dist];
+	return;
+    }
+
+    // don't use memcpy() or memmove() here because
+    // they don't work with self referencing chunks.
+    while ( n-- > 0 )
+	*dest++ = *src++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+enumError DecompressYAZ
+(
+    // returns:
+    //	    ERR_OK:           compression done
+    //	    ERR_WARNING:      silent==true: dest buffer too small
+    //	    ERR_INVALID_DATA: invalid source data
+
+    const void		* data,		// source data
+    size_t		data_size,	// size of 'data'
+    void		* dest_buf,	// destination buffer (decompressed data)
+    size_t		dest_buf_size,	// size of 'dest_buf'
+    size_t		*write_status,	// number of written bytes
+    ccp			fname,		// file name for error messages
+    int			yaz_version,	// yaz version for error messages (0|1)
+    bool		silent,		// true: don't print error messages
+    FILE		*hexdump	// not NULL: write decrompression hex-dump
+)
+{
+    DASSERT(data);
+    DASSERT(dest_buf);
+    DASSERT(dest_buf_size);
+    TRACE("DecompressYAZ(vers=%d) src=%p+%zu, dest=%p+%zu\n",
+		yaz_version, data, data_size, dest_buf, dest_buf_size );
+
+    if (hexdump)
+	return DumpDecompressYAZ( data, data_size, dest_buf, dest_buf_size,
+			write_status, fname, yaz_version, silent, hexdump );
+
+    const u8 * src	= data;
+    const u8 * src_end	= src + data_size;
+    u8 * dest		= dest_buf;
+    u8 * dest_end	= dest + dest_buf_size;
+    u8  code		= 0;
+    int code_len	= 0;
+
+
+    //--- fast loop: decode complete groups of 8 tokens as long as
+    //    neither source nor destination can overflow
+
+    // a group needs at most 1+8*3 source bytes and 8*0x111 dest bytes
+    const u8 * src_safe	= data_size > 25 ? src_end - 25 : src;
+    u8 * dest_safe	= dest_buf_size > 8*0x111 ? dest_end - 8*0x111 : dest;
+
+    while ( src < src_safe && dest < dest_safe )
+    {
+	code = *src++;
+	if ( code == 0xff )
+	{
+	    // 8 single bytes
+	    memcpy(dest,src,8);
+	    dest += 8;
+	    src  += 8;
+	    continue;
+	}
+
+	for ( code_len = 0; code_len < 8; code_len++, code <<= 1 )
+	{
+	    if ( code & 0x80 )
+	    {
+		// copy 1 byte direct
+		*dest++ = *src++;
+		continue;
+	    }
+
+	    const u8 b1 = *src++;
+	    const u8 b2 = *src++;
+	    const uint dist = ( ( b1 & 0x0f ) << 8 | b2 ) + 1;
+
+	    uint n = b1 >> 4;
+	    if (!n)
+		n = *src++ + 0x12;
+	    else
+		n += 2;
+	    DASSERT( n >= 3 && n <= 0x111 );
+
+	    if ( dist > dest - (u8*)dest_buf )
+		goto back_ref_error;
+
+	    CopyBackRefYAZ(dest,dist,n);
+	    dest += n;
+	}
+    }
+    code_len = 0;
+
+
+    //--- careful loop for the remaining data
+
+    while ( src < src_end && dest < dest_end )
+    {
+	if (!code_len--)
+	{
+	    code = *src++;
+	    code_len = 7;
+	}
+
+	if ( code & 0x80 )
+	{
+	    // copy 1 byte direct
+	    *dest++ = *src++;
+	}
+	else
+	{
+	    // rle part
+
+	    const u8 b1 = *src++;
+	    const u8 b2 = *src++;
+	    const uint dist = ( ( b1 & 0x0f ) << 8 | b2 ) + 1;
+
+	    uint n = b1 >> 4;
+	    if (!n)
+		n = *src++ + 0x12;
+	    else
+		n += 2;
+	    DASSERT( n >= 3 && n <= 0x111 );
+
+	    if ( dist > dest - (u8*)dest_buf )
+		goto back_ref_error;
+
+	    if ( dest + n > dest_end )
+	    {
+		// first copy as much as possible
+		const u8 *copy_src = dest - dist;
+		while ( dest < dest_end )
+		    *dest++ = *copy_src++;
+
+		if (write_status)
+		    *write_status = dest - (u8*)dest_buf;
+		return silent
+		    ? ERR_WARNING
+		    : ERROR0(ERR_INVALID_DATA,
+			"YAZ%u data corrupted:"
+			" Decompressed data larger than specified (%zu>%zu): %s\n",
+			yaz_version,
+			GetDecompressedSizeYAZ(data,data_size),
+			dest_buf_size,
+			fname ? fname : "?" );
+	    }
+
+	    CopyBackRefYAZ(dest,dist,n);
+	    dest += n;
+	}
+
+	code <<= 1;
+    }
+    ASSERT( src <= src_end );
+    ASSERT( dest <= dest_end );
+
+    if (write_status)
+	*write_status = dest - (u8*)dest_buf;
+    return ERR_OK;
+
+ back_ref_error:
+    if (write_status)
+	*write_status = dest - (u8*)dest_buf;
+    if (!silent)
+	ERROR0(ERR_INVALID_DATA,
+		"YAZ%u data corrupted:"
+		" Back reference points before beginning of data: %s\n",
+		yaz_version, fname ? fname : "?" );
+    return ERR_INVALID_DATA;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void ClearCompressedSZS ( szs_file_t * szs )
 {
     if (szs->cdata_alloced)
@@ -888,6 +1244,12 @@ void ClearCompressedSZS ( szs_file_t * szs )
 	szs->cdata_alloced = false;
 	FREE(szs->cdata);
     }
+    else if ( szs->cdata_mapped && szs->cdata == szs->cdata_mapped )
+    {
+	munmap(szs->cdata_mapped,szs->cdata_map_size);
+	szs->cdata_mapped = 0;
+	szs->cdata_map_size = 0;
+    }
     szs->cdata = 0;
     szs->csize = 0;
 }
@@ -1061,9 +1423,10 @@ yaz_res_t;
 typedef struct yaz_compr_t
 {
     uint	secure_size;
+    uint	hdr_size;	// reserved bytes at 'dest_buf' for the file header
 
     uint	dest_buf_size;
-    u8		* dest_buf;
+    u8		* dest_buf;	// alloced buffer, header + compressed data
     u8		* dest_ptr;
     u8		* dest_end;
 
@@ -1080,13 +1443,19 @@ yaz_compr_t;
 
 static void SetupDestYAZ ( yaz_compr_t *yaz, u32 secure_size )
 {
+    // Each call uses its own heap buffer, so that the compressors are
+    // reentrant. The compressed data is written in place behind 'hdr_size'
+    // header bytes and the buffer becomes the final 'cdata' of the file.
+    // The size is predicted by the worst case (1 code byte per 8 literals),
+    // so that GrowDestYAZ() is never needed for complete streams.
+
     DASSERT(yaz);
-    DASSERT(secure_size<sizeof(iobuf)/2);
+    DASSERT(!yaz->dest_buf);
 
     yaz->secure_size	= secure_size;
-    yaz->dest_buf_size	= sizeof(iobuf) - secure_size;
-    yaz->dest_buf	= (u8*)iobuf;
-    yaz->dest_ptr	= yaz->dest_buf;
+    yaz->dest_buf_size	= yaz->hdr_size + yaz->src_len + yaz->src_len/8 + 1;
+    yaz->dest_buf	= MALLOC(yaz->dest_buf_size + secure_size);
+    yaz->dest_ptr	= yaz->dest_buf + yaz->hdr_size;
     yaz->dest_end	= yaz->dest_buf + yaz->dest_buf_size;
 }
 
@@ -1103,18 +1472,228 @@ static void GrowDestYAZ ( yaz_compr_t *yaz )
 
     TRACE("GrowDestYAZ(), new size; 0x%x = %u\n",new_size,new_size);
 
-    if ( yaz->dest_buf == (u8*)iobuf )
-    {
-	yaz->dest_buf = MALLOC(new_size);
-	memcpy(yaz->dest_buf,iobuf,dest_pos);
-    }
-    else
-	yaz->dest_buf = REALLOC(yaz->dest_buf,new_size);
+    yaz->dest_buf = REALLOC(yaz->dest_buf,new_size);
 
     yaz->dest_ptr  = yaz->dest_buf + dest_pos;
     yaz->dest_end  = yaz->dest_buf + yaz->dest_buf_size;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			YAZ match finder		///////////////
+///////////////////////////////////////////////////////////////////////////////
+// The match finder links all source positions with the same 3-byte prefix
+// hash to a chain. A search only visits positions of the chain instead of
+// scanning the whole window by memchr(). The result is the same as of the
+// classic search: the longest match and for equal lengths the most distant
+// one. If 'nearest' is set, the nearest of the longest matches is used
+// instead, which allows to stop the search at the first match with maximal
+// length. Matches shorter than 3 bytes are never reported.
+
+#define YAZ_WINDOW_SIZE		0x1000	// max distance of back references
+#define YAZ_MAX_MATCH_LEN	0x111	// max length of back references
+#define YAZ_HASH_BITS		15
+#define YAZ_HASH_SIZE		(1<<YAZ_HASH_BITS)
+
+//-----------------------------------------------------------------------------
+// [[yaz_match_t]]
+
+typedef struct yaz_match_t
+{
+    const u8	*src;			// begin of source
+    const u8	*src_end;		// end of source
+    uint	range;			// max search distance, <= YAZ_WINDOW_SIZE
+    uint	next_pos;		// next position to insert into the chains
+    bool	nearest;		// true: prefer the nearest of the longest
+
+    int		head[YAZ_HASH_SIZE];	// last position for each hash, -1 if none
+    int		prev[YAZ_WINDOW_SIZE];	// previous position with same hash
+    u16		cand[YAZ_WINDOW_SIZE];	// temporary list of candidates
+}
+yaz_match_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline uint HashMatchYAZ ( const u8 *ptr )
+{
+    return ( ( ptr[0] << 16 | ptr[1] << 8 | ptr[2] ) * 0x9e3779b1u )
+		>> ( 32 - YAZ_HASH_BITS );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static yaz_match_t * CreateMatchYAZ
+(
+    const u8		*src,		// source data
+    uint		src_len,	// size of source
+    uint		range,		// max search distance
+    bool		nearest		// true: prefer the nearest of the longest
+)
+{
+    DASSERT(src||!src_len);
+
+    yaz_match_t *ym = MALLOC(sizeof(*ym));
+    ym->src		= src;
+    ym->src_end		= src + src_len;
+    ym->range		= range < YAZ_WINDOW_SIZE ? range : YAZ_WINDOW_SIZE;
+    ym->next_pos	= 0;
+    ym->nearest		= nearest;
+    memset(ym->head,0xff,sizeof(ym->head));
+    return ym;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint FindMatchYAZ
+(
+    // returns the length of the best match (>=3) or 0, if not found
+
+    yaz_match_t		*ym,		// valid match finder
+    const u8		*src,		// search for this position,
+					// never smaller than for the last call
+    const u8		**found		// not NULL: store begin of match
+)
+{
+    DASSERT(ym);
+    DASSERT( src >= ym->src && src <= ym->src_end );
+
+    const uint pos = src - ym->src;
+    DASSERT( pos >= ym->next_pos );
+    if ( src + 2 >= ym->src_end )
+	return 0;
+
+
+    //--- insert all positions before 'src'
+
+    uint ipos;
+    for ( ipos = ym->next_pos; ipos < pos; ipos++ )
+    {
+	const uint hash = HashMatchYAZ(ym->src+ipos);
+	ym->prev[ipos&(YAZ_WINDOW_SIZE-1)] = ym->head[hash];
+	ym->head[hash] = ipos;
+    }
+    ym->next_pos = pos;
+
+
+    const int min_pos = pos > ym->range ? pos - ym->range : 0;
+    const uint max_len = ym->src_end - src < YAZ_MAX_MATCH_LEN
+			? ym->src_end - src : YAZ_MAX_MATCH_LEN;
+    uint found_len = 2;
+    const u8 *found_ptr = 0;
+    int p = ym->head[HashMatchYAZ(src)];
+
+    if (ym->nearest)
+    {
+	//--- compare the candidates, nearest first
+
+	for ( ; p >= min_pos; p = ym->prev[p&(YAZ_WINDOW_SIZE-1)] )
+	{
+	    const u8 *search = ym->src + p;
+	    if ( search[found_len] != src[found_len] )
+		continue;
+
+	    uint len = 0;
+	    while ( len < max_len && search[len] == src[len] )
+		len++;
+
+	    if ( found_len < len )
+	    {
+		found_len = len;
+		found_ptr = search;
+		if ( found_len == max_len )
+		    break;
+	    }
+	}
+
+	if (!found_ptr)
+	    return 0;
+	if (found)
+	    *found = found_ptr;
+	return found_len;
+    }
+
+
+    //--- collect candidates, nearest first
+
+    uint n_cand = 0;
+    while ( p >= min_pos )
+    {
+	DASSERT( n_cand < YAZ_WINDOW_SIZE );
+	ym->cand[n_cand++] = pos - p;
+	p = ym->prev[p&(YAZ_WINDOW_SIZE-1)];
+    }
+
+
+    //--- compare the candidates, most distant first
+
+    while ( n_cand > 0 )
+    {
+	const u8 *search = src - ym->cand[--n_cand];
+	if ( search[found_len] != src[found_len] )
+	    continue;
+
+	uint len = 0;
+	while ( len < max_len && search[len] == src[len] )
+	    len++;
+
+	if ( found_len < len )
+	{
+	    found_len = len;
+	    found_ptr = search;
+	    if ( found_len == max_len )
+		break;
+	}
+    }
+
+    if (!found_ptr)
+	return 0;
+    if (found)
+	*found = found_ptr;
+    return found_len;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static yaz_res_t * CreateMatchTableYAZ
+(
+    // Returns an alloced table with the best match for each source byte.
+    // Elements with 'len<3' are no matches.
+
+    yaz_compr_t		*yaz,		// valid yaz-control record
+    bool		nearest		// true: prefer the nearest of the longest
+)
+{
+    DASSERT(yaz);
+
+    yaz_res_t *yaz_buf = CALLOC(sizeof(*yaz_buf),yaz->src_len);
+    yaz_res_t *yref = yaz_buf;
+
+    const u8 *src	= yaz->src;
+    const u8 *src_end	= yaz->src_end;
+    yaz_match_t *ym	= CreateMatchYAZ(src,yaz->src_len,YAZ_WINDOW_SIZE,nearest);
+
+    while ( src + 2 < src_end )
+    {
+	const u8 * found = src;
+	const uint found_len = FindMatchYAZ(ym,src,&found);
+	yref->ref = src - found - 1;
+	yref->len = found_len ? found_len : 1;
+	yref++;
+	src++;
+    }
+    FREE(ym);
+
+    while ( src < src_end )
+    {
+	yref->ref = 0;
+	yref->len = 1;
+	yref++;
+	src++;
+    }
+
+    return yaz_buf;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////		YAZ compression, Back Tracking		///////////////
@@ -1236,83 +1815,28 @@ static enumError BackTrackYAZ ( yaz_compr_t *yaz, uint max_depth )
     if ( max_depth > BACK_TRACK_MAX_DEPTH )
 	max_depth = BACK_TRACK_MAX_DEPTH;
 
-    if ( logging >= 1 )
-    {
-	fprintf(stdlog,">>YAZ back tracking: depth=%u, max-depth=%u\n",
-		max_depth, BACK_TRACK_MAX_DEPTH );
-	fflush(stdlog);
-    }
-
-    SetupDestYAZ(yaz,0x40);
-
-
-    //--- setup yaz_buf
-
-    const int range	= 0x1000;
-    const int max_len	=  0x111;
-
-    yaz_res_t *yaz_buf = CALLOC(sizeof(*yaz_buf),yaz->src_len);
-    yaz_res_t *yref = yaz_buf;
-
-    const u8 *src	= yaz->src;
-    const u8 *src_end	= yaz->src_end;
-
-    while ( src + 2 < src_end )
-    {
-	const u8 * search = src - range;
-	if ( search < yaz->src )
-	     search = yaz->src;
-
-	const u8 * cmp_end = src + max_len;
-	if ( cmp_end > src_end )
-	     cmp_end = src_end;
-
-	uint found_len = 1;
-	const u8 * found = src;
-	const u8 c1 = *src;
-
-	for ( ; search < src; search++ )
-	{
-	    search = memchr(search,c1,src-search);
-	    if (!search)
-		break;
-	    DASSERT( search < src );
-	    const u8 * cmp1 = search + 1;
-	    const u8 * cmp2 = src + 1;
-	    while ( cmp2 < cmp_end && *cmp1 == *cmp2 )
-		cmp1++, cmp2++;
-	    const int len = cmp2 - src;
-	    DASSERT( cmp1 - search == len );
-
-	    if ( len > 2 && found_len < len )
-	    {
-		found_len = len;
-		found = search;
-		if ( found_len == max_len )
-		    break;
-	    }
-	}
-	yref->ref = src - found - 1;
-	yref->len = found_len;
-	yref++;
-	src++;
-    }
-
-    while ( src < src_end )
+    if ( logging >= 1 )
     {
-	yref->ref = 0;
-	yref->len = 1;
-	yref++;
-	src++;
+	fprintf(stdlog,">>YAZ back tracking: depth=%u, max-depth=%u\n",
+		max_depth, BACK_TRACK_MAX_DEPTH );
+	fflush(stdlog);
     }
 
+    SetupDestYAZ(yaz,0x40);
+
+
+    //--- setup yaz_buf
+
+    yaz_res_t *yaz_buf = CreateMatchTableYAZ(yaz,false);
+
 
     //--- create yaz0 stream
 
     u8 * dest		= yaz->dest_ptr;
     u8 * dest_end	= yaz->dest_end;
-    src			= yaz->src;
-    yref		= yaz_buf;
+    const u8 *src	= yaz->src;
+    const u8 *src_end	= yaz->src_end;
+    yaz_res_t *yref	= yaz_buf;
     u8 mask		= 0;
     u8 *code_byte	= dest;
 
@@ -1393,6 +1917,379 @@ static enumError BackTrackYAZ ( yaz_compr_t *yaz, uint max_depth )
     return ERR_OK;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		YAZ compression, Optimal Parsing	///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Optimal parsing calculates the minimal number of bits from each position
+// to the end of the source, backwards from the end. Each position can be
+// coded as byte copy (9 bits) or as back reference of any length between 3
+// and the length of the best match (17 or 25 bits, flag bit included).
+// Then the cheapest path is emitted from the beginning.
+
+static enumError OptimalParseYAZ ( yaz_compr_t *yaz )
+{
+    DASSERT(yaz);
+
+    if ( logging >= 1 )
+    {
+	fprintf(stdlog,">>YAZ optimal parsing\n");
+	fflush(stdlog);
+    }
+
+    SetupDestYAZ(yaz,0x40);
+
+
+    //--- setup yaz_buf and calculate the costs
+
+    const uint src_len = yaz->src_len;
+    yaz_res_t *yaz_buf = CreateMatchTableYAZ(yaz,true);
+    u32 *cost = MALLOC( sizeof(*cost) * ( src_len + 1 ) );
+    cost[src_len] = 0;
+
+    int pos;
+    for ( pos = src_len - 1; pos >= 0; pos-- )
+    {
+	yaz_res_t *yref = yaz_buf + pos;
+	uint best_len  = 1;
+	u32  best_cost = cost[pos+1] + 9;
+
+	// lengths are limited by the end of source -> no additional check
+	const uint max_len = yref->len;
+	uint len;
+	for ( len = 3; len <= max_len; len++ )
+	{
+	    const u32 c = cost[pos+len] + ( len < 0x12 ? 17 : 25 );
+	    if ( c <= best_cost )
+	    {
+		best_cost = c;
+		best_len  = len;
+	    }
+	}
+
+	cost[pos] = best_cost;
+	yref->len = best_len;
+    }
+    FREE(cost);
+
+
+    //--- create yaz0 stream
+
+    u8 * dest		= yaz->dest_ptr;
+    u8 * dest_end	= yaz->dest_end;
+    const u8 *src	= yaz->src;
+    const u8 *src_end	= yaz->src_end;
+    yaz_res_t *yref	= yaz_buf;
+    u8 mask		= 0;
+    u8 *code_byte	= dest;
+
+    while ( src < src_end )
+    {
+	if ( dest > dest_end )
+	{
+	    const uint code_pos = code_byte - yaz->dest_buf;
+	    yaz->dest_ptr  = dest;
+
+	    GrowDestYAZ(yaz);
+
+	    dest	= yaz->dest_ptr;
+	    dest_end	= yaz->dest_end;
+	    code_byte	= yaz->dest_buf + code_pos;
+	}
+
+	if (!mask)
+	{
+	    code_byte = dest;
+	    *dest++ = 0;
+	    mask = 0x80;
+	}
+
+	if ( yref->len < 3 )
+	{
+	    *code_byte |= mask;
+	    *dest++ = *src++;
+	    yref++;
+	}
+	else
+	{
+	    DASSERT( yref->ref < 0x1000 );
+	    const uint len = yref->len;
+	    if ( len < 0x12 )
+	    {
+		*dest++ = yref->ref >> 8 | ( len - 2 ) << 4;
+		*dest++ = yref->ref;
+	    }
+	    else
+	    {
+		*dest++ = yref->ref >> 8;
+		*dest++ = yref->ref;
+		*dest++ = len - 0x12;
+	    }
+	    src  += len;
+	    yref += len;
+	}
+	mask >>= 1;
+    }
+
+    yaz->dest_ptr  = dest;
+    FREE(yaz_buf);
+    return ERR_OK;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		YAZ compression, parallel blocks	///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Large sources are split into blocks of fixed size. Each block is parsed
+// independently by the classic algorithm, but back references may still
+// point into the preceding 4 KiB of the previous block. Matches never cross
+// the end of a block. The blocks are parsed by worker threads into token
+// lists, which are finally stitched to a single YAZ0 stream. Because the
+// block size is fixed, the result does not depend on the number of threads.
+
+#define YAZ_BLOCK_SIZE		0x100000
+
+//-----------------------------------------------------------------------------
+// [[yaz_block_t]]
+
+typedef struct yaz_block_t
+{
+    const u8	*src;		// begin of block
+    const u8	*src_end;	// end of block
+    yaz_res_t	*tok;		// alloced list of tokens, 'len==1' for literals
+    uint	n_tok;		// number of used tokens
+}
+yaz_block_t;
+
+//-----------------------------------------------------------------------------
+// [[yaz_block_job_t]]
+
+typedef struct yaz_block_job_t
+{
+    const u8	*base;		// begin of complete source
+    yaz_block_t	*block;		// list of blocks
+    uint	n_block;	// number of blocks
+    uint	first;		// first block of this job
+    uint	step;		// step to next block of this job
+    uint	range;		// max search distance
+    bool	optimize;	// true: look one byte ahead for better matches
+}
+yaz_block_job_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void ParseBlockYAZ
+(
+    yaz_block_t		*blk,		// block to parse
+    const u8		*base,		// begin of complete source
+    uint		range,		// max search distance
+    bool		optimize	// true: look one byte ahead
+)
+{
+    DASSERT(blk);
+    DASSERT(base);
+
+    const u8 *src	= blk->src;
+    const u8 *src_end	= blk->src_end;
+    const u8 *win	= src - base > YAZ_WINDOW_SIZE ? src - YAZ_WINDOW_SIZE : base;
+
+    yaz_match_t *ym = CreateMatchYAZ(win,src_end-win,range,false);
+    yaz_res_t *tok = blk->tok = MALLOC( (src_end-src) * sizeof(*tok) );
+
+    uint saved_len = 0;
+    const u8 * saved = 0;
+
+    while ( src < src_end )
+    {
+	uint found_len = 1;
+	const u8 * found = 0;
+
+	if ( src + 2 < src_end )
+	{
+	    if (saved_len)
+	    {
+		found_len = saved_len;
+		saved_len = 0;
+		found = saved;
+	    }
+	    else
+	    {
+		const uint len = FindMatchYAZ(ym,src,&found);
+		if (len)
+		    found_len = len;
+	    }
+
+	    if ( optimize && found_len >= 3 )
+	    {
+		const uint found_len2 = FindMatchYAZ(ym,src+1,&saved);
+		if ( found_len2 > found_len )
+		{
+		    found_len = 1;
+		    saved_len = found_len2;
+		}
+	    }
+	}
+	else
+	    saved_len = 0;
+
+	if ( found_len >= 3 )
+	{
+	    tok->ref = src - found - 1;
+	    tok->len = found_len;
+	}
+	else
+	{
+	    tok->ref = 0;
+	    tok->len = found_len = 1;
+	}
+	tok++;
+	src += found_len;
+    }
+
+    blk->n_tok = tok - blk->tok;
+    FREE(ym);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void * ParseBlockJobYAZ ( void *param )
+{
+    yaz_block_job_t *job = param;
+    DASSERT(job);
+
+    for ( uint i = job->first; i < job->n_block; i += job->step )
+	ParseBlockYAZ(job->block+i,job->base,job->range,job->optimize);
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError BlockCompressYAZ
+(
+    yaz_compr_t		*yaz,		// valid yaz-control record
+    uint		range,		// max search distance
+    bool		optimize,	// true: look one byte ahead
+    uint		n_threads	// number of threads, >1
+)
+{
+    DASSERT(yaz);
+
+    //--- setup blocks
+
+    const uint n_block = ( yaz->src_len + YAZ_BLOCK_SIZE - 1 ) / YAZ_BLOCK_SIZE;
+    if ( n_threads > n_block )
+	n_threads = n_block;
+
+    if ( logging >= 1 )
+    {
+	fprintf(stdlog,">>YAZ block compression: %u blocks, %u threads\n",
+		n_block, n_threads );
+	fflush(stdlog);
+    }
+
+    yaz_block_t *block = CALLOC(n_block,sizeof(*block));
+    for ( uint i = 0; i < n_block; i++ )
+    {
+	block[i].src	 = yaz->src + i * YAZ_BLOCK_SIZE;
+	block[i].src_end = i < n_block-1 ? block[i].src + YAZ_BLOCK_SIZE : yaz->src_end;
+    }
+
+
+    //--- parse blocks by threads, job #0 is done by the current thread
+
+    yaz_block_job_t *job = CALLOC(n_threads,sizeof(*job));
+    pthread_t *tid = CALLOC(n_threads,sizeof(*tid));
+    bool *started = CALLOC(n_threads,sizeof(*started));
+
+    for ( uint t = 0; t < n_threads; t++ )
+    {
+	job[t].base	= yaz->src;
+	job[t].block	= block;
+	job[t].n_block	= n_block;
+	job[t].first	= t;
+	job[t].step	= n_threads;
+	job[t].range	= range;
+	job[t].optimize	= optimize;
+    }
+
+    for ( uint t = 1; t < n_threads; t++ )
+	started[t] = !pthread_create(tid+t,0,ParseBlockJobYAZ,job+t);
+    ParseBlockJobYAZ(job);
+
+    for ( uint t = 1; t < n_threads; t++ )
+    {
+	if (started[t])
+	    pthread_join(tid[t],0);
+	else
+	    ParseBlockJobYAZ(job+t);
+    }
+
+    FREE(started);
+    FREE(tid);
+    FREE(job);
+
+
+    //--- stitch the token lists to a single stream
+
+    SetupDestYAZ(yaz,0x40);
+    u8 * dest		= yaz->dest_ptr;
+    const u8 *src	= yaz->src;
+
+    u8 mask		= 0;
+    u8 *code_byte	= dest;
+
+    for ( uint i = 0; i < n_block; i++ )
+    {
+	const yaz_res_t *tok = block[i].tok;
+	const yaz_res_t *tok_end = tok + block[i].n_tok;
+
+	for ( ; tok < tok_end; tok++ )
+	{
+	    if ( dest > yaz->dest_end )
+	    {
+		const uint code_pos = code_byte - yaz->dest_buf;
+		yaz->dest_ptr  = dest;
+		GrowDestYAZ(yaz);
+		dest	   = yaz->dest_ptr;
+		code_byte  = yaz->dest_buf + code_pos;
+	    }
+
+	    if (!mask)
+	    {
+		code_byte = dest;
+		*dest++ = 0;
+		mask = 0x80;
+	    }
+
+	    if ( tok->len == 1 )
+	    {
+		*code_byte |= mask;
+		*dest++ = *src++;
+	    }
+	    else if ( tok->len < 0x12 )
+	    {
+		*dest++ = tok->ref >> 8 | ( tok->len - 2 ) << 4;
+		*dest++ = tok->ref;
+		src += tok->len;
+	    }
+	    else
+	    {
+		*dest++ = tok->ref >> 8;
+		*dest++ = tok->ref;
+		*dest++ = tok->len - 0x12;
+		src += tok->len;
+	    }
+	    mask >>= 1;
+	}
+	FREE(block[i].tok);
+    }
+    DASSERT( src == yaz->src_end );
+
+    yaz->dest_ptr = dest;
+    FREE(block);
+    return ERR_OK;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			ClassicCompressYAZ()		///////////////
@@ -1401,7 +2298,6 @@ static enumError BackTrackYAZ ( yaz_compr_t *yaz, uint max_depth )
 enumError ClassicCompressYAZ ( yaz_compr_t *yaz, int compr )
 {
     DASSERT(yaz);
-    SetupDestYAZ(yaz,0x40);
 
     //--- calc range
 
@@ -1427,9 +2323,8 @@ enumError ClassicCompressYAZ ( yaz_compr_t *yaz, int compr )
 	check_cache_t cc;
 	if (CheckSZSCache(&cc,yaz->szs,yaz->src,yaz->src_len,FF_YAZ0,".szs"))
 	{
-	    cc.cache.csize -= sizeof(yaz0_header_t);
-	    memmove(cc.cache.cdata,cc.cache.cdata+sizeof(yaz0_header_t),cc.cache.csize);
-
+	    // the cached data includes the header => use it in place
+	    DASSERT( yaz->hdr_size == sizeof(yaz0_header_t) );
 	    yaz->dest_buf_size	= cc.cache.csize;
 	    yaz->dest_buf	= cc.cache.cdata;
 	    yaz->dest_ptr	=
@@ -1445,9 +2340,17 @@ enumError ClassicCompressYAZ ( yaz_compr_t *yaz, int compr )
     }
 
 
-    //--- setup, use local vars for optimization
+    //--- large source => parallel blocks?
 
     const bool optimize = opt_compr >= 10;
+    if ( range && opt_compr_threads > 1 && yaz->src_len >= 2*YAZ_BLOCK_SIZE )
+	return BlockCompressYAZ(yaz,range,optimize,opt_compr_threads);
+
+
+    //--- setup, use local vars for optimization
+
+    SetupDestYAZ(yaz,0x40);
+    yaz_match_t *ym = range ? CreateMatchYAZ(yaz->src,yaz->src_len,range,false) : 0;
 
     u8 * dest		= yaz->dest_ptr;
     u8 * dest_end	= yaz->dest_end;
@@ -1484,11 +2387,10 @@ enumError ClassicCompressYAZ ( yaz_compr_t *yaz, int compr )
 	    mask = 0x80;
 	}
 
-	const int max_len = 0x111;
 	uint found_len = 1;
 	const u8 * found = 0;
 
-	if ( range && src + 2 < src_end )
+	if ( ym && src + 2 < src_end )
 	{
 	    if (saved_len)
 	    {
@@ -1498,80 +2400,14 @@ enumError ClassicCompressYAZ ( yaz_compr_t *yaz, int compr )
 	    }
 	    else
 	    {
-		const u8 * search = src - range;
-		if ( search < yaz->src )
-		     search = yaz->src;
-
-		const u8 * cmp_end = src + max_len;
-		if ( cmp_end > src_end )
-		     cmp_end = src_end;
-
-		const u8 c1 = *src;
-		for ( ; search < src; search++ )
-		{
-		    search = memchr(search,c1,src-search);
-		    if (!search)
-			break;
-		    DASSERT( search < src );
-		    const u8 * cmp1 = search + 1;
-		    const u8 * cmp2 = src + 1;
-		    while ( cmp2 < cmp_end && *cmp1 == *cmp2 )
-			cmp1++, cmp2++;
-		    const int len = cmp2 - src;
-		    DASSERT( cmp1 - search == len );
-		    noPRINT_IF ( search + len > src,
-					"FOUND l=%u,%u pos=%zu,%zu\n",
-					len, found_len, search-szs->data, src-szs->data );
-
-		    if ( found_len < len )
-		    {
-			found_len = len;
-			found = search;
-			if ( found_len == max_len )
-			    break;
-		    }
-		}
+		const uint len = FindMatchYAZ(ym,src,&found);
+		if (len)
+		    found_len = len;
 	    }
 
 	    if ( optimize && found_len >= 3 )
 	    {
-		uint found_len2 = 0;
-		//const u8 * found2 = 0;
-		const u8 * src2 = src + 1;
-
-		const u8 * search = src2 - range;
-		if ( search < yaz->src )
-		     search = yaz->src;
-
-		const u8 * cmp_end = src2 + max_len;
-		if ( cmp_end > src_end )
-		     cmp_end = src_end;
-
-		const u8 c1 = *src2;
-		for ( ; search < src2; search++ )
-		{
-		    search = memchr(search,c1,src2-search);
-		    if (!search)
-			break;
-		    DASSERT( search < src2 );
-		    const u8 * cmp1 = search + 1;
-		    const u8 * cmp2 = src2 + 1;
-		    while ( cmp2 < cmp_end && *cmp1 == *cmp2 )
-			cmp1++, cmp2++;
-		    const int len = cmp2 - src2;
-		    DASSERT( cmp1 - search == len );
-		    noPRINT_IF ( search + len > src2,
-					"FOUND l=%u,%u pos=%zu,%zu\n",
-					len, found_len2, search-szs->data, src2-szs->data );
-		    if ( found_len2 < len )
-		    {
-			found_len2 = len;
-			saved = search;
-			if ( found_len2 == max_len )
-			    break;
-		    }
-		}
-
+		const uint found_len2 = FindMatchYAZ(ym,src+1,&saved);
 		if ( found_len2 > found_len )
 		{
 		    found_len = 1;
@@ -1614,6 +2450,7 @@ enumError ClassicCompressYAZ ( yaz_compr_t *yaz, int compr )
     }
 
     yaz->dest_ptr  = dest;
+    FREE(ym);
     return ERR_OK;
 }
 
@@ -1715,6 +2552,7 @@ enumError CompressYAZ ( szs_file_t * szs, int compr, bool remove_uncompressed )
     yaz.src      = szs->data;
     yaz.src_end  = szs->data + szs->size;
     yaz.szs      = szs;
+    yaz.hdr_size = sizeof(yaz0_header_t);
 
 
     //--- compress data
@@ -1729,6 +2567,7 @@ enumError CompressYAZ ( szs_file_t * szs, int compr, bool remove_uncompressed )
 	switch(opt_compr_mode)
 	{
 	  case 11: err = BackTrackYAZ(&yaz,opt_compr); break; // back tracking
+	  case 12: err = OptimalParseYAZ(&yaz); break; // optimal parsing
 	  default: err = ClassicCompressYAZ(&yaz,0);
 	}
     }
@@ -1738,11 +2577,13 @@ enumError CompressYAZ ( szs_file_t * szs, int compr, bool remove_uncompressed )
 
     if ( err == ERR_OK )
     {
-	const uint used_len = yaz.dest_ptr - yaz.dest_buf;
-	szs->csize = sizeof(yaz0_header_t) + used_len;
-	szs->cdata = MALLOC(szs->csize);
-	memcpy( szs->cdata + sizeof(yaz0_header_t), yaz.dest_buf, used_len );
+	// the data is already behind the header => take over the buffer
+	szs->csize = yaz.dest_ptr - yaz.dest_buf;
+	szs->cdata = yaz.dest_buf;
+	if ( yaz.dest_buf_size + yaz.secure_size - szs->csize > szs->csize/8 )
+	    szs->cdata = REALLOC(szs->cdata,szs->csize);
 	szs->cdata_alloced = true;
+	yaz.dest_buf = 0;
 
 	yaz0_header_t * yaz0 = (yaz0_header_t*)szs->cdata;
 	memset(yaz0,0,sizeof(*yaz0));
@@ -1763,9 +2604,7 @@ enumError CompressYAZ ( szs_file_t * szs, int compr, bool remove_uncompressed )
 	}
     }
 
-    if ( yaz.dest_buf != (u8*)iobuf )
-	FREE(yaz.dest_buf);
-
+    FREE(yaz.dest_buf);
     return err;
 }
 
@@ -6006,7 +6845,7 @@ void InitializeStringPool ( string_pool_t * sp )
 {
     DASSERT(sp);
     memset(sp,0,sizeof(*sp));
-    InitializeParamField(&sp->pf);
+    InitializeParamHash(&sp->ph);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6014,7 +6853,7 @@ void InitializeStringPool ( string_pool_t * sp )
 void ResetStringPool ( string_pool_t * sp )
 {
     DASSERT(sp);
-    ResetParamField(&sp->pf);
+    ResetParamHash(&sp->ph);
     FREE(sp->n2s_list);
     FREE(sp->data);
     FREE(sp->offset);
@@ -6033,7 +6872,7 @@ u32 InsertStringPool
 	if (!sp->data)
 	{
 	    ParamFieldItem_t *pi
-		= FindInsertParamField(&sp->pf,string,move_string,sp->pf.used+1,0);
+		= FindInsertParamHash(&sp->ph,string,move_string,sp->ph.pf.used+1,0);
 	    if (pi)
 	    {
 		if (data)
@@ -6068,20 +6907,24 @@ void CalcStringPool
 
     //HEXDUMP16(0,0,sp->n2s_list,sizeof(*sp->n2s_list)*sp->n2s_size);
 
-    u32 * offset = CALLOC(sp->pf.used,sizeof(*offset));
+    // the strings are stored sorted
+    SortParamHash(&sp->ph);
+    const ParamField_t *pf = &sp->ph.pf;
+
+    u32 * offset = CALLOC(pf->used,sizeof(*offset));
     sp->offset = offset;
 
     // align string pool
     u32 off = ALIGN32(base_offset,4) - base_offset;
     uint size = off;
 
-    ParamFieldItem_t *ptr, *end = sp->pf.field + sp->pf.used;
-    for ( ptr = sp->pf.field; ptr < end; ptr++ )
+    const ParamFieldItem_t *ptr, *end = pf->field + pf->used;
+    for ( ptr = pf->field; ptr < end; ptr++ )
 	size += ALIGN32(strlen(ptr->key)+5,4);
     sp->size = size;
     sp->data = CALLOC(1,size);
 
-    for ( ptr = sp->pf.field; ptr < end; ptr++ )
+    for ( ptr = pf->field; ptr < end; ptr++ )
     {
 	*offset++ = base_offset + off + 4;
 	u8 * str_ptr = sp->data + off;
@@ -6090,7 +6933,7 @@ void CalcStringPool
 	memcpy(str_ptr+4,ptr->key,slen);
 	off += ALIGN32(slen+5,4);
     }
-    DASSERT( offset == sp->offset + sp->pf.used );
+    DASSERT( offset == sp->offset + pf->used );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6101,7 +6944,7 @@ u32 FindStringPool ( string_pool_t * sp, ccp string, u32 not_found_value )
     if (sp->data)
     {
 	DASSERT(sp->offset);
-	const int str_idx = FindParamFieldIndex(&sp->pf,string,-1);
+	const int str_idx = FindParamHashIndex(&sp->ph,string,-1);
 	noPRINT("STRING-IDX=%d %s\n",str_idx,string);
 	if ( str_idx >= 0 )
 	    return sp->offset[str_idx];
@@ -230,6 +230,36 @@ __attribute__ ((packed)) lta_node_t;
 static inline uint GetNodeListSizeLTA ( const lta_header_t *lta )
 	{ return lta->n_slots * sizeof(lta_node_t); }
 
+//-----------------------------------------------------------------------------
+// [[lta_file_info_t]]
+
+typedef struct lta_file_info_t
+{
+    bool	loaded;			// true: source file loaded
+    bool	cache_used;		// true: converted data found in SZS cache
+    bool	converted;		// true: source file converted
+    bool	have_lfl;		// true: 'lfl' is valid
+    uint	file_size;		// size of source file
+    uint	data_size;		// size of 'data'
+    uint	lfl_size;		// size of 'lfl'
+    file_format_t fform_file;		// file format of source file
+    file_format_t fform_arch;		// archive format of source file
+}
+lta_file_info_t;
+
+//-----------------------------------------------------------------------------
+// [[lta_file_t]]
+
+typedef struct lta_file_t
+{
+    lta_file_info_t info;		// info, header of a parallel job result
+    u8		*data;			// SZS data to store
+    u8		*lfl;			// LFL data to store
+    u8		*buf;			// NULL or alloced buffer for 'data' and 'lfl'
+    szs_file_t	szs;			// source SZS
+}
+lta_file_t;
+
 //-----------------------------------------------------------------------------
 // [[lta_manager_t]]
 
@@ -258,6 +288,11 @@ typedef struct lta_manager_t
     exmem_list_t stored_szs;		// list with already stored SZS files (lta_node_record_t)
     exmem_list_t stored_lfl;		// list with already stored LFL files (lta_node_par_t)
 
+    parallel_jobs_t *pjobs;		// NULL or jobs to load and convert files
+    u8		*slot_files;		// NULL or existing files by slot: 1=std, 2=_d
+    lta_file_t	pfile[2];		// results for std + _d file of current slot
+    int		pfile_slot[2];		// slot of 'pfile[]', -1 if invalid
+
     uint	std_count;		// counter of inserted std SZS files
     uint	d_count;		// counter of inserted _d SZS files
     uint	lfl_count;		// counter of inserted LFL files
@@ -80,6 +80,16 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" duplicates."
     },
 
+    {	OPT_THREADS, false, false, false, false, false, 0, "threads",
+	"N",
+	"Decode, transform, encode and write the images by N worker processes"
+	" in parallel. At most N images are in memory at the same time. The"
+	" log output of each image is collected and printed in the order of"
+	" the source files. Keywords OFF (=0, sequential processing) and AUTO"
+	" (=number of online CPUs) are also accepted. Values 0 and 1 disable"
+	" parallel processing. Commands COPY and LIST ignore this option."
+    },
+
     {	OPT_DEST, false, false, false, false, true, 'd', "dest",
 	"path",
 	"Define a destination path (directory/file). The destination - means:"
@@ -196,6 +206,16 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" short cut."
     },
 
+    {	OPT_MIPMAP_FILTER, false, false, false, false, false, 0, "mipmap-filter",
+	"mode",
+	"Select how mipmaps are created. SMART (default) resizes each mipmap"
+	" from the source image. The other modes create each mipmap from the"
+	" previous one, so that the work shrinks from level to level: BOX uses"
+	" the same resize algorithm as SMART, BILINEAR uses a bilinear filter"
+	" and LANCZOS uses a sharper Lanczos-3 filter. --mm-filter is a short"
+	" cut."
+    },
+
     {	OPT_CMPR_DEFAULT, false, false, false, false, false, 0, "cmpr-default",
 	"rgb1[,rgb2]",
 	"Define 2 colors for the case, that all 16 pixels of a CMPR block are"
@@ -270,7 +290,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	"Print in machine readable sections and parameter lines."
     },
 
-    {0,0,0,0,0,0,0,0,0,0}, // OPT__N_SPECIFIC == 28
+    {0,0,0,0,0,0,0,0,0,0}, // OPT__N_SPECIFIC == 30
 
     //----- global options -----
 
@@ -462,6 +482,40 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" for standard usage."
     },
 
+    {	OPT_CMPR_THREADS, false, false, false, false, false, 0, "cmpr-threads",
+	"N",
+	"Encode CMPR images by N threads in parallel. Each thread encodes rows"
+	" of 8x8 blocks, so the result is independent of N. Keywords OFF (=0)"
+	" and AUTO (=number of online CPUs) are also accepted. Values 0 and 1"
+	" disable this mode."
+    },
+
+    {	OPT_CMPR_FIT, false, false, false, false, false, 0, "cmpr-fit",
+	"mode",
+	"Select the method to find the 2 base colors of a CMPR block. RANGE"
+	" (default) selects the best pair of block colors. CLUSTER tries"
+	" additionally a least squares fit for all clusterings of the pixels"
+	" along the principal axis and uses it, if the result is better. This"
+	" is slower."
+    },
+
+    {	OPT_PAL_QUANT, false, false, false, false, false, 0, "pal-quant",
+	"mode",
+	"Select the algorithm to calculate the palette of CI4, CI8 and C14X2"
+	" images. MEDIAN-CUT (default) splits the color space by median cut"
+	" and assigns each pixel to its block. K-MEANS starts with a weighted"
+	" median cut of the color histogram, refines the palette by k-means"
+	" iterations and assigns each pixel to the nearest palette color. The"
+	" result is better, especially for large palettes."
+    },
+
+    {	OPT_PAL_THREADS, false, false, false, false, false, 0, "pal-threads",
+	"N",
+	"Use N threads in parallel for the nearest color search of --pal-quant"
+	" K-MEANS. Keywords OFF (=0) and AUTO (=number of online CPUs) are"
+	" also accepted. Values 0 and 1 disable threads."
+    },
+
     {	OPT_TRACKS, false, true, false, false, false, 'T', "tracks",
 	"tracks",
 	"Define a new track order. A comma separated list in the format [a=]b"
@@ -546,7 +600,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" helper option."
     },
 
-    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 65
+    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 71
 
 };
 
@@ -712,8 +766,17 @@ static const struct option OptionLong[] =
 	 { "nowildcards",	0, 0, GO_NO_WILDCARDS },
 	{ "in-order",		0, 0, GO_IN_ORDER },
 	 { "inorder",		0, 0, GO_IN_ORDER },
+	{ "threads",		1, 0, GO_THREADS },
 	{ "max-file-size",	1, 0, 'M' },
 	 { "maxfilesize",	1, 0, 'M' },
+	{ "cmpr-threads",	1, 0, GO_CMPR_THREADS },
+	 { "cmprthreads",	1, 0, GO_CMPR_THREADS },
+	{ "cmpr-fit",		1, 0, GO_CMPR_FIT },
+	 { "cmprfit",		1, 0, GO_CMPR_FIT },
+	{ "pal-quant",		1, 0, GO_PAL_QUANT },
+	 { "palquant",		1, 0, GO_PAL_QUANT },
+	{ "pal-threads",	1, 0, GO_PAL_THREADS },
+	 { "palthreads",	1, 0, GO_PAL_THREADS },
 	{ "tracks",		1, 0, 'T' },
 	{ "arenas",		1, 0, 'A' },
 	{ "utf-8",		0, 0, GO_UTF_8 },
@@ -765,6 +828,10 @@ static const struct option OptionLong[] =
 	 { "fastmipmaps",	0, 0, GO_FAST_MIPMAPS },
 	 { "fast-mm",		0, 0, GO_FAST_MIPMAPS },
 	 { "fastmm",		0, 0, GO_FAST_MIPMAPS },
+	{ "mipmap-filter",	1, 0, GO_MIPMAP_FILTER },
+	 { "mipmapfilter",	1, 0, GO_MIPMAP_FILTER },
+	 { "mm-filter",		1, 0, GO_MIPMAP_FILTER },
+	 { "mmfilter",		1, 0, GO_MIPMAP_FILTER },
 	{ "cmpr-default",	1, 0, GO_CMPR_DEFAULT },
 	{ "pre-convert",	0, 0, GO_PRE_CONVERT },
 	 { "preconvert",	0, 0, GO_PRE_CONVERT },
@@ -851,26 +918,32 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x08f   */	OPT_CHDIR,
 	/* 0x090   */	OPT_NO_WILDCARDS,
 	/* 0x091   */	OPT_IN_ORDER,
-	/* 0x092   */	OPT_UTF_8,
-	/* 0x093   */	OPT_NO_UTF_8,
-	/* 0x094   */	OPT_FORCE,
-	/* 0x095   */	OPT_REPAIR_MAGICS,
-	/* 0x096   */	OPT_OLD,
-	/* 0x097   */	OPT_STD,
-	/* 0x098   */	OPT_NEW,
-	/* 0x099   */	OPT_EXTRACT,
-	/* 0x09a   */	OPT_NUMBER,
-	/* 0x09b   */	OPT_MIPMAPS,
-	/* 0x09c   */	OPT_NO_MIPMAPS,
-	/* 0x09d   */	OPT_N_MIPMAPS,
-	/* 0x09e   */	OPT_MAX_MIPMAPS,
-	/* 0x09f   */	OPT_MIPMAP_SIZE,
-	/* 0x0a0   */	OPT_FAST_MIPMAPS,
-	/* 0x0a1   */	OPT_CMPR_DEFAULT,
-	/* 0x0a2   */	OPT_PRE_CONVERT,
-	/* 0x0a3   */	OPT_STRIP,
-	/* 0x0a4   */	OPT_SECTIONS,
-	/* 0x0a5   */	 0,0,0,0, 0,0,0,0, 0,0,0,
+	/* 0x092   */	OPT_THREADS,
+	/* 0x093   */	OPT_CMPR_THREADS,
+	/* 0x094   */	OPT_CMPR_FIT,
+	/* 0x095   */	OPT_PAL_QUANT,
+	/* 0x096   */	OPT_PAL_THREADS,
+	/* 0x097   */	OPT_UTF_8,
+	/* 0x098   */	OPT_NO_UTF_8,
+	/* 0x099   */	OPT_FORCE,
+	/* 0x09a   */	OPT_REPAIR_MAGICS,
+	/* 0x09b   */	OPT_OLD,
+	/* 0x09c   */	OPT_STD,
+	/* 0x09d   */	OPT_NEW,
+	/* 0x09e   */	OPT_EXTRACT,
+	/* 0x09f   */	OPT_NUMBER,
+	/* 0x0a0   */	OPT_MIPMAPS,
+	/* 0x0a1   */	OPT_NO_MIPMAPS,
+	/* 0x0a2   */	OPT_N_MIPMAPS,
+	/* 0x0a3   */	OPT_MAX_MIPMAPS,
+	/* 0x0a4   */	OPT_MIPMAP_SIZE,
+	/* 0x0a5   */	OPT_FAST_MIPMAPS,
+	/* 0x0a6   */	OPT_MIPMAP_FILTER,
+	/* 0x0a7   */	OPT_CMPR_DEFAULT,
+	/* 0x0a8   */	OPT_PRE_CONVERT,
+	/* 0x0a9   */	OPT_STRIP,
+	/* 0x0aa   */	OPT_SECTIONS,
+	/* 0x0ab   */	 0,0,0,0, 0,
 	/* 0x0b0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0c0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0d0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
@@ -881,7 +954,8 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x120   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x130   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x140   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
-	/* 0x150   */	 0,0,0,0, 
+	/* 0x150   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
+	/* 0x160   */	 0,0,0,0, 0,0,0,0, 
 };
 
 //
@@ -889,89 +963,89 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 ///////////////                opt_allowed_cmd_*                ///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static u8 option_allowed_cmd_VERSION[28] = // cmd #1
+static u8 option_allowed_cmd_VERSION[30] = // cmd #1
 {
-    0,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1
+    0,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1
 };
 
-static u8 option_allowed_cmd_HELP[28] = // cmd #2
+static u8 option_allowed_cmd_HELP[30] = // cmd #2
 {
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1
 };
 
-static u8 option_allowed_cmd_CONFIG[28] = // cmd #3
+static u8 option_allowed_cmd_CONFIG[30] = // cmd #3
 {
-    0,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_ARGTEST[28] = // cmd #4
+static u8 option_allowed_cmd_ARGTEST[30] = // cmd #4
 {
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1
 };
 
-static u8 option_allowed_cmd_EXPAND[28] = // cmd #5
+static u8 option_allowed_cmd_EXPAND[30] = // cmd #5
 {
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1
 };
 
-static u8 option_allowed_cmd_TEST[28] = // cmd #6
+static u8 option_allowed_cmd_TEST[30] = // cmd #6
 {
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1
 };
 
-static u8 option_allowed_cmd_COLORS[28] = // cmd #7
+static u8 option_allowed_cmd_COLORS[30] = // cmd #7
 {
-    0,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_ERROR[28] = // cmd #8
+static u8 option_allowed_cmd_ERROR[30] = // cmd #8
 {
-    0,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1
+    0,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1
 };
 
-static u8 option_allowed_cmd_FILETYPE[28] = // cmd #9
+static u8 option_allowed_cmd_FILETYPE[30] = // cmd #9
 {
-    0,1,0,0,1, 1,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,1,0,0,1, 1,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_FILEATTRIB[28] = // cmd #10
+static u8 option_allowed_cmd_FILEATTRIB[30] = // cmd #10
 {
-    0,0,1,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,0,1,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_LIST[28] = // cmd #11
+static u8 option_allowed_cmd_LIST[30] = // cmd #11
 {
-    0,1,1,0,1, 1,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,1,1,0,1, 1,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_LIST_L[28] = // cmd #12
+static u8 option_allowed_cmd_LIST_L[30] = // cmd #12
 {
-    0,1,1,0,1, 1,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,1,1,0,1, 1,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_LIST_LL[28] = // cmd #13
+static u8 option_allowed_cmd_LIST_LL[30] = // cmd #13
 {
-    0,1,1,0,1, 1,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0
+    0,1,1,0,1, 1,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0
 };
 
-static u8 option_allowed_cmd_DECODE[28] = // cmd #14
+static u8 option_allowed_cmd_DECODE[30] = // cmd #14
 {
-    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 0,1,1,1,1,  1,1,1,1,1, 1,1,0
+    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,0,1,1,1,  1,1,1,1,1, 1,1,1,1,0
 };
 
-static u8 option_allowed_cmd_ENCODE[28] = // cmd #15
+static u8 option_allowed_cmd_ENCODE[30] = // cmd #15
 {
-    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,0
+    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,0
 };
 
-static u8 option_allowed_cmd_CONVERT[28] = // cmd #16
+static u8 option_allowed_cmd_CONVERT[30] = // cmd #16
 {
-    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,0
+    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,0
 };
 
-static u8 option_allowed_cmd_COPY[28] = // cmd #17
+static u8 option_allowed_cmd_COPY[30] = // cmd #17
 {
-    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,0
+    0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,0
 };
 
 
@@ -1007,6 +1081,10 @@ static const InfoOption_t * option_tab_tool[] =
 	OptionInfo + OPT_CHDIR,
 	OptionInfo + OPT_CONST,
 	OptionInfo + OPT_MAX_FILE_SIZE,
+	OptionInfo + OPT_CMPR_THREADS,
+	OptionInfo + OPT_CMPR_FIT,
+	OptionInfo + OPT_PAL_QUANT,
+	OptionInfo + OPT_PAL_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -1145,6 +1223,7 @@ static const InfoOption_t * option_tab_cmd_DECODE[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -1173,6 +1252,7 @@ static const InfoOption_t * option_tab_cmd_DECODE[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_TRANSFORM,
 	OptionInfo + OPT_STRIP,
@@ -1185,6 +1265,7 @@ static const InfoOption_t * option_tab_cmd_ENCODE[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -1214,6 +1295,7 @@ static const InfoOption_t * option_tab_cmd_ENCODE[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_TRANSFORM,
 	OptionInfo + OPT_STRIP,
@@ -1226,6 +1308,7 @@ static const InfoOption_t * option_tab_cmd_CONVERT[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -1255,6 +1338,7 @@ static const InfoOption_t * option_tab_cmd_CONVERT[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_TRANSFORM,
 	OptionInfo + OPT_STRIP,
@@ -1267,6 +1351,7 @@ static const InfoOption_t * option_tab_cmd_COPY[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -1296,6 +1381,7 @@ static const InfoOption_t * option_tab_cmd_COPY[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_TRANSFORM,
 	OptionInfo + OPT_STRIP,
@@ -1321,7 +1407,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"Wiimms Image Tool : Extract and convert graphic images. The file"
 	" formats TPL, TEX, BTI, BREFT and PNG are supported.",
 	0,
-	28,
+	32,
 	option_tab_tool,
 	0
     },
@@ -1556,7 +1642,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" starts with colon (:), then it may be a generic image instead of a"
 	" real file. See https://szs.wiimm.de/doc/genericimg for details.",
 	0,
-	22,
+	24,
 	option_tab_cmd_DECODE,
 	option_allowed_cmd_DECODE
     },
@@ -1575,7 +1661,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" SOURCE starts with colon (:), then it may be a generic image instead"
 	" of a real file. See https://szs.wiimm.de/doc/genericimg for details.",
 	0,
-	23,
+	25,
 	option_tab_cmd_ENCODE,
 	option_allowed_cmd_ENCODE
     },
@@ -1595,7 +1681,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" may be a generic image instead of a real file. See"
 	" https://szs.wiimm.de/doc/genericimg for details.",
 	0,
-	23,
+	25,
 	option_tab_cmd_CONVERT,
 	option_allowed_cmd_CONVERT
     },
@@ -1620,7 +1706,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" instead of a real file. See https://szs.wiimm.de/doc/genericimg for"
 	" details.",
 	0,
-	23,
+	25,
 	option_tab_cmd_COPY,
 	option_allowed_cmd_COPY
     },
@@ -61,6 +61,7 @@ typedef enum enumOptions
 	OPT_BRIEF,
 	OPT_NO_WILDCARDS,
 	OPT_IN_ORDER,
+	OPT_THREADS,
 	OPT_DEST,
 	OPT_DEST2,
 	OPT_ESC,
@@ -77,6 +78,7 @@ typedef enum enumOptions
 	OPT_MAX_MIPMAPS,
 	OPT_MIPMAP_SIZE,
 	OPT_FAST_MIPMAPS,
+	OPT_MIPMAP_FILTER,
 	OPT_CMPR_DEFAULT,
 	OPT_PRE_CONVERT,
 	OPT_PATCH,
@@ -84,7 +86,7 @@ typedef enum enumOptions
 	OPT_STRIP,
 	OPT_SECTIONS,
 
-	OPT__N_SPECIFIC, // == 28
+	OPT__N_SPECIFIC, // == 30
 
 	//----- global options -----
 
@@ -114,6 +116,10 @@ typedef enum enumOptions
 	OPT_CHDIR,
 	OPT_CONST,
 	OPT_MAX_FILE_SIZE,
+	OPT_CMPR_THREADS,
+	OPT_CMPR_FIT,
+	OPT_PAL_QUANT,
+	OPT_PAL_THREADS,
 	OPT_TRACKS,
 	OPT_ARENAS,
 	OPT_UTF_8,
@@ -126,7 +132,7 @@ typedef enum enumOptions
 	OPT_NEW,
 	OPT_EXTRACT,
 
-	OPT__N_TOTAL // == 65
+	OPT__N_TOTAL // == 71
 
 } enumOptions;
 
@@ -146,6 +152,7 @@ typedef enum enumOptions
 //	OB_BRIEF		= 1llu << OPT_BRIEF,
 //	OB_NO_WILDCARDS		= 1llu << OPT_NO_WILDCARDS,
 //	OB_IN_ORDER		= 1llu << OPT_IN_ORDER,
+//	OB_THREADS		= 1llu << OPT_THREADS,
 //	OB_DEST			= 1llu << OPT_DEST,
 //	OB_DEST2		= 1llu << OPT_DEST2,
 //	OB_ESC			= 1llu << OPT_ESC,
@@ -162,6 +169,7 @@ typedef enum enumOptions
 //	OB_MAX_MIPMAPS		= 1llu << OPT_MAX_MIPMAPS,
 //	OB_MIPMAP_SIZE		= 1llu << OPT_MIPMAP_SIZE,
 //	OB_FAST_MIPMAPS		= 1llu << OPT_FAST_MIPMAPS,
+//	OB_MIPMAP_FILTER	= 1llu << OPT_MIPMAP_FILTER,
 //	OB_CMPR_DEFAULT		= 1llu << OPT_CMPR_DEFAULT,
 //	OB_PRE_CONVERT		= 1llu << OPT_PRE_CONVERT,
 //	OB_PATCH		= 1llu << OPT_PATCH,
@@ -188,6 +196,7 @@ typedef enum enumOptions
 //				| OB_MIPMAPS
 //				| OB_NO_MIPMAPS
 //				| OB_FAST_MIPMAPS
+//				| OB_MIPMAP_FILTER
 //				| OB_CMPR_DEFAULT
 //				| OB_TRANSFORM
 //				| OB_STRIP,
@@ -235,12 +244,14 @@ typedef enum enumOptions
 //	OB_CMD_DECODE		= OB_NO_WILDCARDS
 //				| OB_IN_ORDER
 //				| OB_IGNORE
+//				| OB_THREADS
 //				| OB_GRP_DEST
 //				| OB_GRP_TRANSFORM,
 //
 //	OB_CMD_ENCODE		= OB_NO_WILDCARDS
 //				| OB_IN_ORDER
 //				| OB_IGNORE
+//				| OB_THREADS
 //				| OB_GRP_DEST
 //				| OB_ALL
 //				| OB_GRP_TRANSFORM,
@@ -341,6 +352,11 @@ typedef enum enumGetOpt
 	GO_CHDIR,
 	GO_NO_WILDCARDS,
 	GO_IN_ORDER,
+	GO_THREADS,
+	GO_CMPR_THREADS,
+	GO_CMPR_FIT,
+	GO_PAL_QUANT,
+	GO_PAL_THREADS,
 	GO_UTF_8,
 	GO_NO_UTF_8,
 	GO_FORCE,
@@ -356,6 +372,7 @@ typedef enum enumGetOpt
 	GO_MAX_MIPMAPS,
 	GO_MIPMAP_SIZE,
 	GO_FAST_MIPMAPS,
+	GO_MIPMAP_FILTER,
 	GO_CMPR_DEFAULT,
 	GO_PRE_CONVERT,
 	GO_STRIP,
@@ -374,7 +391,7 @@ typedef enum enumGetOpt
 //extern const struct option OptionLong[];
 //extern u8 OptionUsed[OPT__N_TOTAL+1];
 //extern const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE];
-//UIOPT_INDEX_SIZE := 0x154 = 340
+//UIOPT_INDEX_SIZE := 0x168 = 360
 //extern const InfoCommand_t CommandInfo[CMD__N+1];
 extern const InfoUI_t InfoUI_wimgt;
 
@@ -604,6 +604,14 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" https://szs.wiimm.de/opt/kcl for details."
     },
 
+    {	OPT_KCL_THREADS, false, false, false, false, false, 0, "kcl-threads",
+	"N",
+	"Create the octree of KCL files and draw KCL images (option --png) by"
+	" N threads in parallel. The result is independent of N. Keywords OFF"
+	" (=0) and AUTO (=number of online CPUs) are also accepted. Values 0"
+	" and 1 disable this mode."
+    },
+
     {	OPT_TRI_AREA, false, false, false, false, false, 0, "tri-area",
 	"EXPR",
 	"Define the minimal area size of KCL triangles. The intention is to"
@@ -731,7 +739,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" helper option."
     },
 
-    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 85
+    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 86
 
 };
 
@@ -1059,6 +1067,8 @@ static const struct option OptionLong[] =
 	{ "tform-script",	1, 0, GO_TFORM_SCRIPT },
 	 { "tformscript",	1, 0, GO_TFORM_SCRIPT },
 	{ "kcl",		1, 0, GO_KCL },
+	{ "kcl-threads",	1, 0, GO_KCL_THREADS },
+	 { "kclthreads",	1, 0, GO_KCL_THREADS },
 	{ "kcl-flag",		1, 0, GO_KCL_FLAG },
 	 { "kclflag",		1, 0, GO_KCL_FLAG },
 	{ "kcl-script",		1, 0, GO_KCL_SCRIPT },
@@ -1218,33 +1228,34 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x09d   */	OPT_AROT,
 	/* 0x09e   */	OPT_TFORM_SCRIPT,
 	/* 0x09f   */	OPT_KCL,
-	/* 0x0a0   */	OPT_KCL_FLAG,
-	/* 0x0a1   */	OPT_KCL_SCRIPT,
-	/* 0x0a2   */	OPT_TRI_AREA,
-	/* 0x0a3   */	OPT_TRI_HEIGHT,
-	/* 0x0a4   */	OPT_FLAG_FILE,
-	/* 0x0a5   */	OPT_XTRIDATA,
-	/* 0x0a6   */	OPT_SLOT,
-	/* 0x0a7   */	OPT_ID,
-	/* 0x0a8   */	OPT_BASE64,
-	/* 0x0a9   */	OPT_DB64,
-	/* 0x0aa   */	OPT_CODING,
-	/* 0x0ab   */	OPT_ROUND,
-	/* 0x0ac   */	OPT_NO_WILDCARDS,
-	/* 0x0ad   */	OPT_IN_ORDER,
-	/* 0x0ae   */	OPT_NO_ECHO,
-	/* 0x0af   */	OPT_UTF_8,
-	/* 0x0b0   */	OPT_NO_UTF_8,
-	/* 0x0b1   */	OPT_FORCE,
-	/* 0x0b2   */	OPT_REPAIR_MAGICS,
-	/* 0x0b3   */	OPT_TINY,
-	/* 0x0b4   */	OPT_OLD,
-	/* 0x0b5   */	OPT_STD,
-	/* 0x0b6   */	OPT_NEW,
-	/* 0x0b7   */	OPT_EXTRACT,
-	/* 0x0b8   */	OPT_NUMBER,
-	/* 0x0b9   */	OPT_SECTIONS,
-	/* 0x0ba   */	 0,0,0,0, 0,0,
+	/* 0x0a0   */	OPT_KCL_THREADS,
+	/* 0x0a1   */	OPT_KCL_FLAG,
+	/* 0x0a2   */	OPT_KCL_SCRIPT,
+	/* 0x0a3   */	OPT_TRI_AREA,
+	/* 0x0a4   */	OPT_TRI_HEIGHT,
+	/* 0x0a5   */	OPT_FLAG_FILE,
+	/* 0x0a6   */	OPT_XTRIDATA,
+	/* 0x0a7   */	OPT_SLOT,
+	/* 0x0a8   */	OPT_ID,
+	/* 0x0a9   */	OPT_BASE64,
+	/* 0x0aa   */	OPT_DB64,
+	/* 0x0ab   */	OPT_CODING,
+	/* 0x0ac   */	OPT_ROUND,
+	/* 0x0ad   */	OPT_NO_WILDCARDS,
+	/* 0x0ae   */	OPT_IN_ORDER,
+	/* 0x0af   */	OPT_NO_ECHO,
+	/* 0x0b0   */	OPT_UTF_8,
+	/* 0x0b1   */	OPT_NO_UTF_8,
+	/* 0x0b2   */	OPT_FORCE,
+	/* 0x0b3   */	OPT_REPAIR_MAGICS,
+	/* 0x0b4   */	OPT_TINY,
+	/* 0x0b5   */	OPT_OLD,
+	/* 0x0b6   */	OPT_STD,
+	/* 0x0b7   */	OPT_NEW,
+	/* 0x0b8   */	OPT_EXTRACT,
+	/* 0x0b9   */	OPT_NUMBER,
+	/* 0x0ba   */	OPT_SECTIONS,
+	/* 0x0bb   */	 0,0,0,0, 0,
 	/* 0x0c0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0d0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0e0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
@@ -1254,7 +1265,8 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x120   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x130   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x140   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
-	/* 0x150   */	 0,0,0,0, 
+	/* 0x150   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
+	/* 0x160   */	 0,0,0,0, 0,0,0,0, 
 };
 
 //
@@ -1493,6 +1505,7 @@ static const InfoOption_t * option_tab_tool[] =
 	OptionInfo + OPT_CHDIR,
 	OptionInfo + OPT_CONST,
 	OptionInfo + OPT_KCL,
+	OptionInfo + OPT_KCL_THREADS,
 	OptionInfo + OPT_TRI_AREA,
 	OptionInfo + OPT_TRI_HEIGHT,
 	OptionInfo + OPT_MAX_FILE_SIZE,
@@ -2292,7 +2305,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"Wiimms KCL Tool : Analyze, modify, export and create KCL and OBJ"
 	" files.",
 	0,
-	32,
+	33,
 	option_tab_tool,
 	0
     },
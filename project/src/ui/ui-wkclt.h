@@ -129,6 +129,7 @@ typedef enum enumOptions
 	OPT_CHDIR,
 	OPT_CONST,
 	OPT_KCL,
+	OPT_KCL_THREADS,
 	OPT_TRI_AREA,
 	OPT_TRI_HEIGHT,
 	OPT_XTRIDATA,
@@ -146,7 +147,7 @@ typedef enum enumOptions
 	OPT_NEW,
 	OPT_EXTRACT,
 
-	OPT__N_TOTAL // == 85
+	OPT__N_TOTAL // == 86
 
 } enumOptions;
 
@@ -508,6 +509,7 @@ typedef enum enumGetOpt
 	GO_AROT,
 	GO_TFORM_SCRIPT,
 	GO_KCL,
+	GO_KCL_THREADS,
 	GO_KCL_FLAG,
 	GO_KCL_SCRIPT,
 	GO_TRI_AREA,
@@ -548,7 +550,7 @@ typedef enum enumGetOpt
 //extern const struct option OptionLong[];
 //extern u8 OptionUsed[OPT__N_TOTAL+1];
 //extern const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE];
-//UIOPT_INDEX_SIZE := 0x154 = 340
+//UIOPT_INDEX_SIZE := 0x168 = 360
 //extern const InfoCommand_t CommandInfo[CMD__N+1];
 extern const InfoUI_t InfoUI_wkclt;
 
@@ -743,6 +743,14 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" https://szs.wiimm.de/opt/kcl for details."
     },
 
+    {	OPT_KCL_THREADS, false, false, false, false, false, 0, "kcl-threads",
+	"N",
+	"Create the octree of KCL files and draw KCL images (option --png) by"
+	" N threads in parallel. The result is independent of N. Keywords OFF"
+	" (=0) and AUTO (=number of online CPUs) are also accepted. Values 0"
+	" and 1 disable this mode."
+    },
+
     {	OPT_TRI_AREA, false, false, false, false, false, 0, "tri-area",
 	"EXPR",
 	"Define the minimal area size of KCL triangles. The intention is to"
@@ -935,7 +943,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" helper option."
     },
 
-    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 103
+    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 104
 
 };
 
@@ -1296,6 +1304,8 @@ static const struct option OptionLong[] =
 	{ "load-kcl",		1, 0, GO_LOAD_KCL },
 	 { "loadkcl",		1, 0, GO_LOAD_KCL },
 	{ "kcl",		1, 0, GO_KCL },
+	{ "kcl-threads",	1, 0, GO_KCL_THREADS },
+	 { "kclthreads",	1, 0, GO_KCL_THREADS },
 	{ "kcl-flag",		1, 0, GO_KCL_FLAG },
 	 { "kclflag",		1, 0, GO_KCL_FLAG },
 	{ "kcl-script",		1, 0, GO_KCL_SCRIPT },
@@ -1481,37 +1491,38 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x0a8   */	OPT_PNG,
 	/* 0x0a9   */	OPT_LOAD_KCL,
 	/* 0x0aa   */	OPT_KCL,
-	/* 0x0ab   */	OPT_KCL_FLAG,
-	/* 0x0ac   */	OPT_KCL_SCRIPT,
-	/* 0x0ad   */	OPT_TRI_AREA,
-	/* 0x0ae   */	OPT_TRI_HEIGHT,
-	/* 0x0af   */	OPT_FLAG_FILE,
-	/* 0x0b0   */	OPT_XTRIDATA,
-	/* 0x0b1   */	OPT_KMP,
-	/* 0x0b2   */	OPT_N_LAPS,
-	/* 0x0b3   */	OPT_SPEED_MOD,
-	/* 0x0b4   */	OPT_KTPT2,
-	/* 0x0b5   */	OPT_TFORM_KMP,
-	/* 0x0b6   */	OPT_REPAIR_XPF,
-	/* 0x0b7   */	OPT_GAMEMODES,
-	/* 0x0b8   */	OPT_ROUND,
-	/* 0x0b9   */	OPT_NO_WILDCARDS,
-	/* 0x0ba   */	OPT_IN_ORDER,
-	/* 0x0bb   */	OPT_EPSILON,
-	/* 0x0bc   */	OPT_DIFF,
-	/* 0x0bd   */	OPT_NO_ECHO,
-	/* 0x0be   */	OPT_UTF_8,
-	/* 0x0bf   */	OPT_NO_UTF_8,
-	/* 0x0c0   */	OPT_FORCE,
-	/* 0x0c1   */	OPT_REPAIR_MAGICS,
-	/* 0x0c2   */	OPT_TINY,
-	/* 0x0c3   */	OPT_OLD,
-	/* 0x0c4   */	OPT_STD,
-	/* 0x0c5   */	OPT_NEW,
-	/* 0x0c6   */	OPT_EXTRACT,
-	/* 0x0c7   */	OPT_NUMBER,
-	/* 0x0c8   */	OPT_SECTIONS,
-	/* 0x0c9   */	 0,0,0,0, 0,0,0,
+	/* 0x0ab   */	OPT_KCL_THREADS,
+	/* 0x0ac   */	OPT_KCL_FLAG,
+	/* 0x0ad   */	OPT_KCL_SCRIPT,
+	/* 0x0ae   */	OPT_TRI_AREA,
+	/* 0x0af   */	OPT_TRI_HEIGHT,
+	/* 0x0b0   */	OPT_FLAG_FILE,
+	/* 0x0b1   */	OPT_XTRIDATA,
+	/* 0x0b2   */	OPT_KMP,
+	/* 0x0b3   */	OPT_N_LAPS,
+	/* 0x0b4   */	OPT_SPEED_MOD,
+	/* 0x0b5   */	OPT_KTPT2,
+	/* 0x0b6   */	OPT_TFORM_KMP,
+	/* 0x0b7   */	OPT_REPAIR_XPF,
+	/* 0x0b8   */	OPT_GAMEMODES,
+	/* 0x0b9   */	OPT_ROUND,
+	/* 0x0ba   */	OPT_NO_WILDCARDS,
+	/* 0x0bb   */	OPT_IN_ORDER,
+	/* 0x0bc   */	OPT_EPSILON,
+	/* 0x0bd   */	OPT_DIFF,
+	/* 0x0be   */	OPT_NO_ECHO,
+	/* 0x0bf   */	OPT_UTF_8,
+	/* 0x0c0   */	OPT_NO_UTF_8,
+	/* 0x0c1   */	OPT_FORCE,
+	/* 0x0c2   */	OPT_REPAIR_MAGICS,
+	/* 0x0c3   */	OPT_TINY,
+	/* 0x0c4   */	OPT_OLD,
+	/* 0x0c5   */	OPT_STD,
+	/* 0x0c6   */	OPT_NEW,
+	/* 0x0c7   */	OPT_EXTRACT,
+	/* 0x0c8   */	OPT_NUMBER,
+	/* 0x0c9   */	OPT_SECTIONS,
+	/* 0x0ca   */	 0,0,0,0, 0,0,
 	/* 0x0d0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0e0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0f0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
@@ -1520,7 +1531,8 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x120   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x130   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x140   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
-	/* 0x150   */	 0,0,0,0, 
+	/* 0x150   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
+	/* 0x160   */	 0,0,0,0, 0,0,0,0, 
 };
 
 //
@@ -1752,6 +1764,7 @@ static const InfoOption_t * option_tab_tool[] =
 	OptionInfo + OPT_WIM0,
 	OptionInfo + OPT_LOAD_KCL,
 	OptionInfo + OPT_KCL,
+	OptionInfo + OPT_KCL_THREADS,
 	OptionInfo + OPT_TRI_AREA,
 	OptionInfo + OPT_TRI_HEIGHT,
 	OptionInfo + OPT_KMP,
@@ -2355,7 +2368,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"Wiimms KMP Tool : Analyze, modify, export and create (compile) KMP"
 	" files.",
 	0,
-	41,
+	42,
 	option_tab_tool,
 	0
     },
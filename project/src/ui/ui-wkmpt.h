@@ -142,6 +142,7 @@ typedef enum enumOptions
 	OPT_WIM0,
 	OPT_LOAD_KCL,
 	OPT_KCL,
+	OPT_KCL_THREADS,
 	OPT_TRI_AREA,
 	OPT_TRI_HEIGHT,
 	OPT_XTRIDATA,
@@ -164,7 +165,7 @@ typedef enum enumOptions
 	OPT_NEW,
 	OPT_EXTRACT,
 
-	OPT__N_TOTAL // == 103
+	OPT__N_TOTAL // == 104
 
 } enumOptions;
 
@@ -537,6 +538,7 @@ typedef enum enumGetOpt
 	GO_PNG,
 	GO_LOAD_KCL,
 	GO_KCL,
+	GO_KCL_THREADS,
 	GO_KCL_FLAG,
 	GO_KCL_SCRIPT,
 	GO_TRI_AREA,
@@ -581,7 +583,7 @@ typedef enum enumGetOpt
 //extern const struct option OptionLong[];
 //extern u8 OptionUsed[OPT__N_TOTAL+1];
 //extern const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE];
-//UIOPT_INDEX_SIZE := 0x154 = 340
+//UIOPT_INDEX_SIZE := 0x168 = 360
 //extern const InfoCommand_t CommandInfo[CMD__N+1];
 extern const InfoUI_t InfoUI_wkmpt;
 
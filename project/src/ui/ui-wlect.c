@@ -628,6 +628,15 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" stderr. The file is openend in append-mode."
     },
 
+    {	OPT_THREADS, false, false, false, false, false, 0, "threads",
+	"N",
+	"Load and compress the track files of instruction cmd|LTA by N worker"
+	" processes in parallel. The LTA files are written by the main process"
+	" in order of the slots, so the result is the same as for sequential"
+	" processing. Keywords OFF (=0, sequential processing) and AUTO"
+	" (=number of online CPUs) are also accepted."
+    },
+
     {	OPT_LT_COND_BIT, false, false, false, false, false, 0, "lt-cond-bit",
 	"bitnum",
 	"Set LEX/TEST parameter COND-BIT to this integer value. Use -1 to"
@@ -721,7 +730,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" helper option."
     },
 
-    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 94
+    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 95
 
 };
 
@@ -962,6 +971,7 @@ static const struct option OptionLong[] =
 	{ "cache",		1, 0, GO_CACHE },
 	{ "log-cache",		1, 0, GO_LOG_CACHE },
 	 { "logcache",		1, 0, GO_LOG_CACHE },
+	{ "threads",		1, 0, GO_THREADS },
 	{ "lt-clear",		0, 0, GO_LT_CLEAR },
 	 { "ltclear",		0, 0, GO_LT_CLEAR },
 	{ "lt-online",		1, 0, GO_LT_ONLINE },
@@ -1134,48 +1144,49 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x098   */	OPT_NO_UTF_8,
 	/* 0x099   */	OPT_CACHE,
 	/* 0x09a   */	OPT_LOG_CACHE,
-	/* 0x09b   */	OPT_LT_CLEAR,
-	/* 0x09c   */	OPT_LT_ONLINE,
-	/* 0x09d   */	OPT_LT_N_PLAYERS,
-	/* 0x09e   */	OPT_LT_COND_BIT,
-	/* 0x09f   */	OPT_LT_GAME_MODE,
-	/* 0x0a0   */	OPT_LT_ENGINE,
-	/* 0x0a1   */	OPT_LT_RANDOM,
-	/* 0x0a2   */	OPT_LEX_PURGE,
-	/* 0x0a3   */	OPT_LEX_RM_FEAT,
-	/* 0x0a4   */	OPT_FORCE,
-	/* 0x0a5   */	OPT_REPAIR_MAGICS,
-	/* 0x0a6   */	OPT_CREATE_DISTRIB,
-	/* 0x0a7   */	OPT_OLD,
-	/* 0x0a8   */	OPT_STD,
-	/* 0x0a9   */	OPT_NEW,
-	/* 0x0aa   */	OPT_EXTRACT,
-	/* 0x0ab   */	OPT_LE_DEFINE,
-	/* 0x0ac   */	OPT_LE_ARENA,
-	/* 0x0ad   */	OPT_LPAR,
-	/* 0x0ae   */	OPT_ALIAS,
-	/* 0x0af   */	OPT_ENGINE,
-	/* 0x0b0   */	OPT_200CC,
-	/* 0x0b1   */	OPT_PERFMON,
-	/* 0x0b2   */	OPT_CUSTOM_TT,
-	/* 0x0b3   */	OPT_XPFLAGS,
-	/* 0x0b4   */	OPT_SPEEDOMETER,
-	/* 0x0b5   */	OPT_DEBUG,
-	/* 0x0b6   */	OPT_TRACK_DIR,
-	/* 0x0b7   */	OPT_COPY_TRACKS,
-	/* 0x0b8   */	OPT_MOVE_TRACKS,
-	/* 0x0b9   */	OPT_MOVE1_TRACKS,
-	/* 0x0ba   */	OPT_LINK_TRACKS,
-	/* 0x0bb   */	OPT_SZS_MODE,
-	/* 0x0bc   */	OPT_LOAD_BMG,
-	/* 0x0bd   */	OPT_PATCH_BMG,
-	/* 0x0be   */	OPT_MACRO_BMG,
-	/* 0x0bf   */	OPT_PATCH_NAMES,
-	/* 0x0c0   */	OPT_ORDER_BY,
-	/* 0x0c1   */	OPT_ORDER_ALL,
-	/* 0x0c2   */	OPT_NUMBER,
-	/* 0x0c3   */	OPT_SECTIONS,
-	/* 0x0c4   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 
+	/* 0x09b   */	OPT_THREADS,
+	/* 0x09c   */	OPT_LT_CLEAR,
+	/* 0x09d   */	OPT_LT_ONLINE,
+	/* 0x09e   */	OPT_LT_N_PLAYERS,
+	/* 0x09f   */	OPT_LT_COND_BIT,
+	/* 0x0a0   */	OPT_LT_GAME_MODE,
+	/* 0x0a1   */	OPT_LT_ENGINE,
+	/* 0x0a2   */	OPT_LT_RANDOM,
+	/* 0x0a3   */	OPT_LEX_PURGE,
+	/* 0x0a4   */	OPT_LEX_RM_FEAT,
+	/* 0x0a5   */	OPT_FORCE,
+	/* 0x0a6   */	OPT_REPAIR_MAGICS,
+	/* 0x0a7   */	OPT_CREATE_DISTRIB,
+	/* 0x0a8   */	OPT_OLD,
+	/* 0x0a9   */	OPT_STD,
+	/* 0x0aa   */	OPT_NEW,
+	/* 0x0ab   */	OPT_EXTRACT,
+	/* 0x0ac   */	OPT_LE_DEFINE,
+	/* 0x0ad   */	OPT_LE_ARENA,
+	/* 0x0ae   */	OPT_LPAR,
+	/* 0x0af   */	OPT_ALIAS,
+	/* 0x0b0   */	OPT_ENGINE,
+	/* 0x0b1   */	OPT_200CC,
+	/* 0x0b2   */	OPT_PERFMON,
+	/* 0x0b3   */	OPT_CUSTOM_TT,
+	/* 0x0b4   */	OPT_XPFLAGS,
+	/* 0x0b5   */	OPT_SPEEDOMETER,
+	/* 0x0b6   */	OPT_DEBUG,
+	/* 0x0b7   */	OPT_TRACK_DIR,
+	/* 0x0b8   */	OPT_COPY_TRACKS,
+	/* 0x0b9   */	OPT_MOVE_TRACKS,
+	/* 0x0ba   */	OPT_MOVE1_TRACKS,
+	/* 0x0bb   */	OPT_LINK_TRACKS,
+	/* 0x0bc   */	OPT_SZS_MODE,
+	/* 0x0bd   */	OPT_LOAD_BMG,
+	/* 0x0be   */	OPT_PATCH_BMG,
+	/* 0x0bf   */	OPT_MACRO_BMG,
+	/* 0x0c0   */	OPT_PATCH_NAMES,
+	/* 0x0c1   */	OPT_ORDER_BY,
+	/* 0x0c2   */	OPT_ORDER_ALL,
+	/* 0x0c3   */	OPT_NUMBER,
+	/* 0x0c4   */	OPT_SECTIONS,
+	/* 0x0c5   */	 0,0,0,0, 0,0,0,0, 0,0,0,
 	/* 0x0d0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0e0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x0f0   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
@@ -1184,7 +1195,8 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x120   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x130   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
 	/* 0x140   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
-	/* 0x150   */	 0,0,0,0, 
+	/* 0x150   */	 0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0,
+	/* 0x160   */	 0,0,0,0, 0,0,0,0, 
 };
 
 //
@@ -1412,6 +1424,7 @@ static const InfoOption_t * option_tab_tool[] =
 
 	OptionInfo + OPT_CACHE,
 	OptionInfo + OPT_LOG_CACHE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -1867,6 +1880,7 @@ static const InfoOption_t * option_tab_cmd_DISTRIBUTION[] =
 	OptionInfo + OPT_LOAD_CATEGORY,
 	OptionInfo + OPT_CACHE,
 	OptionInfo + OPT_LOG_CACHE,
+	OptionInfo + OPT_THREADS,
 	OptionInfo + OPT_PLUS,
 	OptionInfo + OPT_TRACK_DIR,
 	OptionInfo + OPT_COPY_TRACKS,
@@ -1983,7 +1997,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"wlect [option]... command [option|parameter|file]...",
 	"Wiimms LE-CODE Tool : Manage the LE-CODE and LEX extensions.",
 	0,
-	38,
+	39,
 	option_tab_tool,
 	0
     },
@@ -2429,7 +2443,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" are parsed, see https://szs.wiimm.de/doc/wildcards for details.\n"
 	"  Use the command without keyword to get an extended description.",
 	0,
-	23,
+	24,
 	option_tab_cmd_DISTRIBUTION,
 	option_allowed_cmd_DISTRIBUTION
     },
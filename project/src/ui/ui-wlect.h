@@ -141,6 +141,7 @@ typedef enum enumOptions
 	OPT_NO_UTF_8,
 	OPT_CACHE,
 	OPT_LOG_CACHE,
+	OPT_THREADS,
 	OPT_LT_COND_BIT,
 	OPT_LT_GAME_MODE,
 	OPT_LT_ENGINE,
@@ -155,7 +156,7 @@ typedef enum enumOptions
 	OPT_NEW,
 	OPT_EXTRACT,
 
-	OPT__N_TOTAL // == 94
+	OPT__N_TOTAL // == 95
 
 } enumOptions;
 
@@ -492,6 +493,7 @@ typedef enum enumGetOpt
 	GO_NO_UTF_8,
 	GO_CACHE,
 	GO_LOG_CACHE,
+	GO_THREADS,
 	GO_LT_CLEAR,
 	GO_LT_ONLINE,
 	GO_LT_N_PLAYERS,
@@ -547,7 +549,7 @@ typedef enum enumGetOpt
 //extern const struct option OptionLong[];
 //extern u8 OptionUsed[OPT__N_TOTAL+1];
 //extern const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE];
-//UIOPT_INDEX_SIZE := 0x154 = 340
+//UIOPT_INDEX_SIZE := 0x168 = 360
 //extern const InfoCommand_t CommandInfo[CMD__N+1];
 extern const InfoUI_t InfoUI_wlect;
 
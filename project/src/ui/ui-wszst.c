@@ -515,6 +515,16 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	"Don't copy a file if it was not modified."
     },
 
+    {	OPT_THREADS, false, false, false, false, false, 0, "threads",
+	"N",
+	"Process the source files by N worker processes in parallel. The log"
+	" output of each job is collected and printed in the order of the"
+	" source files. New entries for the SZS cache are merged into the main"
+	" process and the cache is updated only once at the end. Keywords OFF"
+	" (=0, sequential processing) and AUTO (=number of online CPUs) are"
+	" also accepted. Values 0 and 1 disable parallel processing."
+    },
+
     {	OPT_ID, false, false, false, false, false, 0, "id",
 	0,
 	"Print an ID with 8 characters instead of a SHA-1 sum with 40"
@@ -799,7 +809,16 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 
     {	OPT_ID_LIST, false, true, false, false, false, 0, "id-list",
 	"file",
-	"Set filename of a SHA1ID file."
+	"Set filename of a SHA1ID file. The file is loaded only once and"
+	" indexed in memory."
+    },
+
+    {	OPT_ID_LIST_INDEX, false, true, false, false, false, 0, "id-list-index",
+	0,
+	"Use a binary index »file.idx« for the SHA1ID file of --id-list. The"
+	" index is used instead of the text file as long as size and"
+	" modification time of the text file are unchanged. Otherwise it is"
+	" created after scanning the text file."
     },
 
     {	OPT_REFERENCE, false, false, false, false, false, 0, "ref",
@@ -1078,10 +1097,10 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	"level",
 	"Define a compression level between 0..9: 0 (or NOCHUNKS) disables"
 	" finding chunks, 1 (or FAST) for the fastest standard compression and"
-	" 9 (or BEST) for the best (=default) compression. 10 (or ULTRA) and"
-	" 100-150 are special time-consuming compression modes. They are"
-	" dedicated to competitions with size limitations. The special value"
-	" UNCOMPRESSED acts like option --no-compress.\n"
+	" 9 (or BEST) for the best (=default) compression. 10 (or ULTRA),"
+	" 100-150 and 200 (or OPTIMAL) are special time-consuming compression"
+	" modes. They are dedicated to competitions with size limitations. The"
+	" special value UNCOMPRESSED acts like option --no-compress.\n"
 	"  Because of many repeated data, the best bz-compression mode varies."
 	" Therefor the levels TRY2..TRY5 (or short T2..T5) are defined to find"
 	" the best compression mode with testing the first N modes of 9, 1, 8,"
@@ -1096,6 +1115,17 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" output type 'wszst -C clist'."
     },
 
+    {	OPT_COMPR_THREADS, false, false, false, false, false, 0, "compr-threads",
+	"N",
+	"Compress large sources (at least 2 MiB) in independent blocks of 1"
+	" MiB by N threads in parallel. Back references may still point into"
+	" the previous block, so the size cost is negligible. The result"
+	" depends only on the compression level, but not on N. Only the"
+	" classic YAZ compression levels are affected. Keywords OFF (=0) and"
+	" AUTO (=number of online CPUs) are also accepted. Values 0 and 1"
+	" disable this mode."
+    },
+
     {	OPT_FAST, false, false, false, false, false, 0, "fast",
 	0,
 	"Short cut for --compr=fast: Set the fastest real compression. It also"
@@ -1194,6 +1224,16 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" short cut."
     },
 
+    {	OPT_MIPMAP_FILTER, false, false, false, false, false, 0, "mipmap-filter",
+	"mode",
+	"Select how mipmaps are created. SMART (default) resizes each mipmap"
+	" from the source image. The other modes create each mipmap from the"
+	" previous one, so that the work shrinks from level to level: BOX uses"
+	" the same resize algorithm as SMART, BILINEAR uses a bilinear filter"
+	" and LANCZOS uses a sharper Lanczos-3 filter. --mm-filter is a short"
+	" cut."
+    },
+
     {	OPT_CMPR_DEFAULT, false, false, false, false, false, 0, "cmpr-default",
 	"rgb1[,rgb2]",
 	"Define 2 colors for the case, that all 16 pixels of a CMPR block are"
@@ -1235,7 +1275,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	"Print in machine readable sections and parameter lines."
     },
 
-    {0,0,0,0,0,0,0,0,0,0}, // OPT__N_SPECIFIC == 149
+    {0,0,0,0,0,0,0,0,0,0}, // OPT__N_SPECIFIC == 153
 
     //----- global options -----
 
@@ -1496,6 +1536,14 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" https://szs.wiimm.de/opt/kcl for details."
     },
 
+    {	OPT_KCL_THREADS, false, false, false, false, false, 0, "kcl-threads",
+	"N",
+	"Create the octree of KCL files and draw KCL images (option --png) by"
+	" N threads in parallel. The result is independent of N. Keywords OFF"
+	" (=0) and AUTO (=number of online CPUs) are also accepted. Values 0"
+	" and 1 disable this mode."
+    },
+
     {	OPT_TRI_AREA, false, false, false, false, false, 0, "tri-area",
 	"EXPR",
 	"Define the minimal area size of KCL triangles. The intention is to"
@@ -1617,6 +1665,40 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" and LOG. See https://szs.wiimm.de/opt/pat for details."
     },
 
+    {	OPT_CMPR_THREADS, false, false, false, false, false, 0, "cmpr-threads",
+	"N",
+	"Encode CMPR images by N threads in parallel. Each thread encodes rows"
+	" of 8x8 blocks, so the result is independent of N. Keywords OFF (=0)"
+	" and AUTO (=number of online CPUs) are also accepted. Values 0 and 1"
+	" disable this mode."
+    },
+
+    {	OPT_CMPR_FIT, false, false, false, false, false, 0, "cmpr-fit",
+	"mode",
+	"Select the method to find the 2 base colors of a CMPR block. RANGE"
+	" (default) selects the best pair of block colors. CLUSTER tries"
+	" additionally a least squares fit for all clusterings of the pixels"
+	" along the principal axis and uses it, if the result is better. This"
+	" is slower."
+    },
+
+    {	OPT_PAL_QUANT, false, false, false, false, false, 0, "pal-quant",
+	"mode",
+	"Select the algorithm to calculate the palette of CI4, CI8 and C14X2"
+	" images. MEDIAN-CUT (default) splits the color space by median cut"
+	" and assigns each pixel to its block. K-MEANS starts with a weighted"
+	" median cut of the color histogram, refines the palette by k-means"
+	" iterations and assigns each pixel to the nearest palette color. The"
+	" result is better, especially for large palettes."
+    },
+
+    {	OPT_PAL_THREADS, false, false, false, false, false, 0, "pal-threads",
+	"N",
+	"Use N threads in parallel for the nearest color search of --pal-quant"
+	" K-MEANS. Keywords OFF (=0) and AUTO (=number of online CPUs) are"
+	" also accepted. Values 0 and 1 disable threads."
+    },
+
     {	OPT_PATCH_FILES, false, false, false, false, false, 0, "patch-files",
 	"list",
 	"Define, which kind of KMP, KCL and BRRES/MDL files are objects for"
@@ -1989,7 +2071,7 @@ static const InfoOption_t OptionInfo[OPT__N_TOTAL+1] =
 	" helper option."
     },
 
-    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 243
+    {0,0,0,0,0,0,0,0,0,0} // OPT__N_TOTAL == 252
 
 };
 
@@ -2223,8 +2305,8 @@ static const InfoOption_t option_cmd_TRACKS_LONG =
 static const InfoOption_t option_cmd_SCANCACHE_FAST =
     {	OPT_FAST, false, false, false, false, false, 0, "fast",
 	0,
-	"Scan 'cache-content.txt' and remove duplicates. Ignore option"
-	" --purge."
+	"Don't scan the directory, but rewrite the index and the text file"
+	" with all known entries. Ignore option --purge."
     };
 
 static const InfoOption_t option_cmd_SIZEOF_SORT =
@@ -2547,6 +2629,8 @@ static const KeywordTab_t CommandTab[] =
     { CMD_AUTOADD,	"AUTOADD",	0,		0 },
     { CMD_TRACKS,	"TRACKS",	0,		0 },
     { CMD_SCANCACHE,	"SCANCACHE",	0,		0 },
+    { CMD_COMPACTCACHE,	"COMPACTCACHE",	0,		0 },
+    { CMD_SERVER,	"SERVER",	0,		0 },
     { CMD_EXPORT,	"_EXPORT",	0,		0 },
     { CMD_SIZEOF,	"SIZEOF",	0,		0 },
     { CMD_CODE,		"_CODE",	0,		0 },
@@ -2722,6 +2806,8 @@ static const struct option OptionLong[] =
 	{ "load-kcl",		1, 0, GO_LOAD_KCL },
 	 { "loadkcl",		1, 0, GO_LOAD_KCL },
 	{ "kcl",		1, 0, GO_KCL },
+	{ "kcl-threads",	1, 0, GO_KCL_THREADS },
+	 { "kclthreads",	1, 0, GO_KCL_THREADS },
 	{ "kcl-flag",		1, 0, GO_KCL_FLAG },
 	 { "kclflag",		1, 0, GO_KCL_FLAG },
 	{ "kcl-script",		1, 0, GO_KCL_SCRIPT },
@@ -2752,6 +2838,14 @@ static const struct option OptionLong[] =
 	 { "gmodes",		1, 0, GO_GAMEMODES },
 	{ "mdl",		1, 0, GO_MDL },
 	{ "pat",		1, 0, GO_PAT },
+	{ "cmpr-threads",	1, 0, GO_CMPR_THREADS },
+	 { "cmprthreads",	1, 0, GO_CMPR_THREADS },
+	{ "cmpr-fit",		1, 0, GO_CMPR_FIT },
+	 { "cmprfit",		1, 0, GO_CMPR_FIT },
+	{ "pal-quant",		1, 0, GO_PAL_QUANT },
+	 { "palquant",		1, 0, GO_PAL_QUANT },
+	{ "pal-threads",	1, 0, GO_PAL_THREADS },
+	 { "palthreads",	1, 0, GO_PAL_THREADS },
 	{ "patch-files",	1, 0, GO_PATCH_FILES },
 	 { "patchfiles",	1, 0, GO_PATCH_FILES },
 	 { "pfiles",		1, 0, GO_PATCH_FILES },
@@ -2810,6 +2904,7 @@ static const struct option OptionLong[] =
 	{ "log-cache",		1, 0, GO_LOG_CACHE },
 	 { "logcache",		1, 0, GO_LOG_CACHE },
 	{ "parallel",		0, 0, GO_PARALLEL },
+	{ "threads",		1, 0, GO_THREADS },
 	{ "id",			0, 0, GO_ID },
 	{ "base64",		2, 0, GO_BASE64 },
 	{ "db64",		2, 0, GO_DB64 },
@@ -2916,6 +3011,8 @@ static const struct option OptionLong[] =
 	 { "src",		1, 0, 's' },
 	{ "id-list",		1, 0, GO_ID_LIST },
 	 { "idlist",		1, 0, GO_ID_LIST },
+	{ "id-list-index",	0, 0, GO_ID_LIST_INDEX },
+	 { "idlistindex",	0, 0, GO_ID_LIST_INDEX },
 	{ "ref",		1, 0, GO_REFERENCE },
 	 { "reference",		1, 0, GO_REFERENCE },
 	{ "dest",		1, 0, 'd' },
@@ -2994,6 +3091,8 @@ static const struct option OptionLong[] =
 	 { "noc",		0, 0, GO_NO_COMPRESS },
 	{ "compr",		1, 0, 'C' },
 	 { "compress",		1, 0, 'C' },
+	{ "compr-threads",	1, 0, GO_COMPR_THREADS },
+	 { "comprthreads",	1, 0, GO_COMPR_THREADS },
 	{ "fast",		0, 0, GO_FAST },
 	{ "norm",		0, 0, 'n' },
 	{ "links",		0, 0, GO_LINKS },
@@ -3025,6 +3124,10 @@ static const struct option OptionLong[] =
 	 { "fastmipmaps",	0, 0, GO_FAST_MIPMAPS },
 	 { "fast-mm",		0, 0, GO_FAST_MIPMAPS },
 	 { "fastmm",		0, 0, GO_FAST_MIPMAPS },
+	{ "mipmap-filter",	1, 0, GO_MIPMAP_FILTER },
+	 { "mipmapfilter",	1, 0, GO_MIPMAP_FILTER },
+	 { "mm-filter",		1, 0, GO_MIPMAP_FILTER },
+	 { "mmfilter",		1, 0, GO_MIPMAP_FILTER },
 	{ "cmpr-default",	1, 0, GO_CMPR_DEFAULT },
 	{ "cut",		0, 0, GO_CUT },
 	{ "all",		0, 0, 'a' },
@@ -3155,155 +3258,165 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 	/* 0x0b7   */	OPT_SLOT,
 	/* 0x0b8   */	OPT_LOAD_KCL,
 	/* 0x0b9   */	OPT_KCL,
-	/* 0x0ba   */	OPT_KCL_FLAG,
-	/* 0x0bb   */	OPT_KCL_SCRIPT,
-	/* 0x0bc   */	OPT_TRI_AREA,
-	/* 0x0bd   */	OPT_TRI_HEIGHT,
-	/* 0x0be   */	OPT_FLAG_FILE,
-	/* 0x0bf   */	OPT_XTRIDATA,
-	/* 0x0c0   */	OPT_KMP,
-	/* 0x0c1   */	OPT_N_LAPS,
-	/* 0x0c2   */	OPT_SPEED_MOD,
-	/* 0x0c3   */	OPT_KTPT2,
-	/* 0x0c4   */	OPT_TFORM_KMP,
-	/* 0x0c5   */	OPT_REPAIR_XPF,
-	/* 0x0c6   */	OPT_GAMEMODES,
-	/* 0x0c7   */	OPT_MDL,
-	/* 0x0c8   */	OPT_PAT,
-	/* 0x0c9   */	OPT_PATCH_FILES,
-	/* 0x0ca   */	OPT_KMG_LIMIT,
-	/* 0x0cb   */	OPT_KMG_COPY,
-	/* 0x0cc   */	OPT_LT_CLEAR,
-	/* 0x0cd   */	OPT_LT_ONLINE,
-	/* 0x0ce   */	OPT_LT_N_PLAYERS,
-	/* 0x0cf   */	OPT_LT_COND_BIT,
-	/* 0x0d0   */	OPT_LT_GAME_MODE,
-	/* 0x0d1   */	OPT_LT_ENGINE,
-	/* 0x0d2   */	OPT_LT_RANDOM,
-	/* 0x0d3   */	OPT_LEX_PURGE,
-	/* 0x0d4   */	OPT_LEX_FEATURES,
-	/* 0x0d5   */	OPT_LEX_RM_FEAT,
-	/* 0x0d6   */	OPT_LOAD_BMG,
-	/* 0x0d7   */	OPT_PATCH_BMG,
-	/* 0x0d8   */	OPT_MACRO_BMG,
-	/* 0x0d9   */	OPT_FILTER_BMG,
-	/* 0x0da   */	OPT_LE_MENU,
-	/* 0x0db   */	OPT_9LAPS,
-	/* 0x0dc   */	OPT_UI_SOURCE,
-	/* 0x0dd   */	OPT_TITLE_SCREEN,
-	/* 0x0de   */	OPT_CUP_ICONS,
-	/* 0x0df   */	OPT_NO_COPY,
-	/* 0x0e0   */	OPT_CACHE,
-	/* 0x0e1   */	OPT_CNAME,
-	/* 0x0e2   */	OPT_LOG_CACHE,
-	/* 0x0e3   */	OPT_PARALLEL,
-	/* 0x0e4   */	OPT_ID,
-	/* 0x0e5   */	OPT_BASE64,
-	/* 0x0e6   */	OPT_DB64,
-	/* 0x0e7   */	OPT_CODING,
-	/* 0x0e8   */	OPT_VERIFY,
-	/* 0x0e9   */	OPT_ROUND,
-	/* 0x0ea   */	OPT_NO_WILDCARDS,
-	/* 0x0eb   */	OPT_IN_ORDER,
-	/* 0x0ec   */	OPT_PIPE,
-	/* 0x0ed   */	OPT_DELTA,
-	/* 0x0ee   */	OPT_DIFF,
-	/* 0x0ef   */	OPT_EPSILON,
-	/* 0x0f0   */	OPT_BMG_ENDIAN,
-	/* 0x0f1   */	OPT_BMG_ENCODING,
-	/* 0x0f2   */	OPT_BMG_INF_SIZE,
-	/* 0x0f3   */	OPT_BMG_MID,
-	/* 0x0f4   */	OPT_FORCE_ATTRIB,
-	/* 0x0f5   */	OPT_DEF_ATTRIB,
-	/* 0x0f6   */	OPT_NO_ATTRIB,
-	/* 0x0f7   */	OPT_X_ESCAPES,
-	/* 0x0f8   */	OPT_OLD_ESCAPES,
-	/* 0x0f9   */	OPT_NO_BMG_COLORS,
-	/* 0x0fa   */	OPT_BMG_COLORS,
-	/* 0x0fb   */	OPT_NO_BMG_INLINE,
-	/* 0x0fc   */	OPT_AUTOADD_PATH,
-	/* 0x0fd   */	OPT_STRIP,
-	/* 0x0fe   */	OPT_UTF_8,
-	/* 0x0ff   */	OPT_NO_UTF_8,
-	/* 0x100   */	OPT_FORCE,
-	/* 0x101   */	OPT_REPAIR_MAGICS,
-	/* 0x102   */	OPT_TINY,
-	/* 0x103   */	OPT_YAZ0,
-	/* 0x104   */	OPT_YAZ1,
-	/* 0x105   */	OPT_XYZ,
-	/* 0x106   */	OPT_BZ,
-	/* 0x107   */	OPT_BZIP2,
-	/* 0x108   */	OPT_CYBZ,
-	/* 0x109   */	OPT_YBZ,
-	/* 0x10a   */	OPT_LZ,
-	/* 0x10b   */	OPT_LZMA,
-	/* 0x10c   */	OPT_CYLZ,
-	/* 0x10d   */	OPT_YLZ,
-	/* 0x10e   */	OPT_SH,
-	/* 0x10f   */	OPT_BASH,
-	/* 0x110   */	OPT_JSON,
-	/* 0x111   */	OPT_PHP,
-	/* 0x112   */	OPT_MAKEDOC,
-	/* 0x113   */	OPT_VAR,
-	/* 0x114   */	OPT_ARRAY,
-	/* 0x115   */	OPT_AVAR,
-	/* 0x116   */	OPT_CASE,
-	/* 0x117   */	OPT_FMODES,
-	/* 0x118   */	OPT_INSTALL,
-	/* 0x119   */	OPT_ANALYZE,
-	/* 0x11a   */	OPT_ANALYZE_MODE,
-	/* 0x11b   */	OPT_OLD,
-	/* 0x11c   */	OPT_STD,
-	/* 0x11d   */	OPT_NEW,
-	/* 0x11e   */	OPT_EXTRACT,
-	/* 0x11f   */	OPT_ID_LIST,
-	/* 0x120   */	OPT_REFERENCE,
-	/* 0x121   */	OPT_NUMBER,
-	/* 0x122   */	OPT_REMOVE_SRC,
-	/* 0x123   */	OPT_IGNORE_SETUP,
-	/* 0x124   */	OPT_PURGE,
-	/* 0x125   */	OPT_ALIGN_U8,
-	/* 0x126   */	OPT_ALIGN_LTA,
-	/* 0x127   */	OPT_ALIGN_PACK,
-	/* 0x128   */	OPT_ALIGN_BRRES,
-	/* 0x129   */	OPT_ALIGN_BREFF,
-	/* 0x12a   */	OPT_ALIGN_BREFT,
-	/* 0x12b   */	OPT_ALIGN,
-	/* 0x12c   */	OPT_ENCODE_ALL,
-	/* 0x12d   */	OPT_ENCODE_IMG,
-	/* 0x12e   */	OPT_NO_ENCODE,
-	/* 0x12f   */	OPT_NO_RECURSE,
-	/* 0x130   */	OPT_AUTO_ADD,
-	/* 0x131   */	OPT_NO_ECHO,
-	/* 0x132   */	OPT_PT_DIR,
-	/* 0x133   */	OPT_RM_AIPARAM,
-	/* 0x134   */	OPT_U8,
-	/* 0x135   */	OPT_SZS,
-	/* 0x136   */	OPT_WU8,
-	/* 0x137   */	OPT_XWU8,
-	/* 0x138   */	OPT_WBZ,
-	/* 0x139   */	OPT_WLZ,
-	/* 0x13a   */	OPT_LFL,
-	/* 0x13b   */	OPT_PACK,
-	/* 0x13c   */	OPT_BRRES,
-	/* 0x13d   */	OPT_BREFF,
-	/* 0x13e   */	OPT_BREFT,
-	/* 0x13f   */	OPT_NO_COMPRESS,
-	/* 0x140   */	OPT_FAST,
-	/* 0x141   */	OPT_LINKS,
-	/* 0x142   */	OPT_BASEDIR,
-	/* 0x143   */	OPT_DECODE,
-	/* 0x144   */	OPT_MIPMAPS,
-	/* 0x145   */	OPT_NO_MIPMAPS,
-	/* 0x146   */	OPT_N_MIPMAPS,
-	/* 0x147   */	OPT_MAX_MIPMAPS,
-	/* 0x148   */	OPT_MIPMAP_SIZE,
-	/* 0x149   */	OPT_FAST_MIPMAPS,
-	/* 0x14a   */	OPT_CMPR_DEFAULT,
-	/* 0x14b   */	OPT_CUT,
-	/* 0x14c   */	OPT_RAW,
-	/* 0x14d   */	OPT_SECTIONS,
-	/* 0x14e   */	 0,0,0,0, 0,0,
+	/* 0x0ba   */	OPT_KCL_THREADS,
+	/* 0x0bb   */	OPT_KCL_FLAG,
+	/* 0x0bc   */	OPT_KCL_SCRIPT,
+	/* 0x0bd   */	OPT_TRI_AREA,
+	/* 0x0be   */	OPT_TRI_HEIGHT,
+	/* 0x0bf   */	OPT_FLAG_FILE,
+	/* 0x0c0   */	OPT_XTRIDATA,
+	/* 0x0c1   */	OPT_KMP,
+	/* 0x0c2   */	OPT_N_LAPS,
+	/* 0x0c3   */	OPT_SPEED_MOD,
+	/* 0x0c4   */	OPT_KTPT2,
+	/* 0x0c5   */	OPT_TFORM_KMP,
+	/* 0x0c6   */	OPT_REPAIR_XPF,
+	/* 0x0c7   */	OPT_GAMEMODES,
+	/* 0x0c8   */	OPT_MDL,
+	/* 0x0c9   */	OPT_PAT,
+	/* 0x0ca   */	OPT_CMPR_THREADS,
+	/* 0x0cb   */	OPT_CMPR_FIT,
+	/* 0x0cc   */	OPT_PAL_QUANT,
+	/* 0x0cd   */	OPT_PAL_THREADS,
+	/* 0x0ce   */	OPT_PATCH_FILES,
+	/* 0x0cf   */	OPT_KMG_LIMIT,
+	/* 0x0d0   */	OPT_KMG_COPY,
+	/* 0x0d1   */	OPT_LT_CLEAR,
+	/* 0x0d2   */	OPT_LT_ONLINE,
+	/* 0x0d3   */	OPT_LT_N_PLAYERS,
+	/* 0x0d4   */	OPT_LT_COND_BIT,
+	/* 0x0d5   */	OPT_LT_GAME_MODE,
+	/* 0x0d6   */	OPT_LT_ENGINE,
+	/* 0x0d7   */	OPT_LT_RANDOM,
+	/* 0x0d8   */	OPT_LEX_PURGE,
+	/* 0x0d9   */	OPT_LEX_FEATURES,
+	/* 0x0da   */	OPT_LEX_RM_FEAT,
+	/* 0x0db   */	OPT_LOAD_BMG,
+	/* 0x0dc   */	OPT_PATCH_BMG,
+	/* 0x0dd   */	OPT_MACRO_BMG,
+	/* 0x0de   */	OPT_FILTER_BMG,
+	/* 0x0df   */	OPT_LE_MENU,
+	/* 0x0e0   */	OPT_9LAPS,
+	/* 0x0e1   */	OPT_UI_SOURCE,
+	/* 0x0e2   */	OPT_TITLE_SCREEN,
+	/* 0x0e3   */	OPT_CUP_ICONS,
+	/* 0x0e4   */	OPT_NO_COPY,
+	/* 0x0e5   */	OPT_CACHE,
+	/* 0x0e6   */	OPT_CNAME,
+	/* 0x0e7   */	OPT_LOG_CACHE,
+	/* 0x0e8   */	OPT_PARALLEL,
+	/* 0x0e9   */	OPT_THREADS,
+	/* 0x0ea   */	OPT_ID,
+	/* 0x0eb   */	OPT_BASE64,
+	/* 0x0ec   */	OPT_DB64,
+	/* 0x0ed   */	OPT_CODING,
+	/* 0x0ee   */	OPT_VERIFY,
+	/* 0x0ef   */	OPT_ROUND,
+	/* 0x0f0   */	OPT_NO_WILDCARDS,
+	/* 0x0f1   */	OPT_IN_ORDER,
+	/* 0x0f2   */	OPT_PIPE,
+	/* 0x0f3   */	OPT_DELTA,
+	/* 0x0f4   */	OPT_DIFF,
+	/* 0x0f5   */	OPT_EPSILON,
+	/* 0x0f6   */	OPT_BMG_ENDIAN,
+	/* 0x0f7   */	OPT_BMG_ENCODING,
+	/* 0x0f8   */	OPT_BMG_INF_SIZE,
+	/* 0x0f9   */	OPT_BMG_MID,
+	/* 0x0fa   */	OPT_FORCE_ATTRIB,
+	/* 0x0fb   */	OPT_DEF_ATTRIB,
+	/* 0x0fc   */	OPT_NO_ATTRIB,
+	/* 0x0fd   */	OPT_X_ESCAPES,
+	/* 0x0fe   */	OPT_OLD_ESCAPES,
+	/* 0x0ff   */	OPT_NO_BMG_COLORS,
+	/* 0x100   */	OPT_BMG_COLORS,
+	/* 0x101   */	OPT_NO_BMG_INLINE,
+	/* 0x102   */	OPT_AUTOADD_PATH,
+	/* 0x103   */	OPT_STRIP,
+	/* 0x104   */	OPT_UTF_8,
+	/* 0x105   */	OPT_NO_UTF_8,
+	/* 0x106   */	OPT_FORCE,
+	/* 0x107   */	OPT_REPAIR_MAGICS,
+	/* 0x108   */	OPT_TINY,
+	/* 0x109   */	OPT_YAZ0,
+	/* 0x10a   */	OPT_YAZ1,
+	/* 0x10b   */	OPT_XYZ,
+	/* 0x10c   */	OPT_BZ,
+	/* 0x10d   */	OPT_BZIP2,
+	/* 0x10e   */	OPT_CYBZ,
+	/* 0x10f   */	OPT_YBZ,
+	/* 0x110   */	OPT_LZ,
+	/* 0x111   */	OPT_LZMA,
+	/* 0x112   */	OPT_CYLZ,
+	/* 0x113   */	OPT_YLZ,
+	/* 0x114   */	OPT_SH,
+	/* 0x115   */	OPT_BASH,
+	/* 0x116   */	OPT_JSON,
+	/* 0x117   */	OPT_PHP,
+	/* 0x118   */	OPT_MAKEDOC,
+	/* 0x119   */	OPT_VAR,
+	/* 0x11a   */	OPT_ARRAY,
+	/* 0x11b   */	OPT_AVAR,
+	/* 0x11c   */	OPT_CASE,
+	/* 0x11d   */	OPT_FMODES,
+	/* 0x11e   */	OPT_INSTALL,
+	/* 0x11f   */	OPT_ANALYZE,
+	/* 0x120   */	OPT_ANALYZE_MODE,
+	/* 0x121   */	OPT_OLD,
+	/* 0x122   */	OPT_STD,
+	/* 0x123   */	OPT_NEW,
+	/* 0x124   */	OPT_EXTRACT,
+	/* 0x125   */	OPT_ID_LIST,
+	/* 0x126   */	OPT_ID_LIST_INDEX,
+	/* 0x127   */	OPT_REFERENCE,
+	/* 0x128   */	OPT_NUMBER,
+	/* 0x129   */	OPT_REMOVE_SRC,
+	/* 0x12a   */	OPT_IGNORE_SETUP,
+	/* 0x12b   */	OPT_PURGE,
+	/* 0x12c   */	OPT_ALIGN_U8,
+	/* 0x12d   */	OPT_ALIGN_LTA,
+	/* 0x12e   */	OPT_ALIGN_PACK,
+	/* 0x12f   */	OPT_ALIGN_BRRES,
+	/* 0x130   */	OPT_ALIGN_BREFF,
+	/* 0x131   */	OPT_ALIGN_BREFT,
+	/* 0x132   */	OPT_ALIGN,
+	/* 0x133   */	OPT_ENCODE_ALL,
+	/* 0x134   */	OPT_ENCODE_IMG,
+	/* 0x135   */	OPT_NO_ENCODE,
+	/* 0x136   */	OPT_NO_RECURSE,
+	/* 0x137   */	OPT_AUTO_ADD,
+	/* 0x138   */	OPT_NO_ECHO,
+	/* 0x139   */	OPT_PT_DIR,
+	/* 0x13a   */	OPT_RM_AIPARAM,
+	/* 0x13b   */	OPT_U8,
+	/* 0x13c   */	OPT_SZS,
+	/* 0x13d   */	OPT_WU8,
+	/* 0x13e   */	OPT_XWU8,
+	/* 0x13f   */	OPT_WBZ,
+	/* 0x140   */	OPT_WLZ,
+	/* 0x141   */	OPT_LFL,
+	/* 0x142   */	OPT_PACK,
+	/* 0x143   */	OPT_BRRES,
+	/* 0x144   */	OPT_BREFF,
+	/* 0x145   */	OPT_BREFT,
+	/* 0x146   */	OPT_NO_COMPRESS,
+	/* 0x147   */	OPT_COMPR_THREADS,
+	/* 0x148   */	OPT_FAST,
+	/* 0x149   */	OPT_LINKS,
+	/* 0x14a   */	OPT_BASEDIR,
+	/* 0x14b   */	OPT_DECODE,
+	/* 0x14c   */	OPT_MIPMAPS,
+	/* 0x14d   */	OPT_NO_MIPMAPS,
+	/* 0x14e   */	OPT_N_MIPMAPS,
+	/* 0x14f   */	OPT_MAX_MIPMAPS,
+	/* 0x150   */	OPT_MIPMAP_SIZE,
+	/* 0x151   */	OPT_FAST_MIPMAPS,
+	/* 0x152   */	OPT_MIPMAP_FILTER,
+	/* 0x153   */	OPT_CMPR_DEFAULT,
+	/* 0x154   */	OPT_CUT,
+	/* 0x155   */	OPT_RAW,
+	/* 0x156   */	OPT_SECTIONS,
+	/* 0x157   */	 0,0,0,0, 0,0,0,0, 0,
+	/* 0x160   */	 0,0,0,0, 0,0,0,0, 
 };
 
 //
@@ -3311,742 +3424,844 @@ static const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE] =
 ///////////////                opt_allowed_cmd_*                ///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static u8 option_allowed_cmd_VERSION[149] = // cmd #1
+static u8 option_allowed_cmd_VERSION[153] = // cmd #1
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,1,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_HELP[149] = // cmd #2
+static u8 option_allowed_cmd_HELP[153] = // cmd #2
 {
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1
 };
 
-static u8 option_allowed_cmd_CONFIG[149] = // cmd #3
+static u8 option_allowed_cmd_CONFIG[153] = // cmd #3
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,1,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_INSTALL[149] = // cmd #4
+static u8 option_allowed_cmd_INSTALL[153] = // cmd #4
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_ARGTEST[149] = // cmd #5
+static u8 option_allowed_cmd_ARGTEST[153] = // cmd #5
 {
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1
 };
 
-static u8 option_allowed_cmd_EXPAND[149] = // cmd #6
+static u8 option_allowed_cmd_EXPAND[153] = // cmd #6
 {
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1
 };
 
-static u8 option_allowed_cmd_WILDCARDS[149] = // cmd #7
+static u8 option_allowed_cmd_WILDCARDS[153] = // cmd #7
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_TEST[149] = // cmd #8
+static u8 option_allowed_cmd_TEST[153] = // cmd #8
 {
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
     1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1
 };
 
-static u8 option_allowed_cmd_COLORS[149] = // cmd #9
+static u8 option_allowed_cmd_COLORS[153] = // cmd #9
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,1,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0
 };
 
-static u8 option_allowed_cmd_ERROR[149] = // cmd #10
+static u8 option_allowed_cmd_ERROR[153] = // cmd #10
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_FILETYPE[149] = // cmd #11
+static u8 option_allowed_cmd_FILETYPE[153] = // cmd #11
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_UI_CHECK[149] = // cmd #12
+static u8 option_allowed_cmd_UI_CHECK[153] = // cmd #12
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_FILEATTRIB[149] = // cmd #13
+static u8 option_allowed_cmd_FILEATTRIB[153] = // cmd #13
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_BRSUB[149] = // cmd #14
+static u8 option_allowed_cmd_BRSUB[153] = // cmd #14
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_SYMBOLS[149] = // cmd #15
+static u8 option_allowed_cmd_SYMBOLS[153] = // cmd #15
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_FUNCTIONS[149] = // cmd #16
+static u8 option_allowed_cmd_FUNCTIONS[153] = // cmd #16
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0
 };
 
-static u8 option_allowed_cmd_CALCULATE[149] = // cmd #17
+static u8 option_allowed_cmd_CALCULATE[153] = // cmd #17
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_MATRIX[149] = // cmd #18
+static u8 option_allowed_cmd_MATRIX[153] = // cmd #18
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0
 };
 
-static u8 option_allowed_cmd_FLOAT[149] = // cmd #19
+static u8 option_allowed_cmd_FLOAT[153] = // cmd #19
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_VR_CALC[149] = // cmd #20
+static u8 option_allowed_cmd_VR_CALC[153] = // cmd #20
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_VR_RACE[149] = // cmd #21
+static u8 option_allowed_cmd_VR_RACE[153] = // cmd #21
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0
 };
 
-static u8 option_allowed_cmd_AUTOADD[149] = // cmd #22
+static u8 option_allowed_cmd_AUTOADD[153] = // cmd #22
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,0,1,0, 0,1,0,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,0, 1,0,0,1,0,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_TRACKS[149] = // cmd #23
+static u8 option_allowed_cmd_TRACKS[153] = // cmd #23
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,0,
-    0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,1,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0
+    1,0,0
 };
 
-static u8 option_allowed_cmd_SCANCACHE[149] = // cmd #24
+static u8 option_allowed_cmd_SCANCACHE[153] = // cmd #24
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_EXPORT[149] = // cmd #25
+static u8 option_allowed_cmd_COMPACTCACHE[153] = // cmd #25
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_SIZEOF[149] = // cmd #26
+static u8 option_allowed_cmd_SERVER[153] = // cmd #26
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_CODE[149] = // cmd #27
+static u8 option_allowed_cmd_EXPORT[153] = // cmd #27
+{
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
+};
+
+static u8 option_allowed_cmd_SIZEOF[153] = // cmd #28
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
+};
+
+static u8 option_allowed_cmd_CODE[153] = // cmd #29
+{
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_RECODE[149] = // cmd #28
+static u8 option_allowed_cmd_RECODE[153] = // cmd #30
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_SUBFILE[149] = // cmd #29
+static u8 option_allowed_cmd_SUBFILE[153] = // cmd #31
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 0,1,1,1,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,1,1,1, 1,1,0,1,1,  1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_TESTNORM[149] = // cmd #30
+static u8 option_allowed_cmd_TESTNORM[153] = // cmd #32
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_LIST[149] = // cmd #31
+static u8 option_allowed_cmd_LIST[153] = // cmd #33
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_LIST_L[149] = // cmd #32
+static u8 option_allowed_cmd_LIST_L[153] = // cmd #34
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_LIST_LL[149] = // cmd #33
+static u8 option_allowed_cmd_LIST_LL[153] = // cmd #35
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_LIST_LLL[149] = // cmd #34
+static u8 option_allowed_cmd_LIST_LLL[153] = // cmd #36
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_LIST_A[149] = // cmd #35
+static u8 option_allowed_cmd_LIST_A[153] = // cmd #37
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_LIST_LA[149] = // cmd #36
+static u8 option_allowed_cmd_LIST_LA[153] = // cmd #38
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_NAME_REF[149] = // cmd #37
+static u8 option_allowed_cmd_NAME_REF[153] = // cmd #39
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,1,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0
 };
 
-static u8 option_allowed_cmd_ILIST[149] = // cmd #38
+static u8 option_allowed_cmd_ILIST[153] = // cmd #40
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_ILIST_L[149] = // cmd #39
+static u8 option_allowed_cmd_ILIST_L[153] = // cmd #41
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_ILIST_LL[149] = // cmd #40
+static u8 option_allowed_cmd_ILIST_LL[153] = // cmd #42
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_ILIST_A[149] = // cmd #41
+static u8 option_allowed_cmd_ILIST_A[153] = // cmd #43
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_ILIST_LA[149] = // cmd #42
+static u8 option_allowed_cmd_ILIST_LA[153] = // cmd #44
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_MEMORY[149] = // cmd #43
+static u8 option_allowed_cmd_MEMORY[153] = // cmd #45
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,1,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_MEMORY_A[149] = // cmd #44
+static u8 option_allowed_cmd_MEMORY_A[153] = // cmd #46
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,1,1,1,1,  1,1,1,1,1, 1,1,0,0
+    0,0,0,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_DUMP[149] = // cmd #45
+static u8 option_allowed_cmd_DUMP[153] = // cmd #47
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 0,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,0,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_SHA1[149] = // cmd #46
+static u8 option_allowed_cmd_SHA1[153] = // cmd #48
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,1,1,1,1, 0,1,0,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 1,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,1, 1,0,1,0,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_ANALYZE[149] = // cmd #47
+static u8 option_allowed_cmd_ANALYZE[153] = // cmd #49
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,
-    1,1,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
+    1,1,1,1,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_SPLIT[149] = // cmd #48
+static u8 option_allowed_cmd_SPLIT[153] = // cmd #50
 {
     0,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_IS_TEXTURE[149] = // cmd #49
+static u8 option_allowed_cmd_IS_TEXTURE[153] = // cmd #51
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,1,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_FEATURES[149] = // cmd #50
+static u8 option_allowed_cmd_FEATURES[153] = // cmd #52
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,1,0, 0,0,0,0,0,
-    1,1,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,1, 0,0,0,0,0,
+    0,0,1,1,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_DISTRIBUTION[149] = // cmd #51
+static u8 option_allowed_cmd_DISTRIBUTION[153] = // cmd #53
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,1,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,1,1,0, 0,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,1, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,1,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 1,1,0,0,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_DIFF[149] = // cmd #52
+static u8 option_allowed_cmd_DIFF[153] = // cmd #54
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,0,1,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,  0,0,0,0,0, 1,1,0,0
+    0,0,1,0,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,  0,0,0,0,0, 0,0,0,0,1,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_CHECK[149] = // cmd #53
+static u8 option_allowed_cmd_CHECK[153] = // cmd #55
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,1,0,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,0,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,1,0,0,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_SLOTS[149] = // cmd #54
+static u8 option_allowed_cmd_SLOTS[153] = // cmd #56
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,1,0,0,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_STGI[149] = // cmd #55
+static u8 option_allowed_cmd_STGI[153] = // cmd #57
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_IS_ARENA[149] = // cmd #56
+static u8 option_allowed_cmd_IS_ARENA[153] = // cmd #58
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_NORMALIZE[149] = // cmd #57
+static u8 option_allowed_cmd_NORMALIZE[153] = // cmd #59
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 1,1,1,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,1,1,
-    1,1,1,1,1, 0,0,0,0,0,  0,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  1,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,1,1,1,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    1,1,1,1,1, 1,1,0,0,0,  0,0,0,0,1, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_PATCH[149] = // cmd #58
+static u8 option_allowed_cmd_PATCH[153] = // cmd #60
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,1,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 1,1,1,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,1,1,
-    1,1,1,1,1, 0,0,0,0,0,  1,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,1,1,1,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    1,1,1,1,1, 1,1,0,0,0,  0,0,1,1,1, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_COPY[149] = // cmd #59
+static u8 option_allowed_cmd_COPY[153] = // cmd #61
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,1,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 1,1,1,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,1,1,
-    1,1,1,1,1, 0,0,0,0,0,  1,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,1,1,1,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    1,1,1,1,1, 1,1,0,0,0,  0,0,1,1,1, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_DUPLICATE[149] = // cmd #60
+static u8 option_allowed_cmd_DUPLICATE[153] = // cmd #62
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 1,1,1,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,1,1,
-    1,1,1,1,1, 0,0,0,0,0,  1,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,1,  0,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,1,1,1,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    1,1,1,1,1, 1,1,0,0,0,  0,0,1,1,1, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_MINIMAP[149] = // cmd #61
+static u8 option_allowed_cmd_MINIMAP[153] = // cmd #63
 {
     0,0,0,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,1,0,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  1,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,1,0,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,1, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_COMPRESS[149] = // cmd #62
+static u8 option_allowed_cmd_COMPRESS[153] = // cmd #64
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 1,1,1,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,1,1,
-    1,1,1,1,1, 0,0,0,0,0,  1,1,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  1,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,1,1,1,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    1,1,1,1,1, 1,1,0,0,0,  0,0,1,1,1, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_DECOMPRESS[149] = // cmd #63
+static u8 option_allowed_cmd_DECOMPRESS[153] = // cmd #65
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 1,1,1,1,1,  0,0,1,1,1, 1,1,1,1,0,  0,0,0,1,0, 0,1,1,1,0,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  1,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,1,1,1,  1,1,0,0,1, 1,1,1,1,1,  1,0,0,0,0, 1,0,0,1,1,
+    1,0,1,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,1,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_ENCODE[149] = // cmd #64
+static u8 option_allowed_cmd_ENCODE[153] = // cmd #66
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,0,1, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 0,1,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_CREATE[149] = // cmd #65
+static u8 option_allowed_cmd_CREATE[153] = // cmd #67
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  1,0,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,1,1,1,  1,1,0,1,0, 0,0,0,1,1,  1,1,1,1,1, 0,1,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,1,0,1, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
+    1,1,1,1,1, 1,1,1,1,1,  1,1,1,1,1, 0,1,0,0,0,  0,1,1,1,1, 1,1,1,1,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_UPDATE[149] = // cmd #66
+static u8 option_allowed_cmd_UPDATE[153] = // cmd #68
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,1,1,0,0, 0,0,1,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,1,  1,1,1,0,1, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  1,1,0,0,0, 1,0,0,0,0,  0,0,0,0,0, 0,1,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,1,1,0, 0,0,0,1,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,1,1,1,1, 0,1,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,1,1,1, 0,0,0,1,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,0,0
 };
 
-static u8 option_allowed_cmd_EXTRACT[149] = // cmd #67
+static u8 option_allowed_cmd_EXTRACT[153] = // cmd #69
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,  0,0,0,0,0, 1,1,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,1,1, 1,1,1,1,1,  0,0,0,1,1, 1,1,1,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,1,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  1,0,0,0,0, 0,1,1,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,0,0, 0,1,1,1,1,
+    1,1,0
 };
 
-static u8 option_allowed_cmd_XDECODE[149] = // cmd #68
+static u8 option_allowed_cmd_XDECODE[153] = // cmd #70
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,  0,0,0,0,0, 1,1,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,1,1, 1,1,1,1,1,  0,0,0,1,1, 1,1,1,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,1,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  1,0,0,0,0, 0,1,1,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,0,0, 0,1,1,1,1,
+    1,1,0
 };
 
-static u8 option_allowed_cmd_XEXPORT[149] = // cmd #69
+static u8 option_allowed_cmd_XEXPORT[153] = // cmd #71
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,  0,0,0,0,0, 1,1,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,1,1, 1,1,1,1,1,  0,0,0,1,1, 1,1,1,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,1,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  1,0,0,0,0, 0,1,1,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,0,0, 0,1,1,1,1,
+    1,1,0
 };
 
-static u8 option_allowed_cmd_XALL[149] = // cmd #70
+static u8 option_allowed_cmd_XALL[153] = // cmd #72
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,1,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,  0,0,0,0,0, 1,1,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,1,1, 1,1,1,1,1,  0,0,0,1,1, 1,1,1,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,1,1, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  1,0,0,0,0, 0,1,1,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,0,0, 0,1,1,1,1,
+    1,1,0
 };
 
-static u8 option_allowed_cmd_XCOMMON[149] = // cmd #71
+static u8 option_allowed_cmd_XCOMMON[153] = // cmd #73
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_BINARY[149] = // cmd #72
+static u8 option_allowed_cmd_BINARY[153] = // cmd #74
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_TEXT[149] = // cmd #73
+static u8 option_allowed_cmd_TEXT[153] = // cmd #75
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,
-    1,0,1,1,0, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
+    1,1,0,1,1, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_CAT[149] = // cmd #74
+static u8 option_allowed_cmd_CAT[153] = // cmd #76
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,
-    1,0,1,1,0, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
+    1,1,0,1,1, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_BMG[149] = // cmd #75
+static u8 option_allowed_cmd_BMG[153] = // cmd #77
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,
-    1,0,0,0,0, 1,1,1,1,1,  1,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
+    1,1,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_KCL[149] = // cmd #76
+static u8 option_allowed_cmd_KCL[153] = // cmd #78
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_KMP[149] = // cmd #77
+static u8 option_allowed_cmd_KMP[153] = // cmd #79
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,1,1,1,1,  1,1,1,1,1, 1,1,1,1,1,
-    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 1,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    1,1,1,1,1, 1,1,0,1,0,  0,1,1,1,1, 1,1,1,1,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  1,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_LEX[149] = // cmd #78
+static u8 option_allowed_cmd_LEX[153] = // cmd #80
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,1,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,1,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_INFO[149] = // cmd #79
+static u8 option_allowed_cmd_INFO[153] = // cmd #81
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_GHOST[149] = // cmd #80
+static u8 option_allowed_cmd_GHOST[153] = // cmd #82
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,0,0,0, 0,0,0,0,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,0, 0,0,0,0,0,  0,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1
 };
 
-static u8 option_allowed_cmd_YAZDUMP[149] = // cmd #81
+static u8 option_allowed_cmd_YAZDUMP[153] = // cmd #83
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
-    1,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    1,1,1,1,1, 0,1,1,1,1,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,1,1,1, 1,1,0,1,1,  1,1,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
-static u8 option_allowed_cmd_VEHICLE[149] = // cmd #82
+static u8 option_allowed_cmd_VEHICLE[153] = // cmd #84
 {
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,1,
     0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,1,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,1,0,0,
-    1,1,0,1,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
-    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0
+    0,0,1,1,0, 1,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,
+    0,0,0
 };
 
 
@@ -4089,6 +4304,7 @@ static const InfoOption_t * option_tab_tool[] =
 	OptionInfo + OPT_WIM0,
 	OptionInfo + OPT_LOAD_KCL,
 	OptionInfo + OPT_KCL,
+	OptionInfo + OPT_KCL_THREADS,
 	OptionInfo + OPT_TRI_AREA,
 	OptionInfo + OPT_TRI_HEIGHT,
 	OptionInfo + OPT_KMP,
@@ -4097,6 +4313,10 @@ static const InfoOption_t * option_tab_tool[] =
 	OptionInfo + OPT_TFORM_KMP,
 	OptionInfo + OPT_MDL,
 	OptionInfo + OPT_PAT,
+	OptionInfo + OPT_CMPR_THREADS,
+	OptionInfo + OPT_CMPR_FIT,
+	OptionInfo + OPT_PAL_QUANT,
+	OptionInfo + OPT_PAL_THREADS,
 	OptionInfo + OPT_PATCH_FILES,
 	OptionInfo + OPT_KMG_LIMIT,
 	OptionInfo + OPT_KMG_COPY,
@@ -4404,6 +4624,23 @@ static const InfoOption_t * option_tab_cmd_SCANCACHE[] =
 	0
 };
 
+static const InfoOption_t * option_tab_cmd_COMPACTCACHE[] =
+{
+	OptionInfo + OPT_CACHE,
+	OptionInfo + OPT_LOG_CACHE,
+
+	0
+};
+
+static const InfoOption_t * option_tab_cmd_SERVER[] =
+{
+	OptionInfo + OPT_CACHE,
+	OptionInfo + OPT_LOG_CACHE,
+	OptionInfo + OPT_LOAD_KCL,
+
+	0
+};
+
 static const InfoOption_t * option_tab_cmd_EXPORT[] =
 {
 
@@ -4532,6 +4769,7 @@ static const InfoOption_t * option_tab_cmd_LIST[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -4612,6 +4850,7 @@ static const InfoOption_t * option_tab_cmd_LIST_L[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -4692,6 +4931,7 @@ static const InfoOption_t * option_tab_cmd_LIST_LL[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -4772,6 +5012,7 @@ static const InfoOption_t * option_tab_cmd_LIST_LLL[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -4852,6 +5093,7 @@ static const InfoOption_t * option_tab_cmd_LIST_A[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -4932,6 +5174,7 @@ static const InfoOption_t * option_tab_cmd_LIST_LA[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -5019,6 +5262,7 @@ static const InfoOption_t * option_tab_cmd_ILIST[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 
@@ -5096,6 +5340,7 @@ static const InfoOption_t * option_tab_cmd_ILIST_L[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 
@@ -5173,6 +5418,7 @@ static const InfoOption_t * option_tab_cmd_ILIST_LL[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 
@@ -5250,6 +5496,7 @@ static const InfoOption_t * option_tab_cmd_ILIST_A[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 
@@ -5327,6 +5574,7 @@ static const InfoOption_t * option_tab_cmd_ILIST_LA[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 
@@ -5408,6 +5656,7 @@ static const InfoOption_t * option_tab_cmd_MEMORY[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -5490,6 +5739,7 @@ static const InfoOption_t * option_tab_cmd_MEMORY_A[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_SLOT,
@@ -5564,6 +5814,7 @@ static const InfoOption_t * option_tab_cmd_DUMP[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NORM,
 
@@ -5639,6 +5890,7 @@ static const InfoOption_t * option_tab_cmd_SHA1[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_ID,
 	OptionInfo + OPT_BASE64,
@@ -5678,6 +5930,7 @@ static const InfoOption_t * option_tab_cmd_ANALYZE[] =
 	OptionInfo + OPT_NONE, // separator
 
 	OptionInfo + OPT_ID_LIST,
+	OptionInfo + OPT_ID_LIST_INDEX,
 	OptionInfo + OPT_REFERENCE,
 	OptionInfo + OPT_DEST,
 	OptionInfo + OPT_DEST2,
@@ -5837,6 +6090,7 @@ static const InfoOption_t * option_tab_cmd_DISTRIBUTION[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_BASE64,
 	OptionInfo + OPT_DB64,
@@ -5930,6 +6184,7 @@ static const InfoOption_t * option_tab_cmd_CHECK[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 
 	OptionInfo + OPT_NONE, // separator
@@ -6058,6 +6313,7 @@ static const InfoOption_t * option_tab_cmd_SLOTS[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 
 	OptionInfo + OPT_NONE, // separator
@@ -6155,6 +6411,7 @@ static const InfoOption_t * option_tab_cmd_NORMALIZE[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -6269,6 +6526,7 @@ static const InfoOption_t * option_tab_cmd_PATCH[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -6308,6 +6566,7 @@ static const InfoOption_t * option_tab_cmd_PATCH[] =
 	OptionInfo + OPT_NONE, // separator
 
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_LINKS,
 	OptionInfo + OPT_ALIGN_U8,
@@ -6385,6 +6644,7 @@ static const InfoOption_t * option_tab_cmd_COPY[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -6424,6 +6684,7 @@ static const InfoOption_t * option_tab_cmd_COPY[] =
 	OptionInfo + OPT_NONE, // separator
 
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_LINKS,
 	OptionInfo + OPT_ALIGN_U8,
@@ -6502,6 +6763,7 @@ static const InfoOption_t * option_tab_cmd_DUPLICATE[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -6541,6 +6803,7 @@ static const InfoOption_t * option_tab_cmd_DUPLICATE[] =
 	OptionInfo + OPT_NONE, // separator
 
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_LINKS,
 	OptionInfo + OPT_ALIGN_U8,
@@ -6625,6 +6888,7 @@ static const InfoOption_t * option_tab_cmd_MINIMAP[] =
 	OptionInfo + OPT_REMOVE_DEST,
 	OptionInfo + OPT_PRESERVE,
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_LINKS,
 	OptionInfo + OPT_ALIGN_U8,
@@ -6679,6 +6943,7 @@ static const InfoOption_t * option_tab_cmd_COMPRESS[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -6717,6 +6982,7 @@ static const InfoOption_t * option_tab_cmd_COMPRESS[] =
 	OptionInfo + OPT_NONE, // separator
 
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_NORM,
 	OptionInfo + OPT_LINKS,
 	OptionInfo + OPT_ALIGN_U8,
@@ -6794,6 +7060,7 @@ static const InfoOption_t * option_tab_cmd_DECOMPRESS[] =
 	OptionInfo + OPT_NO_WILDCARDS,
 	OptionInfo + OPT_IN_ORDER,
 	OptionInfo + OPT_IGNORE,
+	OptionInfo + OPT_THREADS,
 
 	OptionInfo + OPT_NONE, // separator
 
@@ -6925,6 +7192,7 @@ static const InfoOption_t * option_tab_cmd_ENCODE[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 
 	OptionInfo + OPT_NONE, // separator
@@ -7063,9 +7331,11 @@ static const InfoOption_t * option_tab_cmd_CREATE[] =
 	OptionInfo + OPT_MAX_MIPMAPS,
 	OptionInfo + OPT_MIPMAP_SIZE,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_NO_COMPRESS,
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_FAST,
 
 	OptionInfo + OPT_NONE, // separator
@@ -7151,6 +7421,7 @@ static const InfoOption_t * option_tab_cmd_UPDATE[] =
 
 	OptionInfo + OPT_NO_COMPRESS,
 	OptionInfo + OPT_COMPRESS,
+	OptionInfo + OPT_COMPR_THREADS,
 	OptionInfo + OPT_FAST,
 	OptionInfo + OPT_RECURSE,
 	OptionInfo + OPT_ALL,
@@ -7251,6 +7522,7 @@ static const InfoOption_t * option_tab_cmd_EXTRACT[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_CUT,
 	OptionInfo + OPT_ALL,
@@ -7348,6 +7620,7 @@ static const InfoOption_t * option_tab_cmd_XDECODE[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_CUT,
 	OptionInfo + OPT_ALL,
@@ -7445,6 +7718,7 @@ static const InfoOption_t * option_tab_cmd_XEXPORT[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_CUT,
 	OptionInfo + OPT_ALL,
@@ -7542,6 +7816,7 @@ static const InfoOption_t * option_tab_cmd_XALL[] =
 	OptionInfo + OPT_MIPMAPS,
 	OptionInfo + OPT_NO_MIPMAPS,
 	OptionInfo + OPT_FAST_MIPMAPS,
+	OptionInfo + OPT_MIPMAP_FILTER,
 	OptionInfo + OPT_CMPR_DEFAULT,
 	OptionInfo + OPT_CUT,
 	OptionInfo + OPT_ALL,
@@ -8026,7 +8301,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" SZS, U8, PACK, BRRES, BREFF and BREFT archives. Additonally, RARC"
 	" archive can be extracted. It is also a wrapper to all other tools.",
 	0,
-	85,
+	90,
 	option_tab_tool,
 	0
     },
@@ -8447,15 +8722,62 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"wszst SCANCACHE directory\n"
 	"wszst SCANCACHE --cache directory",
 	"Scan the cache directory for SZS files and re-build the checksum"
-	" table. Store the result as file 'cache-content.txt' in the same"
-	" directory. The file is used by option --cache to optimize file"
-	" access.",
+	" table. Store the result as binary index 'cache-content.idx' in the"
+	" same directory. Files with unchanged size and modification time are"
+	" not loaded again, their checksums are taken from the old index. The"
+	" index is used by option --cache to optimize file access."
+	" Additionally, the table is exported as text file"
+	" 'cache-content.txt'. It is only read, if no index exists.",
 	0,
 	4,
 	option_tab_cmd_SCANCACHE,
 	option_allowed_cmd_SCANCACHE
     },
 
+    {	CMD_COMPACTCACHE,
+	false,
+	false,
+	false,
+	"COMPACTCACHE",
+	0,
+	"wszst COMPACTCACHE directory\n"
+	"wszst COMPACTCACHE --cache directory",
+	"Merge the journal of the cache index 'cache-content.idx' into the"
+	" sorted table and rewrite the index. Other processes may read the"
+	" cache at the same time. Writers are blocked only while the new index"
+	" is written.",
+	0,
+	2,
+	option_tab_cmd_COMPACTCACHE,
+	option_allowed_cmd_COMPACTCACHE
+    },
+
+    {	CMD_SERVER,
+	false,
+	false,
+	false,
+	"SERVER",
+	0,
+	"wszst SERVER socket_file",
+	"Start a server, that listens on the UNIX socket 'socket_file' and"
+	" executes tool commands sent by 'wszst CLIENT'. The socket is created"
+	" with mode 0600, so only the owner of the server can send requests."
+	" The SZS cache (option --cache), the reference KCL (option"
+	" --load-kcl) and the internal tables are loaded only once at startup."
+	" Each request is executed by a forked process in the current"
+	" directory of the client. Options of the server are the defaults for"
+	" all requests. A request with another --cache or --load-kcl loads its"
+	" own data. Use 'wszst CLIENT socket_file tool arg...' to send a"
+	" request, for example 'wszst CLIENT socket_file wszst sha1"
+	" track.szs'. The client prints the output of the tool and exits with"
+	" its exit status. Standard input is not forwarded. Stop the server by"
+	" signal INT or TERM.",
+	0,
+	3,
+	option_tab_cmd_SERVER,
+	option_allowed_cmd_SERVER
+    },
+
     {	CMD_EXPORT,
 	true,
 	false,
@@ -8560,7 +8882,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" characters are parsed, see https://szs.wiimm.de/doc/wildcards for"
 	" details.",
 	0,
-	62,
+	63,
 	option_tab_cmd_LIST,
 	option_allowed_cmd_LIST
     },
@@ -8576,7 +8898,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" 'LIST --long'. Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	62,
+	63,
 	option_tab_cmd_LIST_L,
 	option_allowed_cmd_LIST_L
     },
@@ -8592,7 +8914,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" short cuts for 'LIST --long --long'. Wildcards and pipe characters"
 	" are parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	62,
+	63,
 	option_tab_cmd_LIST_LL,
 	option_allowed_cmd_LIST_LL
     },
@@ -8609,7 +8931,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	62,
+	63,
 	option_tab_cmd_LIST_LLL,
 	option_allowed_cmd_LIST_LLL
     },
@@ -8625,7 +8947,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" cuts for 'LIST --long --all --all'. Wildcards and pipe characters"
 	" are parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	62,
+	63,
 	option_tab_cmd_LIST_A,
 	option_allowed_cmd_LIST_A
     },
@@ -8642,7 +8964,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	62,
+	63,
 	option_tab_cmd_LIST_LA,
 	option_allowed_cmd_LIST_LA
     },
@@ -8678,7 +9000,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" does it) and listed. Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	59,
+	60,
 	option_tab_cmd_ILIST,
 	option_allowed_cmd_ILIST
     },
@@ -8693,7 +9015,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"List all image files with geometry data. 'ILIST-L' and 'ILL' are"
 	" short cuts for 'ILIST --long'.",
 	0,
-	59,
+	60,
 	option_tab_cmd_ILIST_L,
 	option_allowed_cmd_ILIST_L
     },
@@ -8708,7 +9030,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"List all sub files with advanced geometry data. 'ILIST-LL' and 'ILLL'"
 	" are short cuts for 'ILIST --long --long'.",
 	0,
-	59,
+	60,
 	option_tab_cmd_ILIST_LL,
 	option_allowed_cmd_ILIST_LL
     },
@@ -8723,7 +9045,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"List recursive all image files. 'ILIST-A' and 'ILA' are short cuts"
 	" for 'ILIST --all'.",
 	0,
-	59,
+	60,
 	option_tab_cmd_ILIST_A,
 	option_allowed_cmd_ILIST_A
     },
@@ -8738,7 +9060,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"List recursive all image files with geometry data. 'ILIST-LA' and"
 	" 'ILLA' are short cuts for 'ILIST --long --all'.",
 	0,
-	59,
+	60,
 	option_tab_cmd_ILIST_LA,
 	option_allowed_cmd_ILIST_LA
     },
@@ -8754,7 +9076,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" directories) are also supported. Wildcards and pipe characters are"
 	" parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	61,
+	62,
 	option_tab_cmd_MEMORY,
 	option_allowed_cmd_MEMORY
     },
@@ -8769,7 +9091,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	"Dump recursive a memory map of each source file. 'MEMORY-A' and"
 	" 'MEMA' are short cuts for 'MEMORY --all --all'.",
 	0,
-	61,
+	62,
 	option_tab_cmd_MEMORY_A,
 	option_allowed_cmd_MEMORY_A
     },
@@ -8787,7 +9109,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" supported. Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	55,
+	56,
 	option_tab_cmd_DUMP,
 	option_allowed_cmd_DUMP
     },
@@ -8804,7 +9126,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" characters are parsed, see https://szs.wiimm.de/doc/wildcards for"
 	" details.",
 	0,
-	63,
+	64,
 	option_tab_cmd_SHA1,
 	option_allowed_cmd_SHA1
     },
@@ -8821,7 +9143,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	19,
+	20,
 	option_tab_cmd_ANALYZE,
 	option_allowed_cmd_ANALYZE
     },
@@ -8906,7 +9228,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" See »welect DISTRIBUTION« for a new and alternative implementation"
 	" of this.",
 	0,
-	59,
+	60,
 	option_tab_cmd_DISTRIBUTION,
 	option_allowed_cmd_DISTRIBUTION
     },
@@ -8943,7 +9265,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" or WBZ file, or an U8 like directory. Wildcards and pipe characters"
 	" are parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	111,
+	112,
 	option_tab_cmd_CHECK,
 	option_allowed_cmd_CHECK
     },
@@ -8962,7 +9284,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" arenas, the keyword ARENA is printed. Wildcards and pipe characters"
 	" are parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	107,
+	108,
 	option_tab_cmd_SLOTS,
 	option_allowed_cmd_SLOTS
     },
@@ -9024,7 +9346,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" https://szs.wiimm.de/doc/wildcards for details.\n"
 	"  'wszst NORMALIZE' is the same as 'wszst PATCH --norm'.",
 	0,
-	93,
+	94,
 	option_tab_cmd_NORMALIZE,
 	option_allowed_cmd_NORMALIZE
     },
@@ -9043,7 +9365,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	95,
+	97,
 	option_tab_cmd_PATCH,
 	option_allowed_cmd_PATCH
     },
@@ -9067,7 +9389,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" https://szs.wiimm.de/doc/wildcards for details. Patching is also"
 	" possible and option --overwrite is set implicitly.",
 	0,
-	95,
+	97,
 	option_tab_cmd_COPY,
 	option_allowed_cmd_COPY
     },
@@ -9092,7 +9414,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" Use command 'wkmpt GAMEMODES' to list all variants and to check them"
 	" beforehand.",
 	0,
-	96,
+	98,
 	option_tab_cmd_DUPLICATE,
 	option_allowed_cmd_DUPLICATE
     },
@@ -9111,7 +9433,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" matrices are calculated. Wildcards and pipe characters are parsed,"
 	" see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	49,
+	50,
 	option_tab_cmd_MINIMAP,
 	option_allowed_cmd_MINIMAP
     },
@@ -9128,7 +9450,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" destination is '%P/%N.szs'. Wildcards and pipe characters are"
 	" parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	94,
+	96,
 	option_tab_cmd_COMPRESS,
 	option_allowed_cmd_COMPRESS
     },
@@ -9144,7 +9466,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	78,
+	79,
 	option_tab_cmd_DECOMPRESS,
 	option_allowed_cmd_DECOMPRESS
     },
@@ -9161,7 +9483,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	82,
+	83,
 	option_tab_cmd_ENCODE,
 	option_allowed_cmd_ENCODE
     },
@@ -9179,7 +9501,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	117,
+	119,
 	option_tab_cmd_CREATE,
 	option_allowed_cmd_CREATE
     },
@@ -9199,7 +9521,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" secondary source is '%P/%N.d/'. Wildcards and pipe characters are"
 	" parsed, see https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	77,
+	78,
 	option_tab_cmd_UPDATE,
 	option_allowed_cmd_UPDATE
     },
@@ -9216,7 +9538,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" pipe characters are parsed, see https://szs.wiimm.de/doc/wildcards"
 	" for details.",
 	0,
-	82,
+	83,
 	option_tab_cmd_EXTRACT,
 	option_allowed_cmd_EXTRACT
     },
@@ -9234,7 +9556,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" '%P/%N.d/'. Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	82,
+	83,
 	option_tab_cmd_XDECODE,
 	option_allowed_cmd_XDECODE
     },
@@ -9253,7 +9575,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" characters are parsed, see https://szs.wiimm.de/doc/wildcards for"
 	" details.",
 	0,
-	82,
+	83,
 	option_tab_cmd_XEXPORT,
 	option_allowed_cmd_XEXPORT
     },
@@ -9271,7 +9593,7 @@ static const InfoCommand_t CommandInfo[CMD__N+1] =
 	" is '%P/%N.d/'. Wildcards and pipe characters are parsed, see"
 	" https://szs.wiimm.de/doc/wildcards for details.",
 	0,
-	82,
+	83,
 	option_tab_cmd_XALL,
 	option_allowed_cmd_XALL
     },
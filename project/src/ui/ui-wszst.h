@@ -105,6 +105,7 @@ typedef enum enumOptions
 	OPT_TITLE_SCREEN,
 	OPT_CUP_ICONS,
 	OPT_NO_COPY,
+	OPT_THREADS,
 	OPT_ID,
 	OPT_BASE64,
 	OPT_DB64,
@@ -144,6 +145,7 @@ typedef enum enumOptions
 	OPT_ANALYZE_MODE,
 	OPT_SOURCE,
 	OPT_ID_LIST,
+	OPT_ID_LIST_INDEX,
 	OPT_REFERENCE,
 	OPT_DEST,
 	OPT_DEST2,
@@ -186,6 +188,7 @@ typedef enum enumOptions
 	OPT_BREFT,
 	OPT_NO_COMPRESS,
 	OPT_COMPRESS,
+	OPT_COMPR_THREADS,
 	OPT_FAST,
 	OPT_NORM,
 	OPT_LINKS,
@@ -199,13 +202,14 @@ typedef enum enumOptions
 	OPT_MAX_MIPMAPS,
 	OPT_MIPMAP_SIZE,
 	OPT_FAST_MIPMAPS,
+	OPT_MIPMAP_FILTER,
 	OPT_CMPR_DEFAULT,
 	OPT_CUT,
 	OPT_ALL,
 	OPT_RAW,
 	OPT_SECTIONS,
 
-	OPT__N_SPECIFIC, // == 149
+	OPT__N_SPECIFIC, // == 153
 
 	//----- global options -----
 
@@ -242,6 +246,7 @@ typedef enum enumOptions
 	OPT_WIM0,
 	OPT_LOAD_KCL,
 	OPT_KCL,
+	OPT_KCL_THREADS,
 	OPT_TRI_AREA,
 	OPT_TRI_HEIGHT,
 	OPT_XTRIDATA,
@@ -252,6 +257,10 @@ typedef enum enumOptions
 	OPT_TFORM_KMP,
 	OPT_MDL,
 	OPT_PAT,
+	OPT_CMPR_THREADS,
+	OPT_CMPR_FIT,
+	OPT_PAL_QUANT,
+	OPT_PAL_THREADS,
 	OPT_PATCH_FILES,
 	OPT_KMG_LIMIT,
 	OPT_KMG_COPY,
@@ -304,7 +313,7 @@ typedef enum enumOptions
 	OPT_NEW,
 	OPT_EXTRACT,
 
-	OPT__N_TOTAL // == 243
+	OPT__N_TOTAL // == 252
 
 } enumOptions;
 
@@ -368,6 +377,7 @@ typedef enum enumOptions
 //	OB_TITLE_SCREEN		= 1llu << OPT_TITLE_SCREEN,
 //	OB_CUP_ICONS		= 1llu << OPT_CUP_ICONS,
 //	OB_NO_COPY		= 1llu << OPT_NO_COPY,
+//	OB_THREADS		= 1llu << OPT_THREADS,
 //	OB_ID			= 1llu << OPT_ID,
 //	OB_BASE64		= 1llu << OPT_BASE64,
 //	OB_DB64			= 1llu << OPT_DB64,
@@ -407,6 +417,7 @@ typedef enum enumOptions
 //	OB_ANALYZE_MODE		= 1llu << OPT_ANALYZE_MODE,
 //	OB_SOURCE		= 1llu << OPT_SOURCE,
 //	OB_ID_LIST		= 1llu << OPT_ID_LIST,
+//	OB_ID_LIST_INDEX	= 1llu << OPT_ID_LIST_INDEX,
 //	OB_REFERENCE		= 1llu << OPT_REFERENCE,
 //	OB_DEST			= 1llu << OPT_DEST,
 //	OB_DEST2		= 1llu << OPT_DEST2,
@@ -449,6 +460,7 @@ typedef enum enumOptions
 //	OB_BREFT		= 1llu << OPT_BREFT,
 //	OB_NO_COMPRESS		= 1llu << OPT_NO_COMPRESS,
 //	OB_COMPRESS		= 1llu << OPT_COMPRESS,
+//	OB_COMPR_THREADS	= 1llu << OPT_COMPR_THREADS,
 //	OB_FAST			= 1llu << OPT_FAST,
 //	OB_NORM			= 1llu << OPT_NORM,
 //	OB_LINKS		= 1llu << OPT_LINKS,
@@ -462,6 +474,7 @@ typedef enum enumOptions
 //	OB_MAX_MIPMAPS		= 1llu << OPT_MAX_MIPMAPS,
 //	OB_MIPMAP_SIZE		= 1llu << OPT_MIPMAP_SIZE,
 //	OB_FAST_MIPMAPS		= 1llu << OPT_FAST_MIPMAPS,
+//	OB_MIPMAP_FILTER	= 1llu << OPT_MIPMAP_FILTER,
 //	OB_CMPR_DEFAULT		= 1llu << OPT_CMPR_DEFAULT,
 //	OB_CUT			= 1llu << OPT_CUT,
 //	OB_ALL			= 1llu << OPT_ALL,
@@ -592,6 +605,7 @@ typedef enum enumOptions
 //				| OB_MAX_MIPMAPS
 //				| OB_MIPMAP_SIZE
 //				| OB_FAST_MIPMAPS
+//				| OB_MIPMAP_FILTER
 //				| OB_CMPR_DEFAULT,
 //
 //	OB_GRP_NORM		= OB_NORM
@@ -609,6 +623,7 @@ typedef enum enumOptions
 //				| OB_MIPMAPS
 //				| OB_NO_MIPMAPS
 //				| OB_FAST_MIPMAPS
+//				| OB_MIPMAP_FILTER
 //				| OB_CMPR_DEFAULT
 //				| OB_CUT
 //				| OB_ALL
@@ -703,6 +718,10 @@ typedef enum enumOptions
 //	OB_CMD_SCANCACHE	= OB_PURGE
 //				| OB_FAST,
 //
+//	OB_CMD_COMPACTCACHE	= 0,
+//
+//	OB_CMD_SERVER		= 0,
+//
 //	OB_CMD_EXPORT		= 0,
 //
 //	OB_CMD_SIZEOF		= OB_SORT
@@ -812,6 +831,7 @@ typedef enum enumOptions
 //				| OB_LONG
 //				| OB_GRP_SCRIPT
 //				| OB_ID_LIST
+//				| OB_ID_LIST_INDEX
 //				| OB_REFERENCE
 //				| OB_DEST
 //				| OB_DEST2,
@@ -889,6 +909,7 @@ typedef enum enumOptions
 //	OB_CMD_NORMALIZE	= OB_NO_WILDCARDS
 //				| OB_IN_ORDER
 //				| OB_IGNORE
+//				| OB_THREADS
 //				| OB_GRP_DEST
 //				| OB_REMOVE_SRC
 //				| OB_GRP_FFORMAT1
@@ -899,11 +920,13 @@ typedef enum enumOptions
 //	OB_CMD_PATCH		= OB_NO_WILDCARDS
 //				| OB_IN_ORDER
 //				| OB_IGNORE
+//				| OB_THREADS
 //				| OB_GRP_DEST
 //				| OB_REMOVE_SRC
 //				| OB_NO_COPY
 //				| OB_GRP_FFORMAT1
 //				| OB_COMPRESS
+//				| OB_COMPR_THREADS
 //				| OB_GRP_NORM
 //				| OB_FAST
 //				| OB_GRP_TRANSFORM2,
@@ -920,6 +943,7 @@ typedef enum enumOptions
 //				| OB_REMOVE_DEST
 //				| OB_PRESERVE
 //				| OB_COMPRESS
+//				| OB_COMPR_THREADS
 //				| OB_GRP_NORM
 //				| OB_FAST
 //				| OB_TOUCH
@@ -939,10 +963,12 @@ typedef enum enumOptions
 //	OB_CMD_COMPRESS		= OB_NO_WILDCARDS
 //				| OB_IN_ORDER
 //				| OB_IGNORE
+//				| OB_THREADS
 //				| OB_GRP_DEST
 //				| OB_REMOVE_SRC
 //				| OB_GRP_FFORMAT1
 //				| OB_COMPRESS
+//				| OB_COMPR_THREADS
 //				| OB_GRP_NORM
 //				| OB_FAST
 //				| OB_GRP_TRANSFORM2,
@@ -950,6 +976,7 @@ typedef enum enumOptions
 //	OB_CMD_DECOMPRESS	= OB_NO_WILDCARDS
 //				| OB_IN_ORDER
 //				| OB_IGNORE
+//				| OB_THREADS
 //				| OB_GRP_DEST
 //				| OB_REMOVE_SRC
 //				| OB_U8
@@ -969,6 +996,7 @@ typedef enum enumOptions
 //				| OB_MAX_MIPMAPS
 //				| OB_MIPMAP_SIZE
 //				| OB_FAST_MIPMAPS
+//				| OB_MIPMAP_FILTER
 //				| OB_CMPR_DEFAULT
 //				| OB_GRP_TRANSFORM2,
 //
@@ -979,6 +1007,7 @@ typedef enum enumOptions
 //				| OB_GRP_CREATE
 //				| OB_NO_COMPRESS
 //				| OB_COMPRESS
+//				| OB_COMPR_THREADS
 //				| OB_FAST
 //				| OB_GRP_TRANSFORM2,
 //
@@ -990,6 +1019,7 @@ typedef enum enumOptions
 //				| OB_ESC
 //				| OB_NO_COMPRESS
 //				| OB_COMPRESS
+//				| OB_COMPR_THREADS
 //				| OB_FAST
 //				| OB_RECURSE
 //				| OB_ALL
@@ -1128,6 +1158,8 @@ typedef enum enumCommands
 	CMD_AUTOADD,
 	CMD_TRACKS,
 	CMD_SCANCACHE,
+	CMD_COMPACTCACHE,
+	CMD_SERVER,
 	CMD_EXPORT,
 	CMD_SIZEOF,
 	CMD_CODE,
@@ -1195,7 +1227,7 @@ typedef enum enumCommands
 
 	CMD_VEHICLE,
 
-	CMD__N // == 83
+	CMD__N // == 85
 
 } enumCommands;
 
@@ -1305,6 +1337,7 @@ typedef enum enumGetOpt
 	GO_SLOT,
 	GO_LOAD_KCL,
 	GO_KCL,
+	GO_KCL_THREADS,
 	GO_KCL_FLAG,
 	GO_KCL_SCRIPT,
 	GO_TRI_AREA,
@@ -1320,6 +1353,10 @@ typedef enum enumGetOpt
 	GO_GAMEMODES,
 	GO_MDL,
 	GO_PAT,
+	GO_CMPR_THREADS,
+	GO_CMPR_FIT,
+	GO_PAL_QUANT,
+	GO_PAL_THREADS,
 	GO_PATCH_FILES,
 	GO_KMG_LIMIT,
 	GO_KMG_COPY,
@@ -1347,6 +1384,7 @@ typedef enum enumGetOpt
 	GO_CNAME,
 	GO_LOG_CACHE,
 	GO_PARALLEL,
+	GO_THREADS,
 	GO_ID,
 	GO_BASE64,
 	GO_DB64,
@@ -1407,6 +1445,7 @@ typedef enum enumGetOpt
 	GO_NEW,
 	GO_EXTRACT,
 	GO_ID_LIST,
+	GO_ID_LIST_INDEX,
 	GO_REFERENCE,
 	GO_NUMBER,
 	GO_REMOVE_SRC,
@@ -1439,6 +1478,7 @@ typedef enum enumGetOpt
 	GO_BREFF,
 	GO_BREFT,
 	GO_NO_COMPRESS,
+	GO_COMPR_THREADS,
 	GO_FAST,
 	GO_LINKS,
 	GO_BASEDIR,
@@ -1449,6 +1489,7 @@ typedef enum enumGetOpt
 	GO_MAX_MIPMAPS,
 	GO_MIPMAP_SIZE,
 	GO_FAST_MIPMAPS,
+	GO_MIPMAP_FILTER,
 	GO_CMPR_DEFAULT,
 	GO_CUT,
 	GO_RAW,
@@ -1467,7 +1508,7 @@ typedef enum enumGetOpt
 //extern const struct option OptionLong[];
 //extern u8 OptionUsed[OPT__N_TOTAL+1];
 //extern const OptionIndex_t OptionIndex[UIOPT_INDEX_SIZE];
-//UIOPT_INDEX_SIZE := 0x154 = 340
+//UIOPT_INDEX_SIZE := 0x168 = 360
 //extern const InfoCommand_t CommandInfo[CMD__N+1];
 extern const InfoUI_t InfoUI_wszst;
 
@@ -195,6 +195,7 @@ static enumError cmd_test_options()
     printf("  mipmap-size: %16x = %12d\n",opt_min_mipmap_size,opt_min_mipmap_size);
     printf("  mipmaps:     %16x = %12d\n",opt_mipmaps,opt_mipmaps);
     printf("  fast-mipmaps:%16x = %12d\n",fast_resize_enabled,fast_resize_enabled);
+    printf("  mipmap-filter:%15x = %12d\n",opt_mipmap_filter,opt_mipmap_filter);
 
 #if defined(TEST) || defined(DEBUG) || HAVE_WIIMM_EXT
     MipmapOptions_t mmo;
@@ -311,55 +312,60 @@ static enumError cmd_list ( int long_level )
 ///////////////			command decode			///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static enumError cmd_decode()
+static enumError decode_file_helper
+(
+    ccp		arg,			// file name of source
+    void	*param			// default destination path
+)
 {
-    ccp def_path = "\1P/\1F.png";
-    CheckOptDest(def_path,false);
+    ccp def_path = param;
+    DASSERT(def_path);
 
-    enumError max_err = ERR_OK;
+    Image_t img;
+    enumError max_err = LoadIMG(&img, true, arg,
+				0, opt_mipmaps >= 0, true, opt_ignore>0 );
+    if (max_err)
+	return max_err;
 
-    StringField_t plist = {0};
-    CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
+    char dest[PATH_MAX];
+    SubstDest(dest,sizeof(dest),arg,opt_dest,def_path,0,false);
 
-    for ( int argi = 0; argi < plist.used; argi++ )
-    {
-	ccp arg = plist.field[argi];
+    if ( verbose >= 0 || testmode )
+	fprintf(stdlog,"%s%sDECODE %s:%s -> PNG:%s\n",
+		    verbose > 0 ? "\n" : "",
+		    testmode ? "WOULD " : "",
+		    PrintFormat3(img.info_fform,img.info_iform,img.info_pform),
+		    img.path, dest );
 
-	Image_t img;
-	enumError err = LoadIMG(&img, true, arg,
-				0, opt_mipmaps >= 0, true, opt_ignore>0 );
+    TransformIMG(&img,2);
+    if (opt_pre_convert)
+    {
+	enumError err = ExecTransformIMG(&img);
 	if ( max_err < err )
-	    max_err = err;
-	if (err)
-	    continue;
-
-	char dest[PATH_MAX];
-	SubstDest(dest,sizeof(dest),arg,opt_dest,def_path,0,false);
+	     max_err = err;
+    }
 
-	if ( verbose >= 0 || testmode )
-	    fprintf(stdlog,"%s%sDECODE %s:%s -> PNG:%s\n",
-			verbose > 0 ? "\n" : "",
-			testmode ? "WOULD " : "",
-			PrintFormat3(img.info_fform,img.info_iform,img.info_pform),
-			img.path, dest );
+    if (!testmode)
+    {
+	enumError err = SavePNG(&img,true,0,dest,0,0,false,0);
+	if ( max_err < err )
+	     max_err = err;
+    }
+    ResetIMG(&img);
+    return max_err;
+}
 
-	TransformIMG(&img,2);
-	if (opt_pre_convert)
-	{
-	    enumError err = ExecTransformIMG(&img);
-	    if ( max_err < err )
-	         max_err = err;
-	}
+//-----------------------------------------------------------------------------
 
-	if (!testmode)
-	{
-	    err = SavePNG(&img,true,0,dest,0,0,false,0);
-	    if ( max_err < err )
-	         max_err = err;
-	}
-	ResetIMG(&img);
-    }
+static enumError cmd_decode()
+{
+    static const char def_path[] = "\1P/\1F.png";
+    CheckOptDest(def_path,false);
 
+    StringField_t plist = {0};
+    CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
+    const enumError max_err
+	= ExecParallelJobs(&plist,opt_threads,decode_file_helper,(void*)def_path);
     ResetStringField(&plist);
     return max_err;
 }
@@ -369,86 +375,128 @@ static enumError cmd_decode()
 ///////////////		    command encode/convert		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static enumError cmd_convert ( int cmd_id, ccp cmd_name, ccp def_path )
+typedef struct convert_param_t
 {
-    CheckOptDest(def_path,false);
+    int		cmd_id;			// command id: CMD_ENCODE or CMD_CONVERT
+    ccp		cmd_name;		// command name for the log
+    ccp		def_path;		// default destination path
+}
+convert_param_t;
 
-    StringField_t plist = {0};
-    CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
+//-----------------------------------------------------------------------------
 
-    for ( int argi = 0; argi < plist.used; argi++ )
+static enumError convert_file_helper
+(
+    ccp		arg,			// file name of source
+    void	*param			// pointer to a convert_param_t
+)
+{
+    const convert_param_t *cp = param;
+    DASSERT(cp);
+    const int cmd_id = cp->cmd_id;
+    ccp cmd_name = cp->cmd_name;
+    ccp def_path = cp->def_path;
+
+    Image_t img;
+    enumError err = LoadIMG( &img, true, arg, 0,
+				    opt_mipmaps >= 0, false, opt_ignore );
+    if ( err == ERR_NOT_EXISTS || err == ERR_WARNING )
+	return ERR_OK;
+    if ( err > ERR_WARNING )
+	return err;
+
+    const file_format_t	src_f = img.info_fform;
+    const image_format_t	src_i = img.info_iform;
+    const palette_format_t	src_p = img.info_pform;
+    TransformIMG(&img,-1);
+
+    char dest[PATH_MAX];
+    SubstDest(dest,sizeof(dest),arg,opt_dest,def_path,0,false);
+    const file_format_t fform
+	    = GetImageFF( img.tform_valid ? img.tform_fform : FF_INVALID,
+			    FF_INVALID,
+			    dest,
+			    img.info_fform,
+			    cmd_id == CMD_CONVERT,
+			    FF_TEX );
+
+    if ( fform == FF_PNG )
+	Transform2XIMG(&img);
+    else
+	Transform2InternIMG(&img);
+
+    const bool samefile = !strcmp(arg,dest);
+    if ( !all_count
+	    && !img.conv_count
+	    && !img.tform_exec
+	    && !img.patch_done
+	    && fform == img.info_fform
+	    && samefile )
     {
-	ccp arg = plist.field[argi];
-
-	Image_t img;
-	enumError err = LoadIMG( &img, true, arg, 0,
-					opt_mipmaps >= 0, false, opt_ignore );
-	if ( err == ERR_NOT_EXISTS || err == ERR_WARNING )
-	    continue;
-	if ( err > ERR_WARNING )
-	    return err;
+	ResetIMG(&img);
+	return ERR_OK;
+    }
 
-	const file_format_t	src_f = img.info_fform;
-	const image_format_t	src_i = img.info_iform;
-	const palette_format_t	src_p = img.info_pform;
-	TransformIMG(&img,-1);
+    if ( verbose >= 0 || testmode )
+    {
+	image_format_t   iform = img.tform_valid && img.tform_iform != IMG_INVALID
+				    ? img.tform_iform : img.iform;
+	palette_format_t pform = img.tform_valid && img.tform_pform != PAL_INVALID
+				    ? img.tform_pform : img.pform;
+
+	fprintf(stdlog,"%s%s%s %s:%s -> %s:%s\n",
+		    verbose > 0 ? "\n" : "",
+		    testmode ? "WOULD " : "", cmd_name,
+		    PrintFormat3(src_f,src_i,src_p),
+		    arg,
+		    PrintFormat3(fform,iform,pform),
+		    dest );
+    }
 
-	char dest[PATH_MAX];
-	SubstDest(dest,sizeof(dest),arg,opt_dest,def_path,0,false);
-	const file_format_t fform
-		= GetImageFF( img.tform_valid ? img.tform_fform : FF_INVALID,
-				FF_INVALID,
-				dest,
-				img.info_fform,
-				cmd_id == CMD_CONVERT,
-				FF_TEX );
+    if (opt_pre_convert)
+	TransformIMG(&img,2);
 
-	if ( fform == FF_PNG )
-	    Transform2XIMG(&img);
-	else
-	    Transform2InternIMG(&img);
+    if (!testmode)
+    {
+	err = SaveIMG(&img,fform,0,0,dest,samefile);
+	if ( err > ERR_WARNING )
+	    return err;
+    }
+    ResetIMG(&img);
+    return ERR_OK;
+}
 
-	const bool samefile = !strcmp(arg,dest);
-	if ( !all_count
-		&& !img.conv_count
-		&& !img.tform_exec
-		&& !img.patch_done
-		&& fform == img.info_fform
-		&& samefile )
-	{
-	    continue;
-	}
+//-----------------------------------------------------------------------------
 
-	if ( verbose >= 0 || testmode )
-	{
-	    image_format_t   iform = img.tform_valid && img.tform_iform != IMG_INVALID
-					? img.tform_iform : img.iform;
-	    palette_format_t pform = img.tform_valid && img.tform_pform != PAL_INVALID
-					? img.tform_pform : img.pform;
+static enumError cmd_convert ( int cmd_id, ccp cmd_name, ccp def_path )
+{
+    CheckOptDest(def_path,false);
 
-	    fprintf(stdlog,"%s%s%s %s:%s -> %s:%s\n",
-			verbose > 0 ? "\n" : "",
-			testmode ? "WOULD " : "", cmd_name,
-			PrintFormat3(src_f,src_i,src_p),
-			arg,
-			PrintFormat3(fform,iform,pform),
-			dest );
-	}
+    StringField_t plist = {0};
+    CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
 
-	if (opt_pre_convert)
-	    TransformIMG(&img,2);
+    // Like the sequential loop, stop at the first fatal error: no new jobs
+    // are started after a failed job, and the output of jobs behind the
+    // failed one is discarded. Files already written by them are kept.
+    convert_param_t cp = { cmd_id, cmd_name, def_path };
+    parallel_jobs_t pj;
+    SetupParallelJobs(&pj,&plist,opt_threads,convert_file_helper,&cp,false);
+    pj.stop_on_error = true;
 
-	if (!testmode)
+    enumError err, max_err = ERR_OK;
+    while ( NextParallelJob(&pj,&err,0) >= 0 )
+	if ( err > ERR_WARNING )
 	{
-	    err = SaveIMG(&img,fform,0,0,dest,samefile);
-	    if ( err > ERR_WARNING )
-		return err;
+	    max_err = err;
+	    break;
 	}
-	ResetIMG(&img);
-    }
 
+    if ( max_err > ERR_WARNING )
+	DropParallelJobs(&pj);
+    else
+	ResetParallelJobs(&pj);
     ResetStringField(&plist);
-    return ERR_OK;
+    return max_err;
 }
 
 //
@@ -671,16 +719,22 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_BRIEF:		brief_count++; break;
 	case GO_NO_WILDCARDS:	no_wildcards_count++; break;
 	case GO_IN_ORDER:	inorder_count++; break;
+	case GO_THREADS:	err += ScanOptThreads(optarg); break;
 	case GO_SECTIONS:	print_sections++; break;
 
 	case GO_ALL:		all_count++; break;
 	case GO_CMPR_DEFAULT:	err += ScanOptCmprDefault(optarg); break;
+	case GO_CMPR_THREADS:	err += ScanOptCmprThreads(optarg); break;
+	case GO_CMPR_FIT:	err += ScanOptCmprFit(optarg); break;
+	case GO_PAL_QUANT:	err += ScanOptPalQuant(optarg); break;
+	case GO_PAL_THREADS:	err += ScanOptPalThreads(optarg); break;
 	case GO_N_MIPMAPS:	err += ScanOptNMipmaps(optarg); break;
 	case GO_MAX_MIPMAPS:	err += ScanOptMaxMipmaps(optarg); break;
 	case GO_MIPMAP_SIZE:	err += ScanOptMipmapSize(optarg); break;
 	case GO_MIPMAPS:	opt_mipmaps = +1; break;
 	case GO_NO_MIPMAPS:	opt_mipmaps = -1; break;
 	case GO_FAST_MIPMAPS:	fast_resize_enabled = true; break;
+	case GO_MIPMAP_FILTER:	err += ScanOptMipmapFilter(optarg); break;
 	case GO_PRE_CONVERT:	opt_pre_convert = true; break;
 	case GO_PATCH:		err += ScanOptPatchImage(optarg); break;
 	case GO_TRANSFORM:	err += ScanOptTransform(optarg); break;
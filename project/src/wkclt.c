@@ -916,6 +916,24 @@ static enumError cmd_dump ( bool brief_level, int cmd )
 ///////////////			command traverse		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+static void PrintFallResult ( const double3 *pt, double height, int kcl_flag )
+{
+    DASSERT(pt);
+    if (brief_count>1)
+	printf("%11.3f\n",height);
+    else if (brief_count)
+	printf("%11.3f %11.3f %11.3f\n",
+	    pt->x, height, pt->z );
+    else if ( kcl_flag >= 0 )
+	printf("%11.3f %11.3f %11.3f  0x%04x\n",
+	    pt->x, height, pt->z, kcl_flag );
+    else
+	printf("%11.3f %11.3f %11.3f      -1\n",
+	    pt->x, height, pt->z );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 static enumError cmd_traverse ( bool fall )
 {
     stdlog = stderr;
@@ -963,6 +981,19 @@ static enumError cmd_traverse ( bool fall )
     if ( err > ERR_WARNING || !param )
 	return err;
 
+    //--- without logging, all points are calculated as one batch
+
+    const bool batch = long_count <= 0;
+    uint n_query = 0;
+    kcl_query_t *query = 0;
+    if (batch)
+    {
+	ParamList_t *p;
+	for ( p = param->next; p; p = p->next )
+	    n_query++;
+	query = CALLOC(n_query+1,sizeof(*query));
+    }
+
     uint np = 1;
     enumError max_err = ERR_OK;
     for ( param = param->next; param; param = param->next, np++ )
@@ -975,22 +1006,18 @@ static enumError cmd_traverse ( bool fall )
 	if ( max_err < err )
 	     max_err = err;
 
+	if (batch)
+	{
+	    query[np-1].pt = pt.d3;
+	    continue;
+	}
+
 	if (fall)
 	{
 	    int kcl_flag;
 	    double height = FallKCL(&kcl,stdout,pt.d3,width,
 						long_count,type_mask,&kcl_flag);
-	    if (brief_count>1)
-		printf("%11.3f\n",height);
-	    else if (brief_count)
-		printf("%11.3f %11.3f %11.3f\n",
-		    pt.d3.x, height, pt.d3.z );
-	    else if ( kcl_flag >= 0 )
-		printf("%11.3f %11.3f %11.3f  0x%04x\n",
-		    pt.d3.x, height, pt.d3.z, kcl_flag );
-	    else
-		printf("%11.3f %11.3f %11.3f      -1\n",
-		    pt.d3.x, height, pt.d3.z );
+	    PrintFallResult(&pt.d3,height,kcl_flag);
 	}
 	else
 	    err = TraverseOctreeKCL( &kcl, stdout, pt.d3,
@@ -1000,6 +1027,26 @@ static enumError cmd_traverse ( bool fall )
 	     max_err = err;
     }
 
+    if (batch)
+    {
+	if (fall)
+	{
+	    FallListKCL(&kcl,query,n_query,width,type_mask);
+	    uint i;
+	    for ( i = 0; i < n_query; i++ )
+		PrintFallResult(&query[i].pt,query[i].height,query[i].kcl_flag);
+	}
+	else
+	{
+	    TraverseListKCL(&kcl,query,n_query);
+	    err = PrintTraverseListKCL(&kcl,stdout,query,n_query,brief_count<=0);
+	    if ( max_err < err )
+		 max_err = err;
+	}
+	fflush(stdout);
+	FREE(query);
+    }
+
     ResetKCL(&kcl);
     ResetRawData(&raw);
     return max_err;
@@ -1347,6 +1394,7 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_AROT:		err += ScanOptARotate(optarg); break;
 	case GO_TFORM_SCRIPT:	err += ScanOptTformScript(optarg); break;
 	case GO_KCL:		err += ScanOptKcl(optarg); break;
+	case GO_KCL_THREADS:	err += ScanOptKclThreads(optarg); break;
 	case GO_KCL_FLAG:	err += ScanOptKclFlag(optarg); break;
 	case GO_KCL_SCRIPT:	err += ScanOptKclScript(optarg); break;
 	case GO_TRI_AREA:	err += ScanOptTriArea(optarg); break;
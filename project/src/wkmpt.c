@@ -1647,6 +1647,7 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_PNG:		err += ScanOptPng(optarg); break;
 	case GO_LOAD_KCL:	err += ScanOptLoadKcl(optarg); break;
 	case GO_KCL:		err += ScanOptKcl(optarg); break;
+	case GO_KCL_THREADS:	err += ScanOptKclThreads(optarg); break;
 	case GO_KCL_FLAG:	err += ScanOptKclFlag(optarg); break;
 	case GO_KCL_SCRIPT:	err += ScanOptKclScript(optarg); break;
 	case GO_TRI_AREA:	err += ScanOptTriArea(optarg); break;
@@ -1712,6 +1712,8 @@ static void help_distrib ( enumError exit_code )
 		" Executing this instruction may take a little longer"
 		" as all track files need to be processed."
 		" Much more time is required if compression is forced."
+		" Use option {opt|--threads} to load and compress"
+		" the track files by parallel worker processes."
 		"\n"
 	"\n"
 
@@ -2825,6 +2827,7 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_SZS_MODE:	err += ScanOptSzsMode(optarg); break;
 	case GO_CACHE:		opt_cache = optarg; opt_remove_dest = true; break;
 	case GO_LOG_CACHE:	opt_log_cache = optarg; break;
+	case GO_THREADS:	err += ScanOptThreads(optarg); break;
 
 	case GO_COMPLETE:	opt_complete = true; break;
 
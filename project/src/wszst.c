@@ -37,8 +37,12 @@
 
 #include <time.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
 
 #include "dclib-utf8.h"
+#include "dclib-network.h"
 #include "lib-analyze.h"
 #include "lib-szs.h"
 #include "lib-brres.h"
@@ -163,6 +167,14 @@ static void list_compressions_exit()
 		" in 10 to 15 times and not in 32 (2^5) times like expected."
 		" This algorithm needs 4 times as much memory as the uncompressed file."
 		" So it is dedicated to small files only.\n"
+	"\n"
+	"\t{hl|200\tOPTIMAL}\t|"
+		"This {cmd|YAZ} compression calculates the cheapest sequence"
+		" of byte copies and back references for the best matches"
+		" of each position (optimal parsing)."
+		" It creates smaller files than the back tracking modes"
+		" in a fraction of their time."
+		" This algorithm needs 8 times as much memory as the uncompressed file.\n"
  #if HAVE_WIIMM_EXT && 0
 	"{heading|%.*s\n"
 	" {bad|500-530}\t\t|"
@@ -693,6 +705,7 @@ static enumError cmd_test_options()
     printf("  mipmap-size: %16x = %12d\n",opt_min_mipmap_size,opt_min_mipmap_size);
     printf("  mipmaps:     %16x = %12d\n",opt_mipmaps,opt_mipmaps);
     printf("  fast-mipmaps:%16x = %12d\n",fast_resize_enabled,fast_resize_enabled);
+    printf("  mipmap-filter:%15x = %12d\n",opt_mipmap_filter,opt_mipmap_filter);
     printf("  analyse-mode:%16x = %12d\n",opt_analyze_mode,opt_analyze_mode);
     printf("  set-flags:   %16x = %12d\n",set_flags,set_flags);
     printf("  kcl modes:   %16llx = \"%s\"\n",(u64)KCL_MODE,GetKclMode());
@@ -1349,7 +1362,32 @@ static enumError cmd_scancache()
     else
 	ScanSZSCache(first_param->arg,opt_purge);
 
-    return SaveSZSCache(force);
+    enumError err = SaveSZSCache(force);
+    if ( err == ERR_OK || err == ERR_NOTHING_TO_DO )
+	err = SaveSZSCacheText();
+    return err;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			command compactcache		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError cmd_compactcache()
+{
+    if (opt_cache)
+	AddParam(opt_cache);
+
+    if ( n_param != 1 )
+	return ERROR0(ERR_SYNTAX,"Exact one parameter (directory) expected.\n");
+
+    if (!IsDirectory(first_param->arg,false))
+	return ERROR0(ERR_SEMANTIC,"Directory expected: %s\n",first_param->arg);
+
+    parallel_count = 0;
+    SetupSZSCache(first_param->arg,false);
+    LoadSZSCache();
+    return SaveSZSCache(true);
 }
 
 //
@@ -3846,7 +3884,8 @@ struct cmd_patch_search_t
 
 static enumError patch_file_helper
 (
-    ccp		fname			// file name of source
+    ccp		fname,			// file name of source
+    void	*param			// not used
 )
 {
     PRINT0("patch_file_helper(%s)\n",fname);
@@ -4033,18 +4072,9 @@ static enumError cmd_patch()
 		GetNameFF(dest_ff_compr,dest_ff_arch), dest_ff_valid );
  #endif
 
-    enumError max_err = ERR_OK;
     StringField_t plist = {0};
     CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
-
-    for ( int argi = 0; argi < plist.used; argi++ )
-    {
-	ccp arg = plist.field[argi];
-	const enumError err = patch_file_helper(arg);
-	if ( max_err < err )
-	     max_err = err;
-    }
-
+    const enumError max_err = ExecParallelJobs(&plist,opt_threads,patch_file_helper,0);
     ResetStringField(&plist);
     return max_err;
 }
@@ -4545,179 +4575,188 @@ static enumError cmd_minimap()
 ///////////////			command compress		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static enumError cmd_compress()
+static enumError compress_file_helper
+(
+    ccp		arg,			// file name of source
+    void	*param			// not used
+)
 {
     static const char dest_fname[] = "\1P/\1N\1?T";
-    CheckOptDest(dest_fname,false);
-
     enumError max_err = ERR_OK;
-    StringField_t plist = {0};
-    CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
 
-    for ( int argi = 0; argi < plist.used; argi++ )
+    szs_file_t szs;
+    InitializeSZS(&szs);
+    enumError err = LoadSZS(&szs,arg,true,opt_ignore>0,false);
+
+    if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
     {
-	ccp arg = plist.field[argi];
+	file_format_t ff_dest = szs.fform_arch;
+	if (   ff_dest == FF_U8  && opt_fform == FF_WU8
+	    || ff_dest == FF_WU8 && opt_fform == FF_U8 )
+	{
+	     ff_dest = opt_fform;
+	}
+	PRINT("FF = %s , %s => %s\n",
+		GetNameFF_SZS(&szs),
+		GetNameFF_SZScurrent(&szs),
+		GetNameFF(0,ff_dest) );
 
-	szs_file_t szs;
-	InitializeSZS(&szs);
-	enumError err = LoadSZS(&szs,arg,true,opt_ignore>0,false);
+	char dest[PATH_MAX];
+	SubstDest(dest,sizeof(dest),arg,opt_dest,dest_fname,
+			GetExtFF(fform_compr,ff_dest),false);
+	if ( verbose >= 0 || testmode )
+	{
+	    fprintf(stdlog,"%s%sCOMPRESS %s:%s -> %s:%s\n",
+			verbose > 0 ? "\n" : "",
+			testmode ? "WOULD " : "",
+			GetNameFF_SZS(&szs), arg,
+			GetNameFF(fform_compr,ff_dest), dest );
+	    fflush(stdlog);
+	}
 
 	if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
 	{
-	    file_format_t ff_dest = szs.fform_arch;
-	    if (   ff_dest == FF_U8  && opt_fform == FF_WU8
-		|| ff_dest == FF_WU8 && opt_fform == FF_U8 )
-	    {
-		 ff_dest = opt_fform;
-	    }
-	    PRINT("FF = %s , %s => %s\n",
-		    GetNameFF_SZS(&szs),
-		    GetNameFF_SZScurrent(&szs),
-		    GetNameFF(0,ff_dest) );
+	    PatchSZS(&szs);
+	    if ( opt_norm || need_norm > 0 )
+		NormalizeSZS(&szs);
 
-	    char dest[PATH_MAX];
-	    SubstDest(dest,sizeof(dest),arg,opt_dest,dest_fname,
-			    GetExtFF(fform_compr,ff_dest),false);
-	    if ( verbose >= 0 || testmode )
-	    {
-		fprintf(stdlog,"%s%sCOMPRESS %s:%s -> %s:%s\n",
-			    verbose > 0 ? "\n" : "",
-			    testmode ? "WOULD " : "",
-			    GetNameFF_SZS(&szs), arg,
-			    GetNameFF(fform_compr,ff_dest), dest );
-		fflush(stdlog);
-	    }
+	    if ( ff_dest == FF_WU8 )
+		err = EncodeWU8(&szs);
 
 	    if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
 	    {
-		PatchSZS(&szs);
-		if ( opt_norm || need_norm > 0 )
-		    NormalizeSZS(&szs);
+		szs.dest_fname = dest;
+		CompressSZS(&szs,0,true);
+		szs.dest_fname = 0;
 
-		if ( ff_dest == FF_WU8 )
-		    err = EncodeWU8(&szs);
+		if ( szs.cache_used && parallel_count <= 0 )
+		    max_err = ERR_CACHE_USED;
 
-		if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
+		File_t F;
+		err = CreateFileOpt(&F,true,dest,testmode,arg);
+		if (F.f)
 		{
-		    szs.dest_fname = dest;
-		    CompressSZS(&szs,0,true);
-		    szs.dest_fname = 0;
-
-		    if ( szs.cache_used && (int)max_err < ERR_CACHE_USED && parallel_count <= 0 )
-			max_err = ERR_CACHE_USED;
-
-		    File_t F;
-		    err = CreateFileOpt(&F,true,dest,testmode,arg);
-		    if (F.f)
-		    {
-			SetFileAttrib(&F.fatt,&szs.fatt,0);
-			size_t wstat = fwrite(szs.cdata,1,szs.csize,F.f);
-			if ( wstat != szs.csize )
-			    err = FILEERROR1(&F,ERR_WRITE_FAILED,
-					"Writing %zu bytes failed: %s\n",
-					szs.csize, dest);
-		    }
-		    ResetFile(&F,opt_preserve);
-		    LinkCacheData(szs.cache_fname,dest,szs.cdata,szs.csize);
-
-		    if ( !err && opt_remove_src )
-			RemoveSource(arg,dest,verbose>=0,testmode);
+		    SetFileAttrib(&F.fatt,&szs.fatt,0);
+		    size_t wstat = fwrite(szs.cdata,1,szs.csize,F.f);
+		    if ( wstat != szs.csize )
+			err = FILEERROR1(&F,ERR_WRITE_FAILED,
+				    "Writing %zu bytes failed: %s\n",
+				    szs.csize, dest);
 		}
+		ResetFile(&F,opt_preserve);
+		LinkCacheData(szs.cache_fname,dest,szs.cdata,szs.csize);
+
+		if ( !err && opt_remove_src )
+		    RemoveSource(arg,dest,verbose>=0,testmode);
 	    }
 	}
-
-	if ( max_err < err )
-	     max_err = err;
-	ResetSZS(&szs);
     }
 
-    ResetStringField(&plist);
+    if ( max_err < err )
+	 max_err = err;
+    ResetSZS(&szs);
     return max_err;
 }
 
-//
-///////////////////////////////////////////////////////////////////////////////
-///////////////			command decompress		///////////////
-///////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
 
-static enumError cmd_decompress()
+static enumError cmd_compress()
 {
     static const char dest_fname[] = "\1P/\1N\1?T";
     CheckOptDest(dest_fname,false);
 
-    enumError max_err = ERR_OK;
     StringField_t plist = {0};
     CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
+    const enumError max_err = ExecParallelJobs(&plist,opt_threads,compress_file_helper,0);
+    ResetStringField(&plist);
+    return max_err;
+}
 
-    for ( int argi = 0; argi < plist.used; argi++ )
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			command decompress		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError decompress_file_helper
+(
+    ccp		arg,			// file name of source
+    void	*param			// not used
+)
+{
+    szs_file_t szs;
+    InitializeSZS(&szs);
+    enumError err = LoadSZS(&szs,arg,true,opt_ignore>0,false);
+
+    if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
     {
-	ccp arg = plist.field[argi];
+	file_format_t ff_dest = szs.fform_arch;
+	if (   ff_dest == FF_U8  && opt_fform == FF_WU8
+	    || ff_dest == FF_WU8 && opt_fform == FF_U8 )
+	{
+	     ff_dest = opt_fform;
+	}
+	PRINT("FF = %s , %s => %s\n",
+		GetNameFF_SZS(&szs),
+		GetNameFF_SZScurrent(&szs),
+		GetNameFF(0,ff_dest) );
 
-	szs_file_t szs;
-	InitializeSZS(&szs);
-	enumError err = LoadSZS(&szs,arg,true,opt_ignore>0,false);
+	char dest[PATH_MAX];
+	ccp ext = GetExtFF(ff_dest,0);
+	SubstDest(dest,sizeof(dest),arg,opt_dest,ext,ext,false);
+
+	if ( verbose >= 0 || testmode )
+	{
+	    fprintf(stdlog,"%s%sDECOMPRESS %s:%s -> %s:%s\n",
+			verbose > 0 ? "\n" : "",
+			testmode ? "WOULD " : "",
+			GetNameFF_SZS(&szs), arg,
+			GetNameFF(0,ff_dest), dest );
+	    fflush(stdlog);
+	}
 
 	if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
 	{
-	    file_format_t ff_dest = szs.fform_arch;
-	    if (   ff_dest == FF_U8  && opt_fform == FF_WU8
-		|| ff_dest == FF_WU8 && opt_fform == FF_U8 )
-	    {
-		 ff_dest = opt_fform;
-	    }
-	    PRINT("FF = %s , %s => %s\n",
-		    GetNameFF_SZS(&szs),
-		    GetNameFF_SZScurrent(&szs),
-		    GetNameFF(0,ff_dest) );
+	    PatchSZS(&szs);
+	    if ( opt_norm || need_norm > 0 )
+		NormalizeSZS(&szs);
 
-	    char dest[PATH_MAX];
-	    ccp ext = GetExtFF(ff_dest,0);
-	    SubstDest(dest,sizeof(dest),arg,opt_dest,ext,ext,false);
-
-	    if ( verbose >= 0 || testmode )
-	    {
-		fprintf(stdlog,"%s%sDECOMPRESS %s:%s -> %s:%s\n",
-			    verbose > 0 ? "\n" : "",
-			    testmode ? "WOULD " : "",
-			    GetNameFF_SZS(&szs), arg,
-			    GetNameFF(0,ff_dest), dest );
-		fflush(stdlog);
-	    }
+	    if ( ff_dest == FF_WU8 )
+		err = EncodeWU8(&szs);
 
 	    if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
 	    {
-		PatchSZS(&szs);
-		if ( opt_norm || need_norm > 0 )
-		    NormalizeSZS(&szs);
-
-		if ( ff_dest == FF_WU8 )
-		    err = EncodeWU8(&szs);
-
-		if ( err <= ERR_WARNING && err != ERR_NOT_EXISTS )
+		File_t F;
+		err = CreateFileOpt(&F,true,dest,testmode,arg);
+		if (F.f)
 		{
-		    File_t F;
-		    err = CreateFileOpt(&F,true,dest,testmode,arg);
-		    if (F.f)
-		    {
-			SetFileAttrib(&F.fatt,&szs.fatt,0);
-			size_t wstat = fwrite(szs.data,1,szs.size,F.f);
-			if ( wstat != szs.size )
-			    err = FILEERROR1(&F,ERR_WRITE_FAILED,
-					"Writing %zu bytes failed: %s\n",
-					szs.size, dest);
-		    }
-		    ResetFile(&F,opt_preserve);
-		    if ( !err && opt_remove_src )
-			RemoveSource(arg,dest,verbose>=0,testmode);
+		    SetFileAttrib(&F.fatt,&szs.fatt,0);
+		    size_t wstat = fwrite(szs.data,1,szs.size,F.f);
+		    if ( wstat != szs.size )
+			err = FILEERROR1(&F,ERR_WRITE_FAILED,
+				    "Writing %zu bytes failed: %s\n",
+				    szs.size, dest);
 		}
+		ResetFile(&F,opt_preserve);
+		if ( !err && opt_remove_src )
+		    RemoveSource(arg,dest,verbose>=0,testmode);
 	    }
 	}
-
-	if ( max_err < err )
-	     max_err = err;
-	ResetSZS(&szs);
     }
 
+    ResetSZS(&szs);
+    return err;
+}
+
+//-----------------------------------------------------------------------------
+
+static enumError cmd_decompress()
+{
+    static const char dest_fname[] = "\1P/\1N\1?T";
+    CheckOptDest(dest_fname,false);
+
+    StringField_t plist = {0};
+    CollectExpandParam(&plist,first_param,-1,WM__DEFAULT);
+    const enumError max_err = ExecParallelJobs(&plist,opt_threads,decompress_file_helper,0);
     ResetStringField(&plist);
     return max_err;
 }
@@ -5864,6 +5903,7 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_SLOT:		err += ScanOptSlot(optarg); break;
 	case GO_LOAD_KCL:	err += ScanOptLoadKcl(optarg); break;
 	case GO_KCL:		err += ScanOptKcl(optarg); break;
+	case GO_KCL_THREADS:	err += ScanOptKclThreads(optarg); break;
 	case GO_KCL_FLAG:	err += ScanOptKclFlag(optarg); break;
 	case GO_KCL_SCRIPT:	err += ScanOptKclScript(optarg); break;
 	case GO_TRI_AREA:	err += ScanOptTriArea(optarg); break;
@@ -5918,6 +5958,7 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_ESC:		err += ScanEscapeChar(optarg) < 0; break;
 	case GO_SOURCE:		SetSource(optarg); break;
 	case GO_ID_LIST:	SetIdList(optarg); break;
+	case GO_ID_LIST_INDEX:	opt_id_list_index = true; break;
 	case GO_REFERENCE:	SetReference(optarg); break;
 	case GO_DEST:		SetDest(optarg,false); break;
 	case GO_DEST2:		SetDest(optarg,true); break;
@@ -6013,12 +6054,17 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_EXT:		opt_ext++; break;
 	case GO_DECODE:		opt_decode = true; break;
 	case GO_CMPR_DEFAULT:	err += ScanOptCmprDefault(optarg); break;
+	case GO_CMPR_THREADS:	err += ScanOptCmprThreads(optarg); break;
+	case GO_CMPR_FIT:	err += ScanOptCmprFit(optarg); break;
+	case GO_PAL_QUANT:	err += ScanOptPalQuant(optarg); break;
+	case GO_PAL_THREADS:	err += ScanOptPalThreads(optarg); break;
 	case GO_N_MIPMAPS:	err += ScanOptNMipmaps(optarg); break;
 	case GO_MAX_MIPMAPS:	err += ScanOptMaxMipmaps(optarg); break;
 	case GO_MIPMAP_SIZE:	err += ScanOptMipmapSize(optarg); break;
 	case GO_MIPMAPS:	opt_mipmaps = +1; break;
 	case GO_NO_MIPMAPS:	opt_mipmaps = -1; break;
 	case GO_FAST_MIPMAPS:	fast_resize_enabled = true; break;
+	case GO_MIPMAP_FILTER:	err += ScanOptMipmapFilter(optarg); break;
 	case GO_CUT:		opt_cut = true; break;
 	case GO_RAW:		opt_raw = true; break;
 
@@ -6054,6 +6100,8 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 	case GO_CNAME:		opt_cname = optarg; break;
 	case GO_LOG_CACHE:	opt_log_cache = optarg; break;
 	case GO_PARALLEL:	parallel_count++; break;
+	case GO_THREADS:	err += ScanOptThreads(optarg); break;
+	case GO_COMPR_THREADS:	err += ScanOptComprThreads(optarg); break;
 	case GO_ID:		opt_id = true; break;
 	case GO_BASE64:		opt_base64 = true; err += ScanOptCoding64(optarg); break;
 	case GO_DB64:		opt_db64 = true; err += ScanOptCoding64(optarg); break;
@@ -6103,6 +6151,8 @@ static enumError CheckOptions ( int argc, char ** argv, bool is_env )
 ///////////////                   check command                 ///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+static enumError cmd_server(void); // defined behind the tool wrapper
+
 static enumError CheckCommand ( int argc, char ** argv )
 {
     const KeywordTab_t * cmd_ct = CheckCommandHelper(argc,argv,CommandTab);
@@ -6162,6 +6212,8 @@ static enumError CheckCommand ( int argc, char ** argv )
 	case CMD_AUTOADD:	err = cmd_autoadd(); break;
 	case CMD_TRACKS:	err = cmd_tracks(); break;
 	case CMD_SCANCACHE:	err = cmd_scancache(); break;
+	case CMD_COMPACTCACHE:	err = cmd_compactcache(); break;
+	case CMD_SERVER:	err = cmd_server(); break;
 	case CMD_EXPORT:	err = cmd_export(); break;
 	case CMD_SIZEOF:	err = cmd_sizeof(); break;
 	case CMD_CODE:		err = cmd_code(); break;
@@ -6297,6 +6349,7 @@ extern int main_wpatt ( int argc, char ** argv );
 extern int main_wstrt ( int argc, char ** argv );
 extern int main_wrapper ( int argc, char ** argv );
 extern int main_getopt ( int argc, char ** argv );
+static int main_client ( int argc, char ** argv );
 
 // [[wrapper_t]]
 typedef struct wrapper_t
@@ -6321,6 +6374,7 @@ static const wrapper_t wrapper_tab[] =
     { 0, main_wpatt, WPATT_SHORT, WPATT_LONG },
     { 0, main_wstrt, WSTRT_SHORT, WSTRT_LONG },
     { 2, main_getopt, "getopt", 0 },
+    { 2, main_client, "client", 0 },
     { 2, main_wrapper, "wrapper", 0 },
     {0,0,0}
 };
@@ -6345,6 +6399,618 @@ static const wrapper_t * FindWrapper ( int argc, char ** argv )
     return wrapper_tab;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Server mode: 'wszst SERVER socket' listens on a UNIX socket and executes
+// the requests of 'wszst CLIENT socket tool arg...' by forked processes.
+// So all tables loaded by the server are shared by the requests.
+//
+// request:  A single command line with quoted arguments: "cwd" "tool" "arg"...
+//           Control characters and the characters '"', '\' and ';' are
+//           escaped as \xHH.
+// response: Frames "CHANNEL SIZE\n" followed by SIZE bytes of data.
+//           CHANNEL is 1 for stdout and 2 for stderr. The final frame
+//           "0 STATUS\n" has no data and transmits the exit status.
+
+#define SERVER_IBUF_SIZE  0x200000	// max size of input buffer (request line)
+#define SERVER_OBUF_SIZE  0x40000	// max size of output buffer of a stream
+#define SERVER_FRAME_SIZE 0x10000	// max data size of a single frame
+
+typedef enum server_job_state_t
+{
+    SJ_IDLE,		// waiting for a request
+    SJ_RUNNING,		// job is running
+    SJ_EXITED,		// job has exited, output may be pending
+    SJ_FINISHED,	// final frame sent or stream closed
+}
+server_job_state_t;
+
+typedef struct server_job_t
+{
+    server_job_state_t	state;		// current state
+    pid_t		pid;		// process id of the job
+    int			status;		// exit status of the job
+    int			fd[2];		// -1 or read end of the pipes for stdout+stderr
+    uint		poll_index[2];	// poll index of 'fd'
+}
+server_job_t;
+
+static TCPHandler_t server_handler;
+static sigset_t server_sigmask;		// signal mask while waiting for sockets
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline server_job_t * GetServerJob ( TCPStream_t *ts )
+{
+    DASSERT(ts);
+    return (server_job_t*)((CommandTCPInfo_t*)ts->data)->data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void CloseServerJob ( server_job_t *job )
+{
+    DASSERT(job);
+    uint i;
+    for ( i = 0; i < 2; i++ )
+	if ( job->fd[i] != -1 )
+	{
+	    close(job->fd[i]);
+	    job->fd[i] = -1;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void SendServerStatus ( TCPStream_t *ts, int status )
+{
+    DASSERT(ts);
+    server_job_t *job = GetServerJob(ts);
+    CloseServerJob(job);
+    job->state = SJ_FINISHED;
+    PrintGrowBuffer(&ts->obuf,"0 %d\n",status);
+    ts->auto_close = 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void SendServerError ( TCPStream_t *ts, enumError err, ccp text, ccp arg )
+{
+    DASSERT(ts);
+
+    // same layout as the error messages of PrintError()
+    char msg[1000];
+    const int plen = strlen(ProgInfo.progname) + 2;
+    uint len = snprintf(msg,sizeof(msg),"!! %s: ERROR #%d [%s]\n!! %*s%s%s\n",
+				ProgInfo.progname, err, GetErrorName(err,"?"),
+				plen, "", text, arg ? arg : "" );
+    if ( len >= sizeof(msg) )
+	len = sizeof(msg) - 1;
+    PrintGrowBuffer(&ts->obuf,"2 %u\n",len);
+    InsertGrowBuffer(&ts->obuf,msg,len);
+    SendServerStatus(ts,err);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void RelayServerOutput ( TCPStream_t *ts, uint channel )
+{
+    DASSERT(ts);
+    DASSERT( channel < 2 );
+    server_job_t *job = GetServerJob(ts);
+
+    u8 buf[SERVER_FRAME_SIZE];
+    const ssize_t stat = read(job->fd[channel],buf,sizeof(buf));
+    if ( stat > 0 )
+    {
+	PrintGrowBuffer(&ts->obuf,"%u %zd\n",channel+1,stat);
+	InsertGrowBuffer(&ts->obuf,buf,stat);
+    }
+    else if ( !stat || errno != EINTR && errno != EAGAIN )
+    {
+	close(job->fd[channel]);
+	job->fd[channel] = -1;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int OnFDListServer
+(
+    TCPStream_t		*ts,		// valid TCP stream
+    FDList_t		*fdl,		// valid socket list
+    TCPFDList_t		mode,		// execution mode
+    bool		check_timeout	// true: enable timeout checks
+)
+{
+    DASSERT(ts);
+    server_job_t *job = GetServerJob(ts);
+    if ( ts->sock == -1 || job->state != SJ_RUNNING && job->state != SJ_EXITED )
+	return 0;
+
+    uint i;
+    switch (mode)
+    {
+     case TCP_FM_ADD_SOCK:
+	if ( job->state == SJ_EXITED && job->fd[0] == -1 && job->fd[1] == -1 )
+	    SendServerStatus(ts,job->status);
+	else if ( GetSpaceGrowBuffer(&ts->obuf) > SERVER_FRAME_SIZE + 100 )
+	{
+	    // read pipes only if the output buffer can store a complete frame
+	    for ( i = 0; i < 2; i++ )
+		job->poll_index[i] = AddFDList(fdl,job->fd[i],POLLIN);
+	}
+	break;
+
+     case TCP_FM_CHECK_SOCK:
+	for ( i = 0; i < 2; i++ )
+	    if ( GetEventFDList(fdl,job->fd[i],job->poll_index[i])
+			& (POLLIN|POLLHUP|POLLERR) )
+	    {
+		RelayServerOutput(ts,i);
+	    }
+	break;
+
+     default:
+	break;
+    }
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int OnCloseServer ( TCPStream_t *ts, u64 now_usec )
+{
+    DASSERT(ts);
+    server_job_t *job = GetServerJob(ts);
+    if ( job->state == SJ_RUNNING )
+	kill(job->pid,SIGTERM); // client is gone
+    CloseServerJob(job);
+    job->state = SJ_FINISHED;
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static const wrapper_t * FindServerTool ( ccp name )
+{
+    const wrapper_t *w;
+    for ( w = wrapper_tab; w->func; w++ )
+	if ( !w->hide && !strcasecmp(w->name,name) )
+	    return w;
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void RunServerJob
+(
+    // executed by the forked process, never returns
+
+    const wrapper_t	*w,		// tool to execute
+    ccp			cwd,		// working directory of the client
+    int			argc,		// number of arguments in 'argv'
+    char		**argv,		// arguments, argv[0] is the tool name
+    int			*fd_out,	// pipe for stdout
+    int			*fd_err		// pipe for stderr
+)
+{
+    DASSERT(w);
+
+    //--- restore the signal setup of a standard tool
+
+    static const int sigtab[] = { SIGTERM, SIGINT, SIGHUP, SIGALRM, SIGPIPE, SIGCHLD, -1 };
+    uint i;
+    for ( i = 0; sigtab[i] >= 0; i++ )
+	signal(sigtab[i],SIG_DFL);
+    sigprocmask(SIG_SETMASK,&server_sigmask,0);
+
+
+    //--- close all files of the server and redirect stdio
+
+    TCPStream_t *ts;
+    for ( ts = server_handler.first; ts; ts = ts->next )
+    {
+	CloseServerJob(GetServerJob(ts));
+	if ( ts->sock != -1 )
+	    close(ts->sock);
+    }
+
+    for ( i = 0; i < TCP_HANDLER_MAX_LISTEN; i++ )
+	if ( server_handler.listen[i].sock != -1 )
+	    close(server_handler.listen[i].sock);
+
+    const int fd_null = open("/dev/null",O_RDONLY);
+    if ( fd_null != -1 )
+    {
+	dup2(fd_null,STDIN_FILENO);
+	close(fd_null);
+    }
+
+    dup2(fd_out[1],STDOUT_FILENO);
+    dup2(fd_err[1],STDERR_FILENO);
+    close(fd_out[0]);
+    close(fd_out[1]);
+    close(fd_err[0]);
+    close(fd_err[1]);
+
+    if (chdir(cwd))
+    {
+	ERROR1(ERR_CANT_OPEN,"Can't change directory: %s\n",cwd);
+	exit(ERR_CANT_OPEN);
+    }
+
+
+    //--- the parameter list still contains the socket of the server
+
+    first_param = 0;
+    append_param = &first_param;
+    n_param = 0;
+    current_command = 0;
+
+    const int stat = w->func(argc,argv);
+    ClosePager();
+    exit(FixExitStatus(stat));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError OnScanArgServer
+(
+    TCPStream_t	*ts,		// valid stream data
+    int		argc,		// number of arguments in 'argv'
+    char	**argv,		// array with 'argc' arguments + a NULL term
+    u64		now_usec	// NULL or current time in usec
+)
+{
+    DASSERT(ts);
+    server_job_t *job = GetServerJob(ts);
+    if ( job->state != SJ_IDLE )
+	return ERR_OK; // only one request per connection
+
+    // argv[0] is the stream info, argv[1] the directory and argv[2] the tool
+    if ( argc < 3 )
+    {
+	SendServerError(ts,ERR_SYNTAX,"Directory and tool name expected.",0);
+	return ERR_SYNTAX;
+    }
+
+    const wrapper_t *w = FindServerTool(argv[2]);
+    if (!w)
+    {
+	SendServerError(ts,ERR_SYNTAX,"Unknown tool: ",argv[2]);
+	return ERR_SYNTAX;
+    }
+
+    int fd_out[2], fd_err[2];
+    if (pipe(fd_out))
+    {
+	SendServerError(ts,ERR_CANT_CREATE,"Can't create pipe.",0);
+	return ERR_CANT_CREATE;
+    }
+    if (pipe(fd_err))
+    {
+	close(fd_out[0]);
+	close(fd_out[1]);
+	SendServerError(ts,ERR_CANT_CREATE,"Can't create pipe.",0);
+	return ERR_CANT_CREATE;
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    const pid_t pid = fork();
+    if (!pid)
+	RunServerJob(w,argv[1],argc-2,argv+2,fd_out,fd_err);
+
+    close(fd_out[1]);
+    close(fd_err[1]);
+    if ( pid < 0 )
+    {
+	close(fd_out[0]);
+	close(fd_err[0]);
+	SendServerError(ts,ERR_FATAL,"Can't fork process.",0);
+	return ERR_FATAL;
+    }
+
+    if ( verbose > 0 )
+    {
+	printf("JOB %d: %s [%s]\n",pid,argv[2],argv[1]);
+	fflush(stdout);
+    }
+
+    job->state	= SJ_RUNNING;
+    job->pid	= pid;
+    job->fd[0]	= fd_out[0];
+    job->fd[1]	= fd_err[0];
+
+    // jobs may run for a long time => disable the command timeout
+    CommandTCPInfo_t *ci = (CommandTCPInfo_t*)ts->data;
+    ci->timeout_usec = 0;
+    SetTimeoutCommandTCP(ts,now_usec);
+    return ERR_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int OnAddedServerStream ( TCPStream_t *ts )
+{
+    DASSERT(ts);
+    OnCreateCommandTCP(ts);
+    ts->OnFDList = OnFDListServer;
+    ts->OnClose  = OnCloseServer;
+    InitializeGrowBuffer(&ts->ibuf,SERVER_IBUF_SIZE);
+    InitializeGrowBuffer(&ts->obuf,SERVER_OBUF_SIZE);
+
+    CommandTCPInfo_t *ci = (CommandTCPInfo_t*)ts->data;
+    ci->OnScanArg = OnScanArgServer;
+
+    server_job_t *job = GetServerJob(ts);
+    job->state = SJ_IDLE;
+    job->fd[0] = job->fd[1] = -1;
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void ReapServerJobs()
+{
+    int status;
+    pid_t pid;
+    while ( ( pid = waitpid(-1,&status,WNOHANG) ) > 0 )
+    {
+	TCPStream_t *ts;
+	for ( ts = server_handler.first; ts; ts = ts->next )
+	{
+	    server_job_t *job = GetServerJob(ts);
+	    if ( job->state == SJ_RUNNING && job->pid == pid )
+	    {
+		job->state  = SJ_EXITED;
+		job->status = WIFEXITED(status)   ? WEXITSTATUS(status)
+			    : WIFSIGNALED(status) ? 128 + WTERMSIG(status)
+			    : ERR_FATAL;
+		break;
+	    }
+	}
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void OnSigChildServer ( int signum )
+{
+    // nothing to do, the signal only interrupts the waiting for sockets
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static enumError cmd_server()
+{
+    if ( n_param != 1 )
+	return ERROR0(ERR_SYNTAX,"Exact one parameter (socket file) expected.\n");
+    ccp path = first_param->arg;
+
+
+    //--- load all tables, that are shared by the jobs
+
+    if (opt_cache)
+    {
+	// jobs change the working directory => use an absolute path
+	char buf[PATH_MAX];
+	if (realpath(opt_cache,buf))
+	    opt_cache = STRDUP(buf);
+	SetupSZSCache(opt_cache,true);
+	LoadSZSCache();
+    }
+
+    if (kcl_ref_fname)
+    {
+	// a job with another --load-kcl unloads the KCL, see ScanOptLoadKcl()
+	char buf[PATH_MAX];
+	if (realpath(kcl_ref_fname,buf))
+	    kcl_ref_fname = STRDUP(buf);
+    }
+
+    SetupExtendedSZS();
+    SetupKCL();
+    SetupKMP();
+    LoadReferenceKCL();
+    GetPrefixTable();
+    GetCategoryList();
+    SetupParserVars();
+    DefineDefaultParserFunc();
+
+
+    //--- setup socket
+
+    InitializeTCPHandler(&server_handler,
+			sizeof(CommandTCPInfo_t) + sizeof(server_job_t) );
+    server_handler.OnAddedStream = OnAddedServerStream;
+
+    // only the owner may connect => create the socket with mode 0600
+    const mode_t saved_umask = umask(0177);
+    enumError err = ListenUnixTCP(&server_handler,path);
+    umask(saved_umask);
+    if (err)
+    {
+	ResetTCPHandler(&server_handler);
+	return err;
+    }
+
+
+    //--- setup signals, SIGCHLD is only accepted while waiting
+
+    SetupSignalHandler(3,0);
+    signal(SIGPIPE,SIG_IGN);
+
+    struct sigaction sa;
+    memset(&sa,0,sizeof(sa));
+    sa.sa_handler = OnSigChildServer;
+    sigaction(SIGCHLD,&sa,0);
+
+    sigset_t block;
+    sigemptyset(&block);
+    sigaddset(&block,SIGCHLD);
+    sigprocmask(SIG_BLOCK,&block,&server_sigmask);
+
+    if ( verbose >= 0 )
+    {
+	printf("Server listens on %s\n",path);
+	fflush(stdout);
+    }
+
+
+    //--- main loop
+
+    FDList_t fdl;
+    InitializeFDList(&fdl,true);
+
+    while (!SIGINT_level)
+    {
+	ReapServerJobs();
+	ClearFDList(&fdl);
+	AddSocketsTCP(&server_handler,&fdl);
+	const int stat = PWaitFDList(&fdl,&server_sigmask);
+	ManageSocketsTCP(&server_handler,&fdl,stat);
+    }
+
+
+    //--- terminate
+
+    UnlistenAllTCP(&server_handler);
+    ResetTCPHandler(&server_handler);
+    ResetFDList(&fdl);
+    sigprocmask(SIG_SETMASK,&server_sigmask,0);
+
+    if ( verbose >= 0 )
+	printf("Server terminated.\n");
+    SIGINT_level = 0;
+    return ERR_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool WriteClient ( int fd, cvp data, uint size )
+{
+    const u8 *ptr = data;
+    while ( size > 0 )
+    {
+	const ssize_t stat = write(fd,ptr,size);
+	if ( stat < 0 )
+	{
+	    if ( errno == EINTR )
+		continue;
+	    return false;
+	}
+	ptr  += stat;
+	size -= stat;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void InsertArgClient ( GrowBuffer_t *gb, ccp arg )
+{
+    DASSERT(gb);
+    DASSERT(arg);
+
+    InsertGrowBuffer(gb," \"",2);
+    for ( ; *arg; arg++ )
+    {
+	const u8 ch = *arg;
+	if ( ch < ' ' || ch == '"' || ch == '\\' || ch == ';' || ch == 0x7f )
+	    PrintGrowBuffer(gb,"\\x%02x",ch);
+	else
+	    InsertCharGrowBuffer(gb,ch);
+    }
+    InsertCharGrowBuffer(gb,'"');
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int main_client ( int argc, char ** argv )
+{
+    SetupLib(argc,argv,TOOLSET_SHORT,VERSION,TITLE);
+
+    if ( argc < 3 )
+    {
+	printf("\n%s\n\n   Usage: %s CLIENT socket_file tool [arg]...\n\n"
+		"Send a command to a server started by 'wszst SERVER socket_file'.\n\n",
+		TOOLSET_TITLE, ProgInfo.progname );
+	return ERR_OK;
+    }
+
+    char cwd[PATH_MAX];
+    if (!getcwd(cwd,sizeof(cwd)))
+	return ERROR1(ERR_FATAL,"Can't determine current directory.\n");
+
+    const int sock = ConnectUnixTCP(argv[1],false);
+    if ( sock == -1 )
+	return ERR_CANT_CONNECT;
+
+
+    //--- send request
+
+    GrowBuffer_t gb;
+    InitializeGrowBuffer(&gb,SERVER_IBUF_SIZE);
+    InsertArgClient(&gb,cwd);
+    int i;
+    for ( i = 2; i < argc; i++ )
+	InsertArgClient(&gb,argv[i]);
+    InsertCharGrowBuffer(&gb,'\n');
+
+    if (!WriteClient(sock,gb.ptr,gb.used))
+    {
+	close(sock);
+	ResetGrowBuffer(&gb);
+	return ERROR1(ERR_WRITE_FAILED,"Can't send request to server: %s\n",argv[1]);
+    }
+    ClearGrowBuffer(&gb);
+
+
+    //--- relay frames to stdout and stderr until the status is received
+
+    int status = -1;
+    while ( status < 0 )
+    {
+	u8 buf[SERVER_FRAME_SIZE];
+	const ssize_t stat = read(sock,buf,sizeof(buf));
+	if ( stat < 0 && errno == EINTR )
+	    continue;
+	if ( stat <= 0 )
+	    break;
+	InsertGrowBuffer(&gb,buf,stat);
+
+	for(;;)
+	{
+	    char *eol = memchr(gb.ptr,'\n',gb.used);
+	    if (!eol)
+		break;
+
+	    char *end;
+	    const uint channel = strtoul((ccp)gb.ptr,&end,10);
+	    const uint size = strtoul(end,0,10);
+	    const uint head = eol + 1 - (char*)gb.ptr;
+	    if (!channel)
+	    {
+		status = size;
+		break;
+	    }
+	    if ( gb.used < head + size )
+		break;
+
+	    WriteClient( channel == 1 ? STDOUT_FILENO : STDERR_FILENO,
+				gb.ptr + head, size );
+	    DropGrowBuffer(&gb,head+size);
+	}
+    }
+
+    close(sock);
+    ResetGrowBuffer(&gb);
+    if ( status < 0 )
+	return ERROR0(ERR_READ_FAILED,"Connection to server lost: %s\n",argv[1]);
+    return status;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 int main_wrapper ( int argc, char ** argv )
@@ -624,7 +624,7 @@ static enumError test_cmpr ( int argc, char ** argv )
 
     //---- collect data
 
-    const uint n_info = 3;
+    const uint n_info = 4;
     cmpr_info_t info_tab[n_info];
 
     const uint N_LOOP = 100000;
@@ -639,6 +639,7 @@ static enumError test_cmpr ( int argc, char ** argv )
 		case  0: CMPR_distance(vector[0],info,false); break;
 		case  1: CMPR_distance(vector[0],info,true); break;
 		case  2: CMPR_wiimm(vector[0],info); break;
+		case  3: CMPR_cluster(vector[0],info); break;
 		default: ASSERT(0);
 	    }
 	info->usec = GetTimerUSec() - usec;